@@ -14,6 +14,7 @@ using namespace std;
 using namespace ibex;
 
 int main(int argc, char** argv) {
+	Timer timer;
 
 	/*	{
 		double nb=10;
@@ -28,47 +29,47 @@ int main(int argc, char** argv) {
 		double _box[][2] = {{5,15},  {15,25}};
 		IntervalVector box(2,_box);
 
-		Timer::start();
+		timer.start();
 		double time =0;
 		for (int i=0; i<nb ;i++) {old_LB.push(new OptimCell((pow(-1,i)*i)*box));}
 		for (int i=0; i<nb ;i++) { delete old_LB.pop();}
-		Timer::stop();
-		time += Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time += timer.get_time();
 
 		cout << "old_LB= "<<time <<endl;
 
-		Timer::start();
+		timer.start();
 		 time =0;
 		for (int i=0; i<nb ;i++) {LB.push(new OptimCell((pow(-1,i)*i)*box));}
 		for (int i=0; i<nb ;i++) { delete LB.pop();}
-		Timer::stop();
-		time += Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time += timer.get_time();
 		cout << "LB= "<<time <<endl;
 
 
-		Timer::start();
+		timer.start();
 		time =0;
 		for (int i=0; i<nb ;i++) {old_LB.push(new OptimCell((pow(-1,i)*i)*box));}
 		old_LB.contractHeap(50);
-		Timer::stop();
-		time += Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time += timer.get_time();
 
 		cout << "contract old_LB= "<<time <<endl;
 
-		Timer::start();
+		timer.start();
 		 time =0;
 		for (int i=0; i<nb ;i++) {LB.push(new OptimCell((pow(-1,i)*i)*box));}
 		LB.contractHeap(50);
-		Timer::stop();
-		time += Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time += timer.get_time();
 		cout << "contract LB= "<<time <<endl;
 
-		Timer::start();
+		timer.start();
 		 time =0;
 		for (int i=0; i<nb ;i++) {dd.push(new OptimCell((pow(-1,i)*i)*box));}
 		for (int i=0; i<nb ;i++) { delete dd.pop();}
-		Timer::stop();
-		time += Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time += timer.get_time();
 		cout << "Double= "<<time <<endl;
 
 
@@ -85,12 +86,12 @@ int main(int argc, char** argv) {
 		double _box[][2] = {{5,15},  {15,25}};
 		IntervalVector box(2,_box);
 
-		Timer::start();
+		timer.start();
 		 time =0;
 		for (int i=0; i<nb ;i++) {dd2.push(new Cell((pow(-1,i)*i)*box));}
 		for (int i=0; i<nb ;i++) { delete dd2.pop();}
-		Timer::stop();
-		time += Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time += timer.get_time();
 		cout << "Double 2= "<<time <<endl;
 
 	}
@@ -0,0 +1,100 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_midrad.cpp
+// Author      : agent
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Compares the midpoint-radius product of interval matrices (mul_midrad)
+ * with the standard product (triple loop of interval operations), in time
+ * and in width, for square matrices of size n=10...500.
+ *
+ * Usage: bench_midrad [rad]
+ *
+ * The midpoints of the entries are random numbers in [-1,1] and the radii
+ * are random numbers in [0,rad] (default: 1e-3).
+ */
+
+namespace {
+
+double rand_double(double a, double b) {
+	return a+(b-a)*((double) rand())/RAND_MAX;
+}
+
+IntervalMatrix random_matrix(int n, double rad) {
+	IntervalMatrix A(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			double c=rand_double(-1,1);
+			double r=rand_double(0,rad);
+			A[i][j]=Interval(c-r,c+r);
+		}
+	return A;
+}
+
+IntervalMatrix standard_product(const IntervalMatrix& A, const IntervalMatrix& B) {
+	int n=A.nb_rows();
+	IntervalMatrix C(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			Interval s=Interval::ZERO;
+			for (int k=0; k<n; k++)
+				s+=A[i][k]*B[k][j];
+			C[i][j]=s;
+		}
+	return C;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+	double rad=argc>1 ? atof(argv[1]) : 1e-3;
+
+	int sizes[]={10,20,50,100,200,500};
+
+	printf("   n   standard(s)  mid-rad(s)  speedup   mean width ratio   max width ratio\n");
+
+	for (unsigned int s=0; s<sizeof(sizes)/sizeof(int); s++) {
+		int n=sizes[s];
+		IntervalMatrix A=random_matrix(n,rad);
+		IntervalMatrix B=random_matrix(n,rad);
+
+		// repeat small products to get measurable times
+		int rep=n<=50 ? 10000/(n*n/100+1) : 1;
+
+		Timer timer;
+		timer.start();
+		IntervalMatrix C1(n,n);
+		for (int r=0; r<rep; r++) C1=standard_product(A,B);
+		timer.stop();
+		double t1=timer.get_time()/rep;
+
+		timer.start();
+		IntervalMatrix C2(n,n);
+		for (int r=0; r<rep; r++) C2=mul_midrad(A,B);
+		timer.stop();
+		double t2=timer.get_time()/rep;
+
+		double sum=0, max=0;
+		for (int i=0; i<n; i++)
+			for (int j=0; j<n; j++) {
+				double ratio=C2[i][j].diam()/C1[i][j].diam();
+				sum+=ratio;
+				if (ratio>max) max=ratio;
+			}
+
+		printf("%4d   %11.6f  %10.6f  %7.2f   %16.4f   %15.4f\n", n, t1, t2, t1/t2, sum/(n*n), max);
+	}
+
+	return 0;
+}
@@ -14,6 +14,7 @@ using namespace std;
 using namespace ibex;
 
 int main() {
+	Timer timer;
 	int n= 1.e8;
 	double a[5][4]= { {4,4,4,4}, {1,1,1,1}, {8,8,8,8}, {6,6,6,6}, { 3,7,3,7}};
 	double c[5] = {0.1, 0.2, 0.2, 0.4, 0.4};
@@ -26,7 +27,7 @@ int main() {
 	cout << " CPU-time for "<<n<<" evaluations of the Shekel-5 function at the point x1=(4,4,4,4)" <<endl;
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 
 		double f, z;
 		for (int k =0; k<n; k++){
@@ -39,13 +40,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Double precision: " << time << " s" << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		IntervalVector x(4,Interval(4));
 		Interval f, z;
 		for (int k =0; k<n; k++){
@@ -58,13 +59,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Interval Arithmetic: " << time << " s" << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_No> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_No>(4,l+1,Interval(4));
@@ -81,13 +82,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 No Rounding: " << time << " s" << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_sAF> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_sAF>(4,l+1,Interval(4));
@@ -104,13 +105,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 sAF: " << time << " s" << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_iAF> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_iAF>(4,l+1,Interval(4));
@@ -127,14 +128,14 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 iAF: " << time << " s" << endl;
 	}
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_fAF1> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_fAF1>(4,l+1,Interval(4));
@@ -151,14 +152,14 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 fAF version 1: " << time << " s" << endl;
 	}
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_fAF2> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_fAF2>(4,l+1,Interval(4));
@@ -175,14 +176,14 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 fAF version 2: " << time << " s" << endl;
 	}
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_fAF2_fma> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_fAF2_fma>(4,l+1,Interval(4));
@@ -199,8 +200,8 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 fAF version 2 with fma option: " << time << " s" << endl;
 	}
 
@@ -209,7 +210,7 @@ int main() {
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		IntervalVector x(4,Interval(3.9,4.1));
 		Interval f, z;
 		for (int k =0; k<n; k++){
@@ -222,13 +223,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Interval Arithmetic: " << time << " s, eval = "<< f << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_No> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_No>(4,l+1,Interval(3.9,4.1));
@@ -245,13 +246,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 No Rounding: " << time << " s, eval = "<< f << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_sAF> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_sAF>(4,l+1,Interval(3.9,4.1));
@@ -268,13 +269,13 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 sAF: " << time << " s, eval = "<< f << endl;
 	}
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_iAF> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_iAF>(4,l+1,Interval(3.9,4.1));
@@ -291,14 +292,14 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 iAF: " << time << " s, eval = "<< f << endl;
 	}
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_fAF1> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_fAF1>(4,l+1,Interval(3.9,4.1));
@@ -315,14 +316,14 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 fAF version 1: " << time << " s, eval = "<< f << endl;
 	}
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_fAF2> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_fAF2>(4,l+1,Interval(3.9,4.1));
@@ -339,14 +340,14 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 fAF version 2: " << time << " s, eval = "<< f << endl;
 	}
 
 	{
 		double time=0;
-		Timer::start();
+		timer.start();
 		Affine2Main<AF_fAF2_fma> x[4];
 		for (int l=0; l<4;l++){
 			x[l]= Affine2Main<AF_fAF2_fma>(4,l+1,Interval(3.9,4.1));
@@ -363,8 +364,8 @@ int main() {
 				f -= 1/(z+c[i]);
 			}
 		}
-		Timer::stop();
-		time+= Timer::VIRTUAL_TIMELAPSE();
+		timer.stop();
+		time+= timer.get_time();
 		cout<< "Affine2 fAF version 2 with fma option: " << time << " s, eval = "<< f << endl;
 	}
 
@@ -21,7 +21,7 @@ int main(int argc, char** argv) {
 
 		// check the number of arguments
 		if (argc<5) {
-			ibex_error("usage: defaultoptimizer filename prec goal_prec timelimit");
+			ibex_error("usage: defaultoptimizer filename prec goal_prec timelimit [nb_threads]");
 		}
 
 		// Load a system of equations
@@ -32,11 +32,37 @@ int main(int argc, char** argv) {
 		double prec       = convert("prec",argv[2]);
 		double goal_prec  = convert("goal_prec",argv[3]);  // the required precision for the objective
 		double time_limit = convert("timelimit",argv[4]);
+		int nb_threads    = argc>5 ? (int) convert("nb_threads",argv[5]) : 1;
 
 		if (!sys.goal) {
 			ibex_error(" input file has not goal (it is not an optimization problem).");
 		}
 
+		if (nb_threads>1) {
+			// Each worker gets its own copy of the system (and its own optimizer).
+			vector<System*> systems;
+			vector<DefaultOptimizer*> optimizers;
+			Array<Optimizer> opt(nb_threads);
+			for (int i=0; i<nb_threads; i++) {
+				systems.push_back(new System(argv[1]));
+				optimizers.push_back(new DefaultOptimizer(*systems[i],prec,goal_prec));
+				opt.set_ref(i,*optimizers[i]);
+			}
+
+			ParallelOptimizer po(opt);
+			po.timeout=time_limit;
+			cout.precision(12);
+
+			po.optimize(sys.box);
+			po.report();
+
+			for (int i=0; i<nb_threads; i++) {
+				delete optimizers[i];
+				delete systems[i];
+			}
+			return 0;
+		}
+
 		// Build the default optimizer
 		DefaultOptimizer o(sys,prec,goal_prec);
 
@@ -21,7 +21,7 @@ int main(int argc, char** argv){
 
 		// check the number of arguments
 		if (argc<4) {
-			ibex_error("usage: defaultsolver filename prec timelimit");
+			ibex_error("usage: defaultsolver filename prec timelimit [nb_threads]");
 		}
 
 		// Load a system of equations
@@ -31,6 +31,38 @@ int main(int argc, char** argv){
 
 		double prec       = convert("prec",argv[2]);
 		double time_limit = convert("timelimit",argv[3]);
+		int nb_threads    = argc>4 ? (int) convert("nb_threads",argv[4]) : 1;
+
+		if (nb_threads>1) {
+			// Each worker gets its own copy of the system (and of the default contractor/bisector).
+			vector<System*> systems;
+			vector<DefaultSolver*> solvers;
+			Array<Ctc> ctc(nb_threads);
+			Array<Bsc> bsc(nb_threads);
+			for (int i=0; i<nb_threads; i++) {
+				systems.push_back(new System(argv[1]));
+				solvers.push_back(new DefaultSolver(*systems[i],prec));
+				ctc.set_ref(i,solvers[i]->Solver::ctc);
+				bsc.set_ref(i,solvers[i]->bsc);
+			}
+
+			ParallelSolver ps(ctc,bsc);
+			ps.time_limit=time_limit;
+			ps.trace=1;
+			cout.precision(12);
+
+			vector<IntervalVector> sols=ps.solve(sys.box);
+			cout << "number of solutions=" << sols.size() << endl;
+			cout << "real time used=" << ps.time << "s."<< endl;
+			cout << "number of cells=" << ps.nb_cells << endl;
+			cout << "number of steals=" << ps.nb_steals << endl;
+
+			for (int i=0; i<nb_threads; i++) {
+				delete solvers[i];
+				delete systems[i];
+			}
+			return 0;
+		}
 
 		DefaultSolver s(sys,prec);
 		s.time_limit=time_limit;
@@ -219,13 +219,26 @@ int LinearRelaxXTaylor::linearization(const IntervalVector& box, LinearSolver& l
 
 	int cont =0;
 
+	// the derivatives of a constraint w.r.t. its used variables
+	// (each constraint only depends on a few variables)
+	std::vector<Interval> g;
+
 	// Create the linear relaxation of each constraint
 	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
 		//cout << "[LinearRelaxXTaylor] ctr n°" << ctr << endl;
 		IntervalVector G(sys.nb_var);
 
 		if(lmode==TAYLOR) {                 // derivatives are computed once (Taylor)
-			sys.ctrs[ctr].f.gradient(box,G);
+			const Function& fi=sys.f[ctr];
+			g.resize(fi.nb_used_vars());
+			// outside the definition domain: only this
+			// constraint loses its gradient
+			if (g.empty() || fi.sparse_gradient(box,&g[0])) {
+				G.clear();
+				for (int k=0; k<fi.nb_used_vars(); k++)
+					G[fi.used_var(k)]=g[k];
+			} else
+				G.set_empty();
 		}
 		else {
 			// to set all the constant derivatives that have been already computed
@@ -298,14 +311,25 @@ int LinearRelaxXTaylor::X_Linearization(const IntervalVector& savebox,
 	Vector row1(n);
 
 
+	// the derivatives of ctr w.r.t. its used variables (numeric alternative)
+	std::vector<Interval> g(sys.ctrs[ctr].f.nb_used_vars());
+	int k=-1; // index of the current variable among the used variables
+
 	for (int j=0; j< n; j++) {
 		//cout << "[LinearRelaxXTaylor] variable n°" << j << endl;
 	  if (sys.ctrs[ctr].f.used(j)) {
+		  k++;
 		  if (lmode == HANSEN && !linear[ctr][j]) {
 			  // get the partial derivative of ctr w.r.t. var n°j
-	    	  G[j]= df ? (*df)[ctr*n+j].eval(box) :
-	    			  //other alternative (numeric):
-	    			  sys.f[ctr].gradient(box)[j];
+			  if (df)
+				  G[j]= (*df)[ctr*n+j].eval(box);
+			  else {
+				  //other alternative (numeric):
+				  if (sys.ctrs[ctr].f.sparse_gradient(box,&g[0]))
+					  G[j]= g[k];
+				  else
+					  G[j].set_empty();
+			  }
 		  }
 	  }
 	  else
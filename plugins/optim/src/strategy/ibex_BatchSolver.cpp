@@ -0,0 +1,116 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchSolver.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BatchSolver.h"
+#include "ibex_Random.h"
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * A worker: a thread that solves pending instances with its own solver.
+ */
+class BatchSolver::Worker : public Thread {
+public:
+	Worker(BatchSolver& batch, int num);
+
+protected:
+	void run();
+
+	BatchSolver& batch;
+	DefaultSolver& solver;
+};
+
+BatchSolver::Worker::Worker(BatchSolver& batch, int num) : batch(batch), solver(batch.solvers[num]) {
+
+}
+
+void BatchSolver::Worker::run() {
+	int n=batch.boxes->size();
+	int i;
+	while ((i=atomic_add(batch.next,1)-1) < n) {
+		Result& r=(*batch.results)[i];
+
+		// the counters of the solver are not reset by start()
+		solver.nb_cells=0;
+		solver.time=0;
+		solver.time_limit=batch.time_limit;
+		solver.cell_limit=batch.cell_limit;
+		solver.trace=-1; // the threads print nothing
+
+		// same random choices as a sequential DefaultSolver,
+		// whatever the thread that solves the instance
+		RNG::srand(1);
+
+		// note: time and cell limits are handled by the solver
+		r.error=false;
+		try {
+			r.sols=solver.solve((*batch.boxes)[i]);
+			r.complete=solver.buffer.empty();
+		} catch (...) {
+			// whatever the exception, the instance is not solved
+			r.error=true;
+			r.complete=false;
+		}
+		r.nb_cells=solver.nb_cells;
+		r.time=solver.time;
+		solver.buffer.flush();
+	}
+}
+
+BatchSolver::BatchSolver(const System& sys, double prec, int nb_threads) :
+		nb_threads(nb_threads>0? nb_threads : Thread::nb_procs()),
+		time_limit(-1), cell_limit(-1), sys(this->nb_threads), solvers(this->nb_threads),
+		boxes(NULL), results(NULL), next(0) {
+
+	// note: the solvers cannot be built concurrently
+	for (int i=0; i<this->nb_threads; i++) {
+		this->sys.set_ref(i,*new System(sys));
+		solvers.set_ref(i,*new DefaultSolver(this->sys[i],prec));
+	}
+}
+
+BatchSolver::~BatchSolver() {
+	for (int i=0; i<nb_threads; i++) {
+		delete &solvers[i];
+		delete &sys[i];
+	}
+}
+
+vector<BatchSolver::Result> BatchSolver::solve(const vector<IntervalVector>& boxes) {
+	vector<Result> results(boxes.size());
+
+	this->boxes=&boxes;
+	this->results=&results;
+	next=0;
+
+	// no need for more threads than instances
+	int nb=nb_threads<(int) boxes.size()? nb_threads : (int) boxes.size();
+
+	Worker** workers=new Worker*[nb];
+	for (int i=0; i<nb; i++) {
+		workers[i]=new Worker(*this,i);
+		workers[i]->start();
+	}
+
+	for (int i=0; i<nb; i++) {
+		workers[i]->join();
+		delete workers[i];
+	}
+	delete[] workers;
+
+	this->boxes=NULL;
+	this->results=NULL;
+
+	return results;
+}
+
+} // end namespace ibex
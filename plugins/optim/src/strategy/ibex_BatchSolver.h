@@ -0,0 +1,128 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchSolver.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_SOLVER_H__
+#define __IBEX_BATCH_SOLVER_H__
+
+#include "ibex_DefaultSolver.h"
+#include "ibex_System.h"
+#include "ibex_Array.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Solve many instances of the same system.
+ *
+ * An instance is given by an initial box. Parametric systems are handled by
+ * representing the parameters as variables: the initial box then fixes the
+ * values (or the domains) of the parameters.
+ *
+ * The system is copied and a #ibex::DefaultSolver is built on each copy
+ * once for all, when the batch solver is created. The instances are then
+ * solved by a pool of threads, each thread having its own solver (so that
+ * no mutable data is shared between threads). Each thread takes the next
+ * pending instance from a shared queue until the queue is empty.
+ *
+ * Each thread has its own random generator (see #ibex::Thread), reseeded
+ * before each instance: the result of an instance does not depend on the
+ * thread that solves it.
+ *
+ * The solvers print nothing, not even when a limit is reached (see
+ * #ibex::Solver::trace): the outcome of each instance is given by its result.
+ */
+class BatchSolver {
+public:
+
+	/**
+	 * \brief Result of an instance.
+	 */
+	class Result {
+	public:
+		/** The solutions. */
+		std::vector<IntervalVector> sols;
+
+		/** Number of cells created by the solver. */
+		int nb_cells;
+
+		/** CPU time spent on the instance (by its thread). */
+		double time;
+
+		/** False if the search has been interrupted (time or cell limit, or error). */
+		bool complete;
+
+		/**
+		 * True if the solver has raised an exception (other than a time or
+		 * cell limit, which are handled by the solver), whatever its type.
+		 * The instance is then not solved.
+		 */
+		bool error;
+	};
+
+	/**
+	 * \brief Create a batch solver.
+	 *
+	 * \param sys        - the system (not modified, and not used by the threads).
+	 * \param prec       - precision of the solvers (see #ibex::DefaultSolver).
+	 * \param nb_threads - number of threads. By default (-1), the number of processors.
+	 */
+	BatchSolver(const System& sys, double prec, int nb_threads=-1);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~BatchSolver();
+
+	/**
+	 * \brief Solve all the instances.
+	 *
+	 * \return the results: the ith result corresponds to the ith box.
+	 */
+	std::vector<Result> solve(const std::vector<IntervalVector>& boxes);
+
+	/** Number of threads. */
+	const int nb_threads;
+
+	/** Maximum CPU time spent on one instance. By default, it is -1 (no limit). */
+	double time_limit;
+
+	/** Maximum number of cells created for one instance. By default, it is -1 (no limit). */
+	long cell_limit;
+
+protected:
+	class Worker;
+	friend class Worker;
+
+	/* The copies of the system (one for each thread) */
+	Array<System> sys;
+
+	/* The solvers (one for each thread) */
+	Array<DefaultSolver> solvers;
+
+	/* The instances of the current call to solve() */
+	const std::vector<IntervalVector>* boxes;
+
+	/* The results of the current call to solve() */
+	std::vector<Result>* results;
+
+	/* Index of the next pending instance */
+	volatile int next;
+
+private:
+	BatchSolver(const BatchSolver&);            // forbidden
+	BatchSolver& operator=(const BatchSolver&); // forbidden
+};
+
+} // end namespace ibex
+#endif // __IBEX_BATCH_SOLVER_H__
@@ -0,0 +1,101 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDoubleHeap.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CellDoubleHeap.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+void CellDoubleHeap::set_memory_limit(size_t memory_limit, const char* filename) {
+	assert(empty());
+	assert(!cost1().depends_on_loup);
+
+	if (overflow) {
+		delete overflow;
+		overflow=NULL;
+	}
+	this->memory_limit=memory_limit;
+	max_cells=0;
+
+	// the overflow buffer keeps (almost) nothing in memory
+	if (memory_limit>0) overflow=new CellHybridBuffer(cost1(),0,filename);
+}
+
+void CellDoubleHeap::push(Cell* cell) {
+	DoubleHeap<Cell>::push(cell);
+
+	if (memory_limit>0) {
+		if (max_cells==0) init_limit(*cell);
+		if (nb_nodes>max_cells) spill();
+	}
+}
+
+double CellDoubleHeap::minimum() const {
+	if (nb_spilled()==0) return DoubleHeap<Cell>::minimum();
+	else if (DoubleHeap<Cell>::empty()) return overflow->minimum();
+	else return std::min(DoubleHeap<Cell>::minimum(), overflow->minimum());
+}
+
+void CellDoubleHeap::visit(CellVisitor& v) const {
+	for (unsigned int i=0; i<nb_nodes; i++)
+		v.visit(*get1(i));
+
+	if (nb_spilled()>0) overflow->visit(v);
+}
+
+void CellDoubleHeap::init_limit(const Cell& c) {
+	size_t bytes=CellHybridBuffer::memory(c)+sizeof(HeapElt<Cell>)+2*sizeof(HeapNode<Cell>);
+
+	max_cells=memory_limit/bytes;
+	if (max_cells<4) max_cells=4;
+}
+
+void CellDoubleHeap::spill() {
+	// the selected heap is not changed
+	int heap_id=current_heap_id;
+
+	// cells sorted by increasing cost
+	vector<Cell*> cells;
+	while (!DoubleHeap<Cell>::empty())
+		cells.push_back(DoubleHeap<Cell>::pop1());
+
+	// a quarter of the cells is spilled at once
+	unsigned int target=max_cells-max_cells/4;
+
+	for (unsigned int i=0; i<cells.size(); i++) {
+		if (i<target) DoubleHeap<Cell>::push(cells[i]);
+		else overflow->push(cells[i]);
+	}
+
+	current_heap_id=heap_id;
+}
+
+void CellDoubleHeap::page_in() const {
+	if (nb_spilled()==0) return;
+
+	if (!DoubleHeap<Cell>::empty() && DoubleHeap<Cell>::minimum()<=overflow->minimum()) return;
+
+	CellDoubleHeap& heap=const_cast<CellDoubleHeap&>(*this);
+	int heap_id=current_heap_id;
+
+	// read a quarter of the cells at once, best cells first
+	unsigned int batch=max_cells/4;
+
+	do {
+		heap.DoubleHeap<Cell>::push(overflow->pop());
+	} while (nb_spilled()>0 && --batch>0 && nb_nodes<max_cells);
+
+	current_heap_id=heap_id;
+}
+
+} // namespace ibex
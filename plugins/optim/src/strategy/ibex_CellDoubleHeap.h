@@ -13,6 +13,7 @@
 #include "ibex_DoubleHeap.h"
 #include "ibex_CellCostFunc.h"
 #include "ibex_CellBuffer.h"
+#include "ibex_CellHybridBuffer.h"
 
 namespace ibex {
 
@@ -21,6 +22,8 @@ namespace ibex {
  *
  * See "A new multi-selection technique in interval methods for global optimization", L.G. Casado, Computing, 2000
  * (TODO: check ref)
+ *
+ * The memory used by the cells can be bounded (see #set_memory_limit(size_t, const char*)).
  */
 class CellDoubleHeap : public DoubleHeap<Cell>, public CellBuffer {
 
@@ -39,6 +42,29 @@ public:
 	 */
 	CellDoubleHeap(CellCostFunc& cost1, CellCostFunc& cost2, int critpr=50);
 
+	/**
+	 * \brief Delete *this.
+	 */
+	~CellDoubleHeap();
+
+	/**
+	 * \brief Bound the memory used by the cells.
+	 *
+	 * When the cells in the heaps exceed \a memory_limit bytes, a quarter of them,
+	 * those with the highest cost of the first heap, are moved into a #ibex::CellHybridBuffer,
+	 * i.e., written into a memory-mapped file (see this class for the data that must
+	 * be saved). They are moved back as soon as one of them has the lowest cost of the
+	 * first heap. Cells that are moved out are not selected with the second criterion.
+	 *
+	 * The memory used by a cell is estimated once, with the next pushed cell.
+	 *
+	 * \param memory_limit - maximal number of bytes used by the cells in the heaps.
+	 * \param filename     - the spill file (see #ibex::CellHybridBuffer).
+	 *
+	 * \pre The buffer is empty and the cost of the first heap does not depend on the loup.
+	 */
+	void set_memory_limit(size_t memory_limit, const char* filename=NULL);
+
 	/**
 	 * \brief Flush the buffer.
 	 *
@@ -58,9 +84,39 @@ public:
 	/** \brief Pop a cell from the stack and return it.*/
 	Cell* pop();
 
+	/** \brief Pop a cell from the first heap and return it.*/
+	Cell* pop1();
+
+	/** \brief Pop a cell from the second heap and return it.*/
+	Cell* pop2();
+
 	/** \brief Return the next box (but does not pop it).*/
 	Cell* top() const;
 
+	/** \brief Return the next box of the first heap (but does not pop it).*/
+	Cell* top1() const;
+
+	/** \brief Return the next box of the second heap (but does not pop it).*/
+	Cell* top2() const;
+
+	/**
+	 * \brief Visit the cells (the cells of the first heap by levels, then the spilled cells).
+	 */
+	void visit(CellVisitor& v) const;
+
+	/**
+	 * \brief Keep the spilled cells unchanged (see #ibex::CellHybridBuffer::hold(bool)).
+	 */
+	void hold(bool h);
+
+	/**
+	 * \brief Return the minimum (the criterion for the first heap)
+	 */
+	double minimum() const;
+
+	/** \brief Number of cells moved out of the heaps (see #set_memory_limit(size_t, const char*)). */
+	unsigned int nb_spilled() const;
+
 
 	std::ostream& print(std::ostream& os) const;
 
@@ -83,29 +139,70 @@ public:
 	 * \brief Cost function of the second heap
 	 */
 	CellCostFunc& cost2();
+
+private:
+	/* Move the cells with the highest cost (first heap) into the overflow buffer */
+	void spill();
+
+	/* Estimate the maximal number of cells in the heaps (from a cell) */
+	void init_limit(const Cell& c);
+
+	/* Move the best cells of the overflow buffer back into the heaps, if one of them is the best cell */
+	void page_in() const;
+
+	/* Maximal number of bytes used by the cells in the heaps (0 means no limit) */
+	size_t memory_limit;
+
+	/* Maximal number of cells in the heaps (0 if not calculated yet) */
+	unsigned int max_cells;
+
+	/* The cells moved out of the heaps (NULL if no limit) */
+	CellHybridBuffer* overflow;
 };
 
 /*================================== inline implementations ========================================*/
 
 inline CellDoubleHeap::CellDoubleHeap(CellCostFunc& cost1, CellCostFunc& cost2, int critpr) :
-		DoubleHeap<Cell>(cost1,cost1.depends_on_loup,cost2,cost2.depends_on_loup, critpr) { }
+		DoubleHeap<Cell>(cost1,cost1.depends_on_loup,cost2,cost2.depends_on_loup, critpr),
+		memory_limit(0), max_cells(0), overflow(NULL) { }
 
-inline void CellDoubleHeap::flush()               { DoubleHeap<Cell>::flush(); }
+inline CellDoubleHeap::~CellDoubleHeap() {
+	if (overflow) delete overflow;
+}
+
+inline void CellDoubleHeap::flush() {
+	DoubleHeap<Cell>::flush();
+	if (overflow) overflow->flush();
+}
+
+inline void CellDoubleHeap::hold(bool h) {
+	if (overflow) overflow->hold(h);
+}
 
-inline unsigned int CellDoubleHeap::size() const  { return DoubleHeap<Cell>::size(); }
+inline unsigned int CellDoubleHeap::size() const  { return DoubleHeap<Cell>::size()+nb_spilled(); }
 
-inline bool CellDoubleHeap::empty() const         { return DoubleHeap<Cell>::empty(); }
+inline bool CellDoubleHeap::empty() const         { return DoubleHeap<Cell>::empty() && nb_spilled()==0; }
 
-inline void CellDoubleHeap::push(Cell* cell)      { DoubleHeap<Cell>::push(cell); }
+inline Cell* CellDoubleHeap::pop()                { page_in(); return DoubleHeap<Cell>::pop(); }
 
-inline Cell* CellDoubleHeap::pop()                { return DoubleHeap<Cell>::pop(); }
+inline Cell* CellDoubleHeap::pop1()               { page_in(); return DoubleHeap<Cell>::pop1(); }
 
-inline Cell* CellDoubleHeap::top() const          { return DoubleHeap<Cell>::top(); }
+inline Cell* CellDoubleHeap::pop2()               { page_in(); return DoubleHeap<Cell>::pop2(); }
+
+inline Cell* CellDoubleHeap::top() const          { page_in(); return DoubleHeap<Cell>::top(); }
+
+inline Cell* CellDoubleHeap::top1() const         { page_in(); return DoubleHeap<Cell>::top1(); }
+
+inline Cell* CellDoubleHeap::top2() const         { page_in(); return DoubleHeap<Cell>::top2(); }
+
+inline unsigned int CellDoubleHeap::nb_spilled() const { return overflow? overflow->size() : 0; }
 
  inline std::ostream& CellDoubleHeap::print(std::ostream& os) const
- {	os << "==============================================================================\n";
+ {	page_in();
+   os << "==============================================================================\n";
    os << " first heap " << " size " << heap1->size() << " top " << heap1->top()->box << std::endl;
      os << " second heap " << " size " << heap2->size() << " top " << heap2->top()->box ;
+     if (nb_spilled()>0) os << std::endl << " spilled " << nb_spilled();
      return  os << std::endl;
  }
 
@@ -122,6 +219,8 @@ inline void CellDoubleHeap::contract(double new_loup) {
 
 	cost2().set_loup(new_loup);
 	DoubleHeap<Cell>::contract(new_loup);
+
+	if (overflow) overflow->contract(new_loup);
 }
 
 inline CellCostFunc& CellDoubleHeap::cost1()      { return (CellCostFunc&) heap1->costf; }
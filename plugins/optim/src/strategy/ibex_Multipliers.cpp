@@ -9,6 +9,7 @@
 
 #include "ibex_Multipliers.h"
 #include <stdlib.h>
+#include <iostream>
 
 namespace ibex {
 
@@ -45,4 +46,22 @@ Multipliers::~Multipliers() {
 
 }
 
+void Multipliers::save(std::ostream& os) const {
+	for (int i=0; i<lambda.size(); i++) {
+		double lb=lambda[i].lb();
+		double ub=lambda[i].ub();
+		os.write((char*) &lb, sizeof(double));
+		os.write((char*) &ub, sizeof(double));
+	}
+}
+
+void Multipliers::load(std::istream& is) {
+	for (int i=0; i<lambda.size(); i++) {
+		double lb,ub;
+		is.read((char*) &lb, sizeof(double));
+		is.read((char*) &ub, sizeof(double));
+		lambda[i]=Interval(lb,ub);
+	}
+}
+
 } // end namespace ibex
@@ -53,6 +53,18 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write the multipliers (binary format).
+	 */
+	void save(std::ostream& os) const;
+
+	/**
+	 * \brief Read the multipliers.
+	 *
+	 * \pre The number of multipliers is set (inherited from the root).
+	 */
+	void load(std::istream& is);
+
 	IntervalVector lambda;
 protected:
 
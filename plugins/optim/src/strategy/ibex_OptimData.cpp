@@ -7,6 +7,7 @@
 //============================================================================
 
 #include "ibex_OptimData.h"
+#include <iostream>
 
 namespace ibex {
 
@@ -26,6 +27,26 @@ OptimData::~OptimData() {
 
 }
 
+void OptimData::save(std::ostream& os) const {
+	bool empty=pf.is_empty();
+	double lb=empty? 0 : pf.lb();
+	double ub=empty? 0 : pf.ub();
+	os.write((char*) &empty, sizeof(bool));
+	os.write((char*) &lb, sizeof(double));
+	os.write((char*) &ub, sizeof(double));
+	os.write((char*) &pu, sizeof(double));
+}
+
+void OptimData::load(std::istream& is) {
+	bool empty;
+	double lb,ub;
+	is.read((char*) &empty, sizeof(bool));
+	is.read((char*) &lb, sizeof(double));
+	is.read((char*) &ub, sizeof(double));
+	is.read((char*) &pu, sizeof(double));
+	pf=empty? Interval::EMPTY_SET : Interval(lb,ub);
+}
+
 void OptimData::compute_pf(Function& goal, const IntervalVector& box) {
 	pf=goal.eval(box);
 }
@@ -38,6 +38,16 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write "pf" and "pu" (binary format).
+	 */
+	void save(std::ostream& os) const;
+
+	/**
+	 * \brief Read "pf" and "pu".
+	 */
+	void load(std::istream& is);
+
 	/**
 	 * \brief Initialize the value of "pf"
 	 *
@@ -15,6 +15,7 @@
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcOptimShaving.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcProfile.h"
 #include "ibex_Random.h"
 
 #include "ibex_ExprCopy.h"
@@ -31,6 +32,13 @@ using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// identifies the optimizer in a checkpoint file
+const int CHECKPOINT_TAG=2;
+
+}
+
 const double Optimizer::default_prec = 1e-07;
 const double Optimizer::default_goal_rel_prec = 1e-07;
 const double Optimizer::default_goal_abs_prec = 1e-07;
@@ -63,11 +71,12 @@ Optimizer::Optimizer(System& user_sys, Ctc& ctc, Bsc& bsc, double prec,
                 				ctc(ctc),bsc(bsc),
                 				buffer(*new CellCostVarLB(n), *CellCostFunc::get_cost(crit2, n), critpr),  // first buffer with LB, second buffer with ct (default UB))
                 				prec(prec), goal_rel_prec(goal_rel_prec), goal_abs_prec(goal_abs_prec),
-                				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true), trace(false),
-                				timeout(1e08),
+                				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true), goal_eval_mode(Function::NATURAL), trace(false),
+                				timeout(1e08), checkpoint_file(NULL), checkpoint_period(600), profile_file(NULL),
                 				loup(POS_INFINITY), pseudo_loup(POS_INFINITY),uplo(NEG_INFINITY),
                 				loup_point(n), loup_box(n), nb_cells(0),
-                				df(*user_sys.goal,Function::DIFF), loup_changed(false),	initial_loup(POS_INFINITY), rigor(rigor),
+                				df(*user_sys.goal,Function::DIFF), loup_changed(false),	initial_loup(POS_INFINITY),
+                				search_box(n), last_checkpoint(0), rigor(rigor),
                 				uplo_of_epsboxes(POS_INFINITY) {
 
 	// ==== build the system of equalities only ====
@@ -92,6 +101,7 @@ Optimizer::Optimizer(System& user_sys, Ctc& ctc, Bsc& bsc, double prec,
 	//====================================
 #ifdef _IBEX_WITH_NOLP_
 	mylp = NULL;
+	lr = NULL;
 #else
 	//lr = new LinearRelaxCombo(sys, LinearRelaxCombo::XNEWTON);
 	//mylp = new LinearSolver(sys.nb_var,sys.nb_ctr,niter);
@@ -320,6 +330,15 @@ void Optimizer::contract_and_bound(Cell& c, const IntervalVector& init_box) {
 	IntervalVector tmp_box(n);
 	read_ext_box(c.box,tmp_box);
 
+	/*=================== bound y with the goal function =================*/
+	if (goal_eval_mode!=Function::NATURAL) {
+		y &= sys.goal->eval(tmp_box,goal_eval_mode);
+		if (y.is_empty()) {
+			c.box.set_empty();
+			return;
+		}
+	}
+
 	entailed = &c.get<EntailedCtr>();
 	if (!update_entailed_ctr(tmp_box)) {
 		c.box.set_empty();
@@ -389,7 +408,29 @@ void Optimizer::firstorder_contract(IntervalVector& box, const IntervalVector& i
 //	}
 }
 
-Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+Cell* Optimizer::root_cell(const IntervalVector& init_box) {
+	Cell* root=pool.new_cell(IntervalVector(n+1));
+
+	write_ext_box(init_box,root->box);
+
+	// add data required by the bisector
+	bsc.add_backtrackable(*root);
+
+	// add data "pu" and "pf" (if required)
+	buffer.cost2().add_backtrackable(*root);
+
+	// add data required by optimizer + Fritz John contractor
+	root->add<EntailedCtr>();
+	//root->add<Multipliers>();
+	entailed=&root->get<EntailedCtr>();
+	entailed->init_root(user_sys,sys);
+
+	return root;
+}
+
+void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
+	// note: the rounding mode is set by the caller (see RoundUpScope)
+
 	loup=obj_init_bound;
 	pseudo_loup=obj_init_bound;
 	buffer.contract(loup);
@@ -405,96 +446,78 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 
 	buffer.flush();
 
-	Cell* root=new Cell(IntervalVector(n+1));
+	// give the memory of the previous search back
+	pool.release();
 
-	write_ext_box(init_box,root->box);
-
-	// add data required by the bisector
-	bsc.add_backtrackable(*root);
-
-	// add data "pu" and "pf" (if required)
-	buffer.cost2().add_backtrackable(*root);
-
-	// add data required by optimizer + Fritz John contractor
-	root->add<EntailedCtr>();
-	//root->add<Multipliers>();
-	entailed=&root->get<EntailedCtr>();
-	entailed->init_root(user_sys,sys);
+	Cell* root=root_cell(init_box);
 
 	loup_changed=false;
 	initial_loup=obj_init_bound;
 	loup_point=init_box.mid();
-	time=0;
-	Timer::start();
+	search_box=init_box;
+	last_checkpoint=time;
+
 	handle_cell(*root,init_box);
 
 	update_uplo();
+}
 
-	try {
-		while (!buffer.empty()) {
-		  //			if (trace >= 2) cout << " buffer " << buffer << endl;
-		  if (trace >= 2) buffer.print(cout);
-			//		  cout << "buffer size "  << buffer.size() << " " << buffer2.size() << endl;
-
-			loup_changed=false;
-
-			Cell *c = buffer.top();
+bool Optimizer::next(const IntervalVector& init_box) {
+	//			if (trace >= 2) cout << " buffer " << buffer << endl;
+	if (trace >= 2) buffer.print(cout);
+	//		  cout << "buffer size "  << buffer.size() << " " << buffer2.size() << endl;
 
-			try {
-				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+	loup_changed=false;
 
-				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+	Cell *c = buffer.top();
 
-				buffer.pop();
-				delete c; // deletes the cell.
+	try {
+		pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
 
-				handle_cell(*new_cells.first, init_box);
-				handle_cell(*new_cells.second, init_box);
+		pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
 
-				if (uplo_of_epsboxes == NEG_INFINITY) {
-					cout << " possible infinite minimum " << endl;
-					break;
-				}
-				if (loup_changed) {
-					// In case of a new upper bound (loup_changed == true), all the boxes
-					// with a lower bound greater than (loup - goal_prec) are removed and deleted.
-					// Note: if contraction was before bisection, we could have the problem
-					// that the current cell is removed by contractHeap. See comments in
-					// older version of the code (before revision 284).
+		buffer.pop();
+		delete c; // deletes the cell.
 
-					double ymax=compute_ymax();
+		handle_cell(*new_cells.first, init_box);
+		handle_cell(*new_cells.second, init_box);
 
-					buffer.contract(ymax);
-					//cout << " now buffer is contracted and min=" << buffer.minimum() << endl;
+		if (uplo_of_epsboxes == NEG_INFINITY) {
+			cout << " possible infinite minimum " << endl;
+			return false;
+		}
+		if (loup_changed) {
+			// In case of a new upper bound (loup_changed == true), all the boxes
+			// with a lower bound greater than (loup - goal_prec) are removed and deleted.
+			// Note: if contraction was before bisection, we could have the problem
+			// that the current cell is removed by contractHeap. See comments in
+			// older version of the code (before revision 284).
 
+			double ymax=compute_ymax();
 
-					if (ymax <= NEG_INFINITY) {
-						if (trace) cout << " infinite value for the minimum " << endl;
-						break;
-					}
-					if (trace) cout << setprecision(12) << "ymax=" << ymax << " uplo= " <<  uplo<< endl;
-				}
-				update_uplo();
-				time_limit_check();
+			buffer.contract(ymax);
+			//cout << " now buffer is contracted and min=" << buffer.minimum() << endl;
 
-			}
-			catch (NoBisectableVariableException& ) {
-				update_uplo_of_epsboxes((c->box)[ext_sys.goal_var()].lb());
-				buffer.pop();
-				delete c; // deletes the cell.
-				//if (trace>=1) cout << "epsilon-box found: uplo cannot exceed " << uplo_of_epsboxes << endl;
-				update_uplo(); // the heap has changed -> recalculate the uplo
 
+			if (ymax <= NEG_INFINITY) {
+				if (trace) cout << " infinite value for the minimum " << endl;
+				return false;
 			}
+			if (trace) cout << setprecision(12) << "ymax=" << ymax << " uplo= " <<  uplo<< endl;
 		}
+		update_uplo();
 	}
-	catch (TimeOutException& ) {
-		return TIME_OUT;
+	catch (NoBisectableVariableException& ) {
+		update_uplo_of_epsboxes((c->box)[ext_sys.goal_var()].lb());
+		buffer.pop();
+		delete c; // deletes the cell.
+		//if (trace>=1) cout << "epsilon-box found: uplo cannot exceed " << uplo_of_epsboxes << endl;
+		update_uplo(); // the heap has changed -> recalculate the uplo
 	}
+	return true;
+}
 
-	Timer::stop();
-	time+= Timer::VIRTUAL_TIMELAPSE();
-
+Optimizer::Status Optimizer::status() const {
 	if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && goal_abs_prec==0 && goal_rel_prec==0)))
 		return INFEASIBLE;
 	else if (loup==initial_loup)
@@ -505,6 +528,138 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 		return SUCCESS;
 }
 
+Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+	// the rounding mode assumed by the interval arithmetic
+	RoundUpScope round_up;
+
+	time=0;
+	timer.start();
+
+	start(init_box, obj_init_bound);
+
+	return run(init_box);
+}
+
+Optimizer::Status Optimizer::run(const IntervalVector& init_box) {
+	Status s=TIME_OUT;
+	try {
+		while (!buffer.empty()) {
+			if (!next(init_box)) break;
+			time_limit_check();
+			checkpoint();
+		}
+
+		timer.stop();
+		time+= timer.get_time();
+
+		s=status();
+	}
+	catch (TimeOutException& ) {
+		timer.stop();
+		time+= timer.get_time();
+	}
+
+	background.wait();
+
+	if (profile_file) CtcProfile::report(profile_file);
+
+	return s;
+}
+
+void Optimizer::checkpoint() {
+	if (!checkpoint_file) return;
+
+	// the next checkpoint is delayed until the previous one is written
+	if (!background.busy() && time+timer.last_time()>=last_checkpoint+checkpoint_period) {
+		// add the time elapsed so far
+		timer.stop();
+		time+=timer.get_time();
+		timer.start();
+		if (background.begin(buffer)) {
+			try {
+				save(checkpoint_file);
+			} catch (...) {
+				// the child process exits here
+				background.end(false);
+				throw;
+			}
+			background.end(true);
+		}
+		last_checkpoint=time;
+	}
+}
+
+void Optimizer::save(const char* filename) {
+	// the background checkpoint writes the same temporary file
+	background.wait();
+
+	CheckpointWriter ck(filename, CHECKPOINT_TAG);
+	ck.write(n);
+	ck.write(search_box);
+	ck.write(loup);
+	ck.write(pseudo_loup);
+	ck.write(uplo);
+	ck.write(uplo_of_epsboxes);
+	ck.write(initial_loup);
+	ck.write(loup_point);
+	ck.write(loup_box);
+	ck.write(nb_cells);
+	ck.write(time);
+	ck.write(buffer);
+	ck.close();
+}
+
+Optimizer::Status Optimizer::resume(const char* filename) {
+	// the rounding mode assumed by the interval arithmetic
+	RoundUpScope round_up;
+
+	CheckpointReader ck(filename, CHECKPOINT_TAG);
+	if (ck.read_int()!=n) throw CheckpointException();
+	IntervalVector init_box=ck.read_box();
+	if (init_box.size()!=n) throw CheckpointException();
+
+	loup=ck.read_double();
+	pseudo_loup=ck.read_double();
+	uplo=ck.read_double();
+	uplo_of_epsboxes=ck.read_double();
+	initial_loup=ck.read_double();
+	loup_point=ck.read_vector();
+	loup_box=ck.read_box();
+	nb_cells=ck.read_int();
+	time=ck.read_double();
+
+	nb_simplex=0;
+	diam_simplex=0;
+	nb_rand=0;
+	diam_rand=0;
+	loup_changed=false;
+
+	buffer.flush();
+	// the costs of the buffer depend on the loup
+	buffer.contract(loup);
+
+	// give the memory of the previous search back
+	pool.release();
+
+	Cell* root=root_cell(init_box);
+	try {
+		ck.read(buffer, *root);
+	} catch (CheckpointException&) {
+		delete root;
+		buffer.flush();
+		throw;
+	}
+	delete root;
+	entailed=NULL; // set with the next cell
+
+	search_box=init_box;
+	last_checkpoint=time;
+
+	timer.start();
+
+	return run(init_box);
+}
+
 void Optimizer::update_uplo_of_epsboxes(double ymin) {
 
 	// the current box cannot be bisected.  ymin is a lower bound of the objective on this box
@@ -565,6 +720,8 @@ void Optimizer::report() {
 		cout << " cpu time used " << time << "s." << endl;
 		cout << " number of cells " << nb_cells << endl;
 	}
+	if (trace)
+		cout << " allocations avoided by the cell pool " << pool.nb_avoided() << endl;
 	/*   // statistics on upper bounding
     if (trace) {
       cout << " nbrand " << nb_rand << " nb_inhc4 " << nb_inhc4 << " nb simplex " << nb_simplex << endl;
@@ -603,10 +760,8 @@ void Optimizer::report_perf() {
 }
 
 void Optimizer::time_limit_check () {
-	Timer::stop();
-	time += Timer::VIRTUAL_TIMELAPSE();
-	if (timeout >0 &&  time >=timeout ) throw TimeOutException();
-	Timer::start();
+	// note: the clock is also read for the checkpoints
+	timer.check(timeout>0? timeout-time : POS_INFINITY);
 }
 
 } // end namespace ibex
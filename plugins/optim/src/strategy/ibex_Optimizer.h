@@ -18,6 +18,9 @@
 #include "ibex_Backtrackable.h"
 #include "ibex_CellCostFunc.h"
 #include "ibex_CellDoubleHeap.h"
+#include "ibex_CellPool.h"
+#include "ibex_Checkpoint.h"
+#include "ibex_Timer.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_ExtendedSystem.h"
 #include "ibex_EntailedCtr.h"
@@ -109,6 +112,29 @@ public:
 	 */
 	Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Save the current state of the optimization.
+	 *
+	 * The cells of the buffer (with their data), the bounds of the objective,
+	 * the loup point, #nb_cells and #time are written into a file (see #ibex::CheckpointWriter).
+	 * Typically called after #optimize(const IntervalVector&, double) has returned TIME_OUT.
+	 *
+	 * \throw CheckpointException if the file cannot be written.
+	 */
+	void save(const char* filename);
+
+	/**
+	 * \brief Resume an optimization saved by #save(const char*).
+	 *
+	 * Same as #optimize(const IntervalVector&, double) except that the search starts
+	 * from the saved state. The optimizer must be built with the same system,
+	 * contractor, bisector and parameters as the one that saved the optimization.
+	 * The time limit includes the time spent before the checkpoint.
+	 *
+	 * \throw CheckpointException if the file cannot be read.
+	 */
+	Status resume(const char* filename);
+
 	/**
 	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&).
 	 *
@@ -192,10 +218,18 @@ public:
 	/** Bisector. */
 	Bsc& bsc;
 
+	/**
+	 * \brief Memory pool of the cells.
+	 *
+	 * (declared before the buffer, for being deleted after it)
+	 */
+	CellPool pool;
+
 	/** Cell buffers.
 	Two buffers are used for node selection. the first one corresponds to minimize  the minimum of the objective estimate,
 	the second one to minimize another criterion (by default the maximum of the objective estimate).
 	The second one is chosen at each node with a probability critpr/100 (default value critpr=50)
+	For large runs, the memory used by the cells can be bounded, see #ibex::CellDoubleHeap::set_memory_limit(size_t, const char*).
 	 */
 	CellDoubleHeap buffer;
 
@@ -225,6 +259,15 @@ public:
 	 * The value can be fixed by the user. By default: true. */
 	bool in_HC4_flag;
 
+	/** Evaluation mode of the goal function.
+	 * If not NATURAL, the domain of the goal variable y is intersected
+	 * in each cell with the image of the box by the goal function, calculated
+	 * with a centered form (see #ibex::Function::eval_mode). This improves the
+	 * lower bound of the objective on small boxes (at the price of a gradient
+	 * calculation per cell).
+	 * The value can be fixed by the user. By default: NATURAL (no bounding). */
+	Function::eval_mode goal_eval_mode;
+
 	/** Trace activation flag.
 	 * The value can be fixed by the user. By default: 0  nothing is printed
 	 1 for printing each better found feasible point
@@ -243,6 +286,37 @@ public:
 	/* Remember running time of the last exploration */
 	double time;
 
+	/**
+	 * \brief Checkpoint file.
+	 *
+	 * If not NULL, the optimization is periodically saved into this file
+	 * (see #save(const char*)). By default, it is NULL.
+	 *
+	 * The file is written in the background by a child process (see #ibex::BackgroundCheckpoint):
+	 * the optimization is only paused for the fork. It is written synchronously (the
+	 * optimization is stopped during the whole dump) on Windows, if the process cannot
+	 * be forked or while threads are running (fork is not safe then). The optimization waits for the last checkpoint before it ends.
+	 */
+	const char* checkpoint_file;
+
+	/**
+	 * \brief Cpu time between two checkpoints.
+	 *
+	 * A checkpoint is not started before the previous one is written.
+	 *
+	 * By default: 600s.
+	 */
+	double checkpoint_period;
+
+	/**
+	 * \brief Profiling file.
+	 *
+	 * If not NULL, the statistics of the profiled contractors (see #ibex::CtcProfile)
+	 * are written into this file at the end of #optimize(const IntervalVector&, double).
+	 * By default, it is NULL.
+	 */
+	const char* profile_file;
+
 	void time_limit_check();
 
 	/** Default bisection precision: 1e-07 */
@@ -295,6 +369,46 @@ public:
 	int nb_cells;
 
 protected:
+	friend class ParallelOptimizer;
+
+	/**
+	 * \brief Initialize the search.
+	 *
+	 * Reset the bounds, create the root cell and handle it (see #handle_cell).
+	 */
+	void start(const IntervalVector& init_box, double obj_init_bound);
+
+	/**
+	 * \brief Process the cell at the top of the buffer.
+	 *
+	 * The cell is bisected and the two subcells are handled (see #handle_cell).
+	 * The buffer is contracted in case of a new loup and the uplo is updated.
+	 *
+	 * \pre The buffer is not empty.
+	 * \return false if the search must be stopped (unbounded objective).
+	 */
+	bool next(const IntervalVector& init_box);
+
+	/**
+	 * \brief Process cells until the buffer is empty (or time is out).
+	 */
+	Status run(const IntervalVector& init_box);
+
+	/**
+	 * \brief Create the root cell with all the required data.
+	 */
+	Cell* root_cell(const IntervalVector& init_box);
+
+	/**
+	 * \brief Save the optimization into the checkpoint file, if the period has elapsed.
+	 */
+	void checkpoint();
+
+	/**
+	 * \brief Status of the last search (assuming it is not a timeout).
+	 */
+	Status status() const;
+
 	/**
 	 * \brief Return an upper bound of f(x).
 	 *
@@ -528,6 +642,26 @@ protected:
 	 */
 	double initial_loup;
 
+	/**
+	 * \brief The initial box of the last optimization.
+	 */
+	IntervalVector search_box;
+
+	/**
+	 * \brief Time of the last checkpoint.
+	 */
+	double last_checkpoint;
+
+	/**
+	 * \brief Writes the checkpoints.
+	 */
+	BackgroundCheckpoint background;
+
+	/**
+	 * \brief Time of the current call to optimize() or resume().
+	 */
+	Timer timer;
+
 	Ctc3BCid* objshaver;
 	
 private:
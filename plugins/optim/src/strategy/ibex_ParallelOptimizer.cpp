@@ -0,0 +1,333 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_Timer.h"
+
+#include <unistd.h>
+#include <iomanip>
+
+using namespace std;
+
+namespace ibex {
+
+class ParallelOptimizer::Worker : public Thread {
+public:
+	Worker(ParallelOptimizer& po, int num, const IntervalVector& init_box) :
+		Thread(num+1), po(po), num(num), o(po.opt[num]), init_box(init_box) { }
+
+protected:
+	void run();
+
+	/* Push a cell given by another worker */
+	void receive(Cell* c);
+
+	ParallelOptimizer& po;
+	const int num;
+	Optimizer& o;
+	const IntervalVector& init_box;
+};
+
+void ParallelOptimizer::Worker::run() {
+	// the rounding mode is a per-thread setting
+	RoundUpScope round_up;
+
+	try {
+		while (!atomic_load(po.stopped)) {
+
+			po.sync_loup(num);
+
+			if (o.buffer.empty()) {
+				Cell* c=po.wait_for_cell(num);
+				if (!c) break;
+				receive(c);
+				continue;
+			}
+
+			if (!o.next(init_box)) {
+				atomic_store(po.unbounded,true);
+				atomic_store(po.stopped,true);
+				break;
+			}
+
+			po.publish_loup(num);
+
+			po.share(num);
+		}
+	} catch (...) {
+		// the exception is rethrown by optimize(), once all the workers are stopped
+		po.error.capture();
+		atomic_store(po.stopped,true);
+	}
+	atomic_add(po.nb_finished,1);
+}
+
+void ParallelOptimizer::Worker::receive(Cell* c) {
+	// the uplo is recalculated from the new buffer
+	o.uplo=NEG_INFINITY;
+
+	double ymax = o.loup==POS_INFINITY ? POS_INFINITY : o.compute_ymax();
+
+	if (c->box[o.ext_sys.goal_var()].lb() > ymax)
+		delete c; // the cell has become useless with the shared loup
+	else
+		o.buffer.push(c);
+
+	o.update_uplo();
+}
+
+ParallelOptimizer::ParallelOptimizer(const Array<Optimizer>& opt) : opt(opt), nb_threads(opt.size()),
+		timeout(1e08), loup(POS_INFINITY), uplo(NEG_INFINITY), loup_point(opt[0].n), nb_cells(0),
+		nb_transfers(0), time(0), workers(NULL), nb_idle(0), nb_finished(0), stopped(false),
+		unbounded(false), loup_found(false), status(Optimizer::SUCCESS) {
+
+	assert(nb_threads>0);
+
+	hungry = new int[nb_threads];
+	mailbox = new Cell*[nb_threads];
+	for (int i=0; i<nb_threads; i++) {
+		hungry[i]=0;
+		mailbox[i]=NULL;
+		// cells are transferred between workers and
+		// a pool is not thread-safe
+		this->opt[i].pool.enabled=false;
+	}
+}
+
+ParallelOptimizer::~ParallelOptimizer() {
+	delete[] hungry;
+	delete[] mailbox;
+}
+
+void ParallelOptimizer::publish_loup(int i) {
+	Optimizer& o=opt[i];
+
+	// the lock is only taken if the loup is improved
+	// (the atomic read is just a hint, checked again under the lock)
+	if (!(o.loup < atomic_load(loup))) return;
+
+	Lock l(loup_mutex);
+	if (o.loup < loup) {
+		atomic_store(loup, o.loup);
+		loup_point = o.loup_point;
+		loup_found = true;
+	}
+}
+
+void ParallelOptimizer::sync_loup(int i) {
+	Optimizer& o=opt[i];
+
+	// the lock is only taken if the worker is not up to date
+	if (!(atomic_load(loup) < o.loup)) return;
+
+	{
+		Lock l(loup_mutex);
+		o.loup = loup;
+		o.loup_point = loup_point;
+	}
+	if (o.pseudo_loup > o.loup) o.pseudo_loup = o.loup;
+
+	// prune the buffer right away
+	o.buffer.contract(o.compute_ymax());
+}
+
+void ParallelOptimizer::share(int i) {
+	if (atomic_load(nb_idle)==0) return;
+
+	Optimizer& o=opt[i];
+
+	for (int j=0; j<nb_threads && o.buffer.size()>1; j++) {
+		if (j!=i && atomic_load(hungry[j]) && atomic_cas(hungry[j],1,0)) {
+			// note: the idle counter is decremented on behalf of the
+			// receiver, before this worker can become idle itself.
+			atomic_add(nb_idle,-1);
+			Cell* c=o.buffer.pop1(); // the cell with the lowest lower bound
+			// the barrier of atomic_store publishes the cell
+			// before its address (see wait_for_cell)
+			atomic_store(mailbox[j],c);
+			atomic_add(nb_transfers,1);
+		}
+	}
+}
+
+Cell* ParallelOptimizer::wait_for_cell(int i) {
+	atomic_store(mailbox[i],(Cell*) NULL);
+	atomic_store(hungry[i],1);
+	atomic_add(nb_idle,1);
+
+	while (true) {
+		// the barrier of atomic_load orders the read of the
+		// address before the reads of the cell (see share)
+		Cell* c=atomic_load(mailbox[i]);
+		if (c) {
+			atomic_store(mailbox[i],(Cell*) NULL);
+			return c;
+		}
+		if (atomic_load(nb_idle)==nb_threads || atomic_load(stopped)) {
+			// all the workers are idle: the search is over.
+			if (atomic_cas(hungry[i],1,0))
+				return NULL;
+			// else: a worker has just given a cell (wait for it)
+		}
+		Thread::yield();
+	}
+}
+
+double ParallelOptimizer::compute_uplo() {
+	double lb=POS_INFINITY;
+	bool all_empty=true;
+
+	for (int i=0; i<nb_threads; i++) {
+		Optimizer& o=opt[i];
+		if (!o.buffer.empty()) {
+			all_empty=false;
+			if (o.buffer.minimum()<lb) lb=o.buffer.minimum();
+		}
+		if (o.uplo_of_epsboxes<lb) lb=o.uplo_of_epsboxes;
+	}
+
+	if (all_empty && loup!=POS_INFINITY) {
+		// as in Optimizer::update_uplo
+		double ymax=opt[0].compute_ymax();
+		if (ymax<lb) lb=ymax;
+	}
+	return lb;
+}
+
+Optimizer::Status ParallelOptimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+	// the rounding mode assumed by the interval arithmetic
+	RoundUpScope round_up;
+
+	atomic_store(loup,obj_init_bound);
+	loup_point=init_box.mid();
+	loup_found=false;
+	atomic_store(nb_idle,0);
+	atomic_store(nb_finished,0);
+	nb_transfers=0;
+	atomic_store(stopped,false);
+	atomic_store(unbounded,false);
+	time=0;
+
+	Timer timer(Timer::__REAL);
+	timer.start();
+
+	// the first worker handles the root cell
+	opt[0].start(init_box, obj_init_bound);
+
+	// the other workers start with an empty buffer
+	for (int i=1; i<nb_threads; i++) {
+		Optimizer& o=opt[i];
+		o.buffer.flush();
+		o.loup=obj_init_bound;
+		o.pseudo_loup=obj_init_bound;
+		o.initial_loup=obj_init_bound;
+		o.uplo=NEG_INFINITY;
+		o.uplo_of_epsboxes=POS_INFINITY;
+		o.loup_point=init_box.mid();
+		o.nb_cells=0;
+		o.loup_changed=false;
+	}
+
+	publish_loup(0);
+
+	workers = new Worker*[nb_threads];
+	for (int i=0; i<nb_threads; i++) {
+		atomic_store(hungry[i],0);
+		atomic_store(mailbox[i],(Cell*) NULL);
+		workers[i] = new Worker(*this,i,init_box);
+		workers[i]->start();
+	}
+
+	bool timeout_reached=false;
+
+	// The main thread acts as a watchdog for the time limit.
+	while (atomic_load(nb_finished)<nb_threads) {
+		usleep(1000);
+		if (!atomic_load(stopped) && timeout>0 && timer.get_time()>=timeout) {
+			timeout_reached=true;
+			atomic_store(stopped,true);
+		}
+	}
+
+	for (int i=0; i<nb_threads; i++) {
+		workers[i]->join();
+		delete workers[i];
+	}
+	delete[] workers;
+	workers=NULL;
+
+	timer.stop();
+	time=timer.get_time();
+
+	for (int i=0; i<nb_threads; i++) {
+		// cells given to a worker that has already stopped
+		Cell* c=atomic_load(mailbox[i]);
+		if (c) {
+			opt[i].buffer.push(c);
+			atomic_store(mailbox[i],(Cell*) NULL);
+		}
+		// all the workers get the final loup
+		sync_loup(i);
+	}
+
+	uplo=compute_uplo();
+	if (uplo>loup) uplo=loup;
+
+	double uplo_of_epsboxes=POS_INFINITY;
+	nb_cells=0;
+	for (int i=0; i<nb_threads; i++) {
+		nb_cells+=opt[i].nb_cells;
+		if (opt[i].uplo_of_epsboxes<uplo_of_epsboxes) uplo_of_epsboxes=opt[i].uplo_of_epsboxes;
+		opt[i].buffer.flush();
+	}
+
+	// an exception raised by a worker
+	error.rethrow();
+
+	// see Optimizer::status()
+	const Optimizer& o=opt[0];
+	if (timeout_reached)
+		status=Optimizer::TIME_OUT;
+	else if (atomic_load(unbounded) || uplo_of_epsboxes == NEG_INFINITY)
+		status=Optimizer::UNBOUNDED_OBJ;
+	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==obj_init_bound && o.goal_abs_prec==0 && o.goal_rel_prec==0)))
+		status=Optimizer::INFEASIBLE;
+	else if (loup==obj_init_bound)
+		status=Optimizer::NO_FEASIBLE_FOUND;
+	else
+		status=Optimizer::SUCCESS;
+
+	return status;
+}
+
+void ParallelOptimizer::report() {
+
+	switch(status) {
+	case Optimizer::TIME_OUT:      cout << "time limit " << timeout << "s. reached " << endl; break;
+	case Optimizer::INFEASIBLE:    cout << " infeasible problem " << endl; break;
+	case Optimizer::UNBOUNDED_OBJ: cout << " small boxes with negative infinity objective :  objective not bound " << endl; break;
+	default: break;
+	}
+
+	cout << " best bound in: [" << uplo << "," << loup << "]" << endl;
+
+	if (status==Optimizer::SUCCESS || status==Optimizer::TIME_OUT) {
+		if (!loup_found)
+			cout << " no feasible point found " << endl;
+		else
+			cout << " best feasible point " << loup_point << endl;
+	}
+
+	cout << " real time used " << time << "s." << endl;
+	cout << " number of cells " << nb_cells << " (" << nb_threads << " threads, "
+			<< nb_transfers << " transfers)" << endl;
+}
+
+} // end namespace ibex
@@ -0,0 +1,171 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_OPTIMIZER_H__
+#define __IBEX_PARALLEL_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_Array.h"
+#include "ibex_Thread.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded global optimizer.
+ *
+ * Runs the branch & bound algorithm of #ibex::Optimizer with several threads (workers).
+ * Each worker is an #ibex::Optimizer with its own system, contractor, bisector and
+ * double-heap buffer. The optimizers must all be built on (copies of) the same system
+ * with the same parameters and must not share any mutable data.
+ *
+ * <ul>
+ * <li> The loup is shared: a worker that finds a better feasible point publishes its
+ *      value and the point together, under a mutex, and all the other workers contract
+ *      their buffer with it before processing their next cell. The shared value is also
+ *      read atomically without the mutex, but only to know whether the mutex is needed:
+ *      the mutex is taken only when the loup is improved or a worker is out of date.
+ * <li> The buffers are rebalanced: an idle worker (with an empty buffer) is given the cell
+ *      with the lowest lower bound of the objective by the first busy worker that notices
+ *      it is idle.
+ * </ul>
+ *
+ * \note Each worker draws its random numbers (double heap, random probing, etc.)
+ *       from its own generator, seeded with i+1 for the ith worker (see #ibex::Thread).
+ *       The sequence of each worker is reproducible but the cells are transferred between
+ *       workers depending on the scheduling, so two runs may still explore different trees.
+ * \note In rigor mode, the loup box is not shared (each worker keeps its own).
+ * \note The cell pools of the optimizers are disabled (see #ibex::CellPool).
+ */
+class ParallelOptimizer {
+public:
+	/**
+	 * \brief Create a parallel optimizer.
+	 *
+	 * \param opt - the optimizers: opt[i] is run by the ith worker.
+	 */
+	ParallelOptimizer(const Array<Optimizer>& opt);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ParallelOptimizer();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * See #ibex::Optimizer::optimize(const IntervalVector&, double).
+	 * An exception raised by a worker stops the search and is
+	 * rethrown once all the workers are stopped.
+	 */
+	Optimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&, double).
+	 */
+	void report();
+
+	/** The optimizers (one for each worker). */
+	Array<Optimizer> opt;
+
+	/** Number of workers (threads). */
+	const int nb_threads;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Maximum wall-clock time used by the strategy.
+	 * The value can be fixed by the user. By default: 1e08.
+	 */
+	double timeout;
+
+	/** The shared "loup" (lowest upper bound of the criterion).
+	 * It is always updated together with #loup_point, under a mutex. */
+	volatile double loup;
+
+	/** The "uplo" (uppermost lower bound of the criterion), for the last exploration. */
+	double uplo;
+
+	/** The point satisfying the constraints corresponding to the loup */
+	Vector loup_point;
+
+	/** Number of cells put into the heaps (all workers) */
+	int nb_cells;
+
+	/** Number of cells given by a worker to an idle worker. */
+	int nb_transfers;
+
+	/** Running time (wall-clock) of the last exploration */
+	double time;
+
+protected:
+	class Worker;
+	friend class Worker;
+
+	/* Publish the loup of the ith worker if it improves the shared loup.
+	 * The loup and its point are written under loup_mutex. */
+	void publish_loup(int i);
+
+	/* Make the ith worker aware of the shared loup. The loup and its
+	 * point are read under loup_mutex, if the worker is out of date. */
+	void sync_loup(int i);
+
+	/* Give cells of the ith worker to idle workers (if any) */
+	void share(int i);
+
+	/* Wait until the ith worker receives a cell. Return NULL if the search is over. */
+	Cell* wait_for_cell(int i);
+
+	/* Final uplo (once all workers are stopped) */
+	double compute_uplo();
+
+	Worker** workers;
+
+	/* Number of idle workers
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile int nb_idle;
+
+	/* hungry[i]==1 iff the ith worker waits for a cell
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile int* hungry;
+
+	/* mailbox[i] receives the cell given to the ith worker
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	Cell* volatile* mailbox;
+
+	/* Number of workers that have terminated
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile int nb_finished;
+
+	/* Set to true to stop all the workers
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile bool stopped;
+
+	/* True if a worker has detected an unbounded objective
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile bool unbounded;
+
+	/* The first exception raised by a worker */
+	ThreadError error;
+
+	/* Protects loup, loup_point and loup_found. The workers only
+	 * read loup without the lock, to know whether they need the lock. */
+	Mutex loup_mutex;
+
+	/* True if loup_point has been found by a worker */
+	bool loup_found;
+
+	/* Status of the last exploration */
+	Optimizer::Status status;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_OPTIMIZER_H__
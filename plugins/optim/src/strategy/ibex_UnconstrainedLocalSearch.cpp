@@ -44,6 +44,20 @@ void UnconstrainedLocalSearch::update_B_SR1(Matrix& Bk, const Vector& sk, const
 	if ((tmp!=0)&&( fabs((r*r)/tmp)<=1.e8)) Bk += (1/tmp)*outer_product(r,r);
 }
 
+void UnconstrainedLocalSearch::init_B(const Vector& x0, Matrix& Bk) {
+	// the Hessian matrix is only calculated by automatic differentiation
+	// (differentiating symbolically the gradient would be too expensive)
+	if (!Hessian::is_supported(f)) return;
+
+	IntervalMatrix H=f.hessian(x0);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			if (H[i][j].is_empty() || H[i][j].is_unbounded()) return;
+
+	Bk=H.mid();
+}
+
 UnconstrainedLocalSearch::ReturnCode UnconstrainedLocalSearch::minimize(const Vector& x0, Vector& xk, double eps, int max_iter) {
 	// parameter for the stopping criterion
 	this->eps = eps;
@@ -82,6 +96,7 @@ UnconstrainedLocalSearch::ReturnCode UnconstrainedLocalSearch::minimize(const Ve
 		double fk=_mid(f.eval(xk1));
 		Vector gk=_mid(f.gradient(xk1));
 		Matrix Bk=Matrix::eye(n);
+		init_B(xk1,Bk);
 		//  cout << " [minimize] gk= " << gk << endl;
 
 		// initialize the current point
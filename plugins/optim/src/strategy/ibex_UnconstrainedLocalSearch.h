@@ -146,6 +146,14 @@ private:
 	 */
 	void update_B_SR1(Matrix& Bk, const Vector& sk, const Vector& gk, const Vector& gk1);
 
+	/**
+	 * \brief Initialize the approximation Bk of the Hessian
+	 *
+	 * Set Bk to the Hessian matrix of f at x0 if it can be calculated
+	 * (Bk is left unchanged otherwise).
+	 */
+	void init_B(const Vector& x0, Matrix& Bk);
+
 	/*
 	 * \brief Return the midpoint if the interval is not empty,
 	 * throw a InvalidPointException otherwise.
@@ -0,0 +1,102 @@
+/* ============================================================================
+ * I B E X - Batch Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestBatchSolver.h"
+#include "ibex_BatchSolver.h"
+#include "ibex_DefaultSolver.h"
+#include "ibex_SystemFactory.h"
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* x^2+y^2=p, y=x (p is a parameter) */
+System* batch_sys() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	const ExprSymbol& p=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_var(p);
+	f.add_ctr(sqr(x)+sqr(y)=p);
+	f.add_ctr(y=x);
+	return new System(f);
+}
+
+/* Instances: p=2k^2 for k=0..n-1 (solutions: x=y=+/-k) */
+vector<IntervalVector> instances(int n) {
+	vector<IntervalVector> boxes;
+	for (int k=0; k<n; k++) {
+		IntervalVector box(3,Interval(-10,10));
+		box[2]=Interval(2*k*k);
+		boxes.push_back(box);
+	}
+	return boxes;
+}
+
+}
+
+void TestBatchSolver::batch01() {
+	System* sys=batch_sys();
+	vector<IntervalVector> boxes=instances(8);
+
+	BatchSolver batch(*sys,1e-6,3);
+	CPPUNIT_ASSERT(batch.nb_threads==3);
+	vector<BatchSolver::Result> res=batch.solve(boxes);
+	CPPUNIT_ASSERT(res.size()==boxes.size());
+
+	DefaultSolver s(*sys,1e-6);
+	for (unsigned int i=0; i<boxes.size(); i++) {
+		vector<IntervalVector> sols=s.solve(boxes[i]);
+		CPPUNIT_ASSERT(res[i].complete && !res[i].error);
+		CPPUNIT_ASSERT(res[i].sols.size()==sols.size());
+		// the solution x=y=k is found
+		bool found=false;
+		for (unsigned int j=0; j<res[i].sols.size(); j++)
+			if (res[i].sols[j][0].contains(i)) found=true;
+		CPPUNIT_ASSERT(found);
+	}
+
+	// the solver can be reused
+	res=batch.solve(boxes);
+	CPPUNIT_ASSERT(res.size()==boxes.size());
+	CPPUNIT_ASSERT(res[3].complete);
+
+	delete sys;
+}
+
+void TestBatchSolver::batch02() {
+	System* sys=batch_sys();
+	vector<IntervalVector> boxes=instances(4);
+
+	BatchSolver batch(*sys,1e-6,2);
+	batch.cell_limit=2;
+
+	// nothing is printed when the limit is reached
+	ostringstream out;
+	streambuf* buf=cout.rdbuf(out.rdbuf());
+	vector<BatchSolver::Result> res=batch.solve(boxes);
+	cout.rdbuf(buf);
+	CPPUNIT_ASSERT(out.str().empty());
+
+	for (unsigned int i=1; i<boxes.size(); i++) {
+		CPPUNIT_ASSERT(!res[i].complete && !res[i].error);
+		CPPUNIT_ASSERT(res[i].nb_cells<=2);
+	}
+
+	delete sys;
+}
+
+} // namespace ibex
@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Batch Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_BATCH_SOLVER_H__
+#define __TEST_BATCH_SOLVER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestBatchSolver : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestBatchSolver);
+		CPPUNIT_TEST(batch01);
+		CPPUNIT_TEST(batch02);
+	CPPUNIT_TEST_SUITE_END();
+
+	// same solutions as a DefaultSolver, for each instance
+	void batch01();
+	// instances interrupted by the cell limit
+	void batch02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBatchSolver);
+
+} // namespace ibex
+#endif // __TEST_BATCH_SOLVER_H__
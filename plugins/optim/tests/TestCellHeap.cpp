@@ -296,4 +296,102 @@ void TestCellHeap::test_D05() {
 
 
 
+void TestCellHeap::test_D06() {
+
+	int nb=200;
+	CellCostVarLB cost_lb(1);
+	CellCostC5 cost_c5;
+	CellDoubleHeap h1(cost_lb,cost_c5,0);
+	h1.contract(POS_INFINITY);
+	h1.set_memory_limit(4000);
+
+	for (int i=0; i<nb ;i++) {
+		// lower bounds 0,...,nb-1 in a shuffled order
+		int k=(i*37)%nb;
+		IntervalVector box(2);
+		box[0]=Interval(0,1);
+		box[1]=Interval(k,k+1);
+		Cell* cell = new Cell(box);
+		cell->add<OptimData>();
+		cell->get<OptimData>().pu=0.2;
+		cell->get<OptimData>().pf = box[0]*box[1];
+		h1.push(cell);
+	}
+
+	CPPUNIT_ASSERT(h1.nb_spilled()>0);
+	CPPUNIT_ASSERT(h1.size()==(unsigned int) nb);
+	CPPUNIT_ASSERT(h1.minimum()==0);
+
+	h1.contract(nb/2);
+	CPPUNIT_ASSERT(h1.size()==(unsigned int) nb/2+1);
+
+	// the cells come out in the order of the first criterion
+	for (int k=0; k<=nb/2; k++) {
+		Cell* c=h1.top();
+		CPPUNIT_ASSERT(c->box[1].lb()==k);
+		CPPUNIT_ASSERT(c->get<OptimData>().pf==c->box[0]*c->box[1]);
+		delete h1.pop();
+	}
+	CPPUNIT_ASSERT(h1.empty());
+}
+
+namespace {
+
+/* Copy the visited cells into a buffer */
+class CellCopy : public CellVisitor {
+public:
+	CellCopy(CellBuffer& buff) : buff(buff) { }
+	void visit(const Cell& c) {
+		Cell* c2 = new Cell(c.box);
+		c2->add<OptimData>();
+		c2->get<OptimData>().pu=c.get<OptimData>().pu;
+		c2->get<OptimData>().pf=c.get<OptimData>().pf;
+		buff.push(c2);
+	}
+	CellBuffer& buff;
+};
+
+}
+
+void TestCellHeap::test_D07() {
+
+	int nb=200;
+	CellCostVarLB cost_lb(1);
+	CellCostC5 cost_c5;
+	CellDoubleHeap h1(cost_lb,cost_c5,0);
+	h1.contract(POS_INFINITY);
+	h1.set_memory_limit(4000);
+	CellDoubleHeap h2(cost_lb,cost_c5,0);
+	h2.contract(POS_INFINITY);
+
+	for (int i=0; i<nb ;i++) {
+		int k=(i*37)%nb;
+		IntervalVector box(2);
+		box[0]=Interval(0,1);
+		box[1]=Interval(k,k+1);
+		Cell* cell = new Cell(box);
+		cell->add<OptimData>();
+		cell->get<OptimData>().pu=0.2;
+		cell->get<OptimData>().pf = box[0]*box[1];
+		h1.push(cell);
+	}
+	CPPUNIT_ASSERT(h1.nb_spilled()>0);
+
+	CellCopy copy(h2);
+	h1.visit(copy);
+	CPPUNIT_ASSERT(h1.size()==(unsigned int) nb);
+	CPPUNIT_ASSERT(h2.size()==(unsigned int) nb);
+
+	for (int k=0; k<nb; k++) {
+		Cell* c1=h1.pop();
+		Cell* c2=h2.pop();
+		CPPUNIT_ASSERT(c1->box[1].lb()==k);
+		CPPUNIT_ASSERT(c2->box==c1->box);
+		CPPUNIT_ASSERT(c2->get<OptimData>().pf==c1->get<OptimData>().pf);
+		delete c1;
+		delete c2;
+	}
+	CPPUNIT_ASSERT(h1.empty());
+}
+
 } // end namespace
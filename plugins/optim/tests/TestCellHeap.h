@@ -35,6 +35,8 @@ public:
 		CPPUNIT_TEST(test_D03);
 		CPPUNIT_TEST(test_D04);
 		CPPUNIT_TEST(test_D05);
+		CPPUNIT_TEST(test_D06);
+		CPPUNIT_TEST(test_D07);
 	CPPUNIT_TEST_SUITE_END();
 
 
@@ -48,6 +50,10 @@ public:
 	void test_D03();
 	void test_D04();
 	void test_D05();
+	// memory limit
+	void test_D06();
+	// visit the cells (in memory and spilled) without modifying the heap
+	void test_D07();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCellHeap);
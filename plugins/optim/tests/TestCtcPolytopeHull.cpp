@@ -15,6 +15,7 @@
 #include "ibex_System.h"
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxCombo.h"
+#include "ibex_LinearRelaxXTaylor.h"
 #include "ibex_Array.h"
 
 using namespace std;
@@ -65,5 +66,26 @@ void TestCtcPolytopeHull::fixbug01() {
 	check(box,box2);
 }
 
+void TestCtcPolytopeHull::xtaylor_undef() {
+
+	SystemFactory f;
+	Variable x,y;
+	f.add_var(x); f.add_var(y);
+	f.add_ctr(sqrt(x)+y<=0);
+	f.add_ctr(x+sqr(y)<=-1.5);
+	System sys(f);
+
+	double _box[][2] = {{-2,-1},{-1,1}};
+	IntervalVector box(2,_box);
+
+	std::vector<LinearRelaxXTaylor::corner_point> cpoints(1,LinearRelaxXTaylor::INF_X);
+	LinearRelaxXTaylor linear_relax(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+	LinearSolver lp_solver(2,2);
+
+	// the first constraint has no gradient on the box
+	// but the second one must still be linearized
+	CPPUNIT_ASSERT(linear_relax.linearization(box,lp_solver)==1);
+}
+
 
 } // end namespace ibex
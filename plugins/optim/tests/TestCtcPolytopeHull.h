@@ -26,6 +26,7 @@ public:
 
 		CPPUNIT_TEST(lp01);
 		CPPUNIT_TEST(fixbug01);
+		CPPUNIT_TEST(xtaylor_undef);
 
 #endif //_IBEX_WITH_NOLP_
 
@@ -34,6 +35,9 @@ public:
 	void lp01();
 
 	void fixbug01();
+
+	// one constraint is undefined on the box, the other is relaxed
+	void xtaylor_undef();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
@@ -13,6 +13,12 @@
 #include "ibex_Optimizer.h"
 #include "ibex_DefaultOptimizer.h"
 #include "ibex_SystemFactory.h"
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_RoundRobin.h"
+
+#include <cstdio>
+#include <cmath>
+#include <stdexcept>
 
 using namespace std;
 
@@ -49,5 +55,172 @@ void TestOptimizer::issue50_4() {
 	CPPUNIT_ASSERT(issue50(-1e-10, 0)==Optimizer::INFEASIBLE);
 }
 
+namespace {
+
+System* parallel_sys() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+	f.add_var(x);
+	f.add_goal(sqr(x[0]-1)+sqr(x[1]+0.5)*sqr(x[2])+sin(3*x[0])*cos(2*x[1])+0.1*sqr(x[2]));
+	f.add_ctr(sqr(x[0])+sqr(x[1])+sqr(x[2])<=4);
+	f.add_ctr(x[0]+x[1]>=-1);
+	return new System(f);
+}
+
+// Fail on any box but the initial one (x and the goal variable)
+class CtcFail : public Ctc {
+public:
+	CtcFail() : Ctc(2) { }
+
+	void contract(IntervalVector& box) {
+		if (box[0].diam()<4) throw std::runtime_error("bisected box");
+	}
+};
+
+}
+
+void TestOptimizer::parallel01() {
+	IntervalVector init_box(3,Interval(-3,3));
+	double prec=1e-6;
+
+	System* sys=parallel_sys();
+	DefaultOptimizer* o=new DefaultOptimizer(*sys,prec,prec);
+	CPPUNIT_ASSERT(o->optimize(init_box)==Optimizer::SUCCESS);
+
+	System* sys_i[3];
+	DefaultOptimizer* o_i[3];
+	Array<Optimizer> opt(3);
+	for (int i=0; i<3; i++) {
+		sys_i[i]=parallel_sys();
+		o_i[i]=new DefaultOptimizer(*sys_i[i],prec,prec);
+		opt.set_ref(i,*o_i[i]);
+	}
+	ParallelOptimizer* po=new ParallelOptimizer(opt);
+	CPPUNIT_ASSERT(po->optimize(init_box)==Optimizer::SUCCESS);
+
+	// both enclosures of the minimum must intersect
+	CPPUNIT_ASSERT(po->uplo<=o->loup);
+	CPPUNIT_ASSERT(o->uplo<=po->loup);
+	CPPUNIT_ASSERT(po->loup-po->uplo<=1e-5);
+	// the loup point is the one of the loup
+	CPPUNIT_ASSERT(std::fabs(sys->goal->eval(IntervalVector(po->loup_point)).ub()-po->loup)<=1e-10);
+
+	delete po;
+	for (int i=0; i<3; i++) {
+		delete o_i[i];
+		delete sys_i[i];
+	}
+	delete o;
+	delete sys;
+}
+
+void TestOptimizer::parallel02() {
+	SystemFactory f1,f2;
+	const ExprSymbol& x1=ExprSymbol::new_();
+	const ExprSymbol& x2=ExprSymbol::new_();
+	f1.add_var(x1); f1.add_ctr(x1>=0); f1.add_goal(x1);
+	f2.add_var(x2); f2.add_ctr(x2>=0); f2.add_goal(x2);
+	System sys1(f1), sys2(f2);
+	DefaultOptimizer o1(sys1,0,0), o2(sys2,0,0);
+
+	ParallelOptimizer po(Array<Optimizer>(o1,o2));
+	CPPUNIT_ASSERT(po.optimize(IntervalVector(1,Interval::ALL_REALS),-1e-10)==Optimizer::INFEASIBLE);
+}
+
+void TestOptimizer::parallel03() {
+	SystemFactory f1,f2;
+	const ExprSymbol& x1=ExprSymbol::new_();
+	const ExprSymbol& x2=ExprSymbol::new_();
+	f1.add_var(x1); f1.add_ctr(x1>=0); f1.add_goal(x1);
+	f2.add_var(x2); f2.add_ctr(x2>=0); f2.add_goal(x2);
+	System sys1(f1), sys2(f2);
+	CtcFail ctc1, ctc2;
+	RoundRobin bsc1(0), bsc2(0);
+	Optimizer o1(sys1,ctc1,bsc1), o2(sys2,ctc2,bsc2);
+
+	ParallelOptimizer po(Array<Optimizer>(o1,o2));
+	CPPUNIT_ASSERT_THROW(po.optimize(IntervalVector(1,Interval(-2,2))), std::exception);
+}
+
+void TestOptimizer::checkpoint01() {
+	IntervalVector init_box(3,Interval(-3,3));
+	double prec=1e-6;
+	const char* filename="__tmp__.ckp";
+
+	System* sys=parallel_sys();
+	DefaultOptimizer* o=new DefaultOptimizer(*sys,prec,prec);
+	CPPUNIT_ASSERT(o->optimize(init_box)==Optimizer::SUCCESS);
+
+	// stop the optimization almost immediately
+	System* sys1=parallel_sys();
+	DefaultOptimizer* o1=new DefaultOptimizer(*sys1,prec,prec);
+	o1->timeout=1e-12;
+	CPPUNIT_ASSERT(o1->optimize(init_box)==Optimizer::TIME_OUT);
+	CPPUNIT_ASSERT(!o1->buffer.empty());
+	o1->save(filename);
+
+	System* sys2=parallel_sys();
+	DefaultOptimizer* o2=new DefaultOptimizer(*sys2,prec,prec);
+	CPPUNIT_ASSERT(o2->resume(filename)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o2->nb_cells>o1->nb_cells);
+
+	// both enclosures of the minimum must intersect
+	CPPUNIT_ASSERT(o2->uplo<=o->loup);
+	CPPUNIT_ASSERT(o->uplo<=o2->loup);
+	CPPUNIT_ASSERT(o2->loup-o2->uplo<=1e-5);
+
+	remove(filename);
+	delete o2; delete sys2;
+	delete o1; delete sys1;
+	delete o; delete sys;
+}
+
+void TestOptimizer::centered01() {
+	IntervalVector init_box(3,Interval(-3,3));
+	double prec=1e-6;
+
+	System* sys=parallel_sys();
+	DefaultOptimizer* o=new DefaultOptimizer(*sys,prec,prec);
+	CPPUNIT_ASSERT(o->optimize(init_box)==Optimizer::SUCCESS);
+
+	System* sys2=parallel_sys();
+	DefaultOptimizer* o2=new DefaultOptimizer(*sys2,prec,prec);
+	o2->goal_eval_mode=Function::CENTERED_NATURAL;
+	CPPUNIT_ASSERT(o2->optimize(init_box)==Optimizer::SUCCESS);
+
+	// both enclosures of the minimum must intersect
+	CPPUNIT_ASSERT(o2->uplo<=o->loup);
+	CPPUNIT_ASSERT(o->uplo<=o2->loup);
+	CPPUNIT_ASSERT(o2->nb_cells<=o->nb_cells);
+
+	delete o2;
+	delete sys2;
+	delete o;
+	delete sys;
+}
+
+void TestOptimizer::memory01() {
+	IntervalVector init_box(3,Interval(-3,3));
+	double prec=1e-6;
+
+	System* sys=parallel_sys();
+	DefaultOptimizer* o=new DefaultOptimizer(*sys,prec,prec);
+	CPPUNIT_ASSERT(o->optimize(init_box)==Optimizer::SUCCESS);
+
+	System* sys2=parallel_sys();
+	DefaultOptimizer* o2=new DefaultOptimizer(*sys2,prec,prec);
+	// only a few cells in memory
+	o2->buffer.set_memory_limit(1);
+	CPPUNIT_ASSERT(o2->optimize(init_box)==Optimizer::SUCCESS);
+
+	// both enclosures of the minimum must intersect
+	CPPUNIT_ASSERT(o2->uplo<=o->loup);
+	CPPUNIT_ASSERT(o->uplo<=o2->loup);
+
+	delete o2;
+	delete sys2;
+	delete o;
+	delete sys;
+}
 
 } // end namespace
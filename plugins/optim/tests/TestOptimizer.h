@@ -29,6 +29,12 @@ public:
 		CPPUNIT_TEST(issue50_2);
 		CPPUNIT_TEST(issue50_3);
 		CPPUNIT_TEST(issue50_4);
+		CPPUNIT_TEST(parallel01);
+		CPPUNIT_TEST(parallel02);
+		CPPUNIT_TEST(parallel03);
+		CPPUNIT_TEST(checkpoint01);
+		CPPUNIT_TEST(centered01);
+		CPPUNIT_TEST(memory01);
 	CPPUNIT_TEST_SUITE_END();
 
 	// upperbounding with goal_prec=10% will remove everything (initial loup > true minimum) --> NO_FEASIBLE_FOUND
@@ -39,6 +45,18 @@ public:
 	void issue50_3();
 	// upperbounding with goal_prec=0 will make the optimizer fail (initial loup < true minimum) --> INFEASIBLE
 	void issue50_4();
+	// the parallel optimizer (3 threads) finds the same bounds as the sequential one
+	void parallel01();
+	// issue50_4 with the parallel optimizer --> INFEASIBLE
+	void parallel02();
+	// an exception raised by a worker is passed to the caller
+	void parallel03();
+	// an optimization stopped by the time limit, saved and resumed finds the same bounds
+	void checkpoint01();
+
+	void centered01();
+	// the buffer spills cells into a file and finds the same bounds
+	void memory01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimizer);
@@ -60,6 +60,7 @@ int _2int(const char* argname, const char* arg) {
 
 
 int main (int argc, char** argv) {
+	Timer timer;
 
 	ifstream data;
 	ifstream res;
@@ -85,12 +86,12 @@ int main (int argc, char** argv) {
 	srand(1);
 	volatile double a=rand();
 	volatile double b=rand();
-	Timer::start();
+	timer.start();
 	for (int i=0; i<100000000; i++) {
 		a *= b;
 	}
-	Timer::stop();
-	current_perf = Timer::VIRTUAL_TIMELAPSE();
+	timer.stop();
+	current_perf = timer.get_time();
 
 	cout << "\tcurrent time=" << current_perf << endl;
 	double ratio_perf = current_perf/ref_perf;
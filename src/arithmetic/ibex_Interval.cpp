@@ -24,6 +24,10 @@
 #else
 #ifdef _IBEX_WITH_DIRECT_
 #include "ibex_direct_Interval.cpp_"
+#else
+#ifdef _IBEX_WITH_INLINE_
+#include "ibex_inline_Interval.cpp_"
+#endif
 #endif
 #endif
 #endif
@@ -31,7 +35,27 @@
 
 namespace ibex {
 
+#ifdef _IBEX_WITH_INLINE_
+
+RoundUpScope::RoundUpScope() : mode(fegetround()) {
+	if (mode!=FE_UPWARD) fpu_round_up();
+}
+
+RoundUpScope::~RoundUpScope() {
+	if (mode!=FE_UPWARD) fesetround(mode);
+}
+
+#else
 
+RoundUpScope::RoundUpScope() : mode(0) {
+
+}
+
+RoundUpScope::~RoundUpScope() {
+
+}
+
+#endif
 
 #define INF_DIV(n,d) ((Interval(n)/Interval(d)).lb())
 #define SUP_DIV(n,d) ((Interval(n)/Interval(d)).ub())
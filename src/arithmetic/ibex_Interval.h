@@ -19,7 +19,7 @@
 /* ========================================================*/
 /* The following header file is automatically generated by
  * the compilation. It only contains the definition of
- * _IBEX_WITH_GAOL_ or _IBEX_WITH_BIAS_ */
+ * _IBEX_WITH_GAOL_ or _IBEX_WITH_BIAS_ (etc.) */
 #include "ibex_Setting.h"
 /* ======================================================= */
 
@@ -96,6 +96,35 @@
 		}
 	};
 
+#else
+#ifdef _IBEX_WITH_INLINE_
+	#include <fenv.h>
+
+	/** \brief NEG_INFINITY: double representation of -oo */
+	#define NEG_INFINITY (-(1.0/0.0))
+	/** \brief POS_INFINITY: double representation of +oo */
+	#define POS_INFINITY  (1.0/0.0)
+	/** \brief IBEX_NAN: double representation of NaN */
+	#define IBEX_NAN (0.0/0.0)
+
+	/*
+	 * Interval [-ninf,sup].
+	 *
+	 * The lower bound is stored with its sign changed so that both
+	 * bounds are calculated in the (upward) rounding mode of the FPU.
+	 * The empty interval is [NaN,NaN].
+	 */
+	class INLINE_INTERVAL {
+	public:
+		double ninf;
+		double sup;
+
+		INLINE_INTERVAL() : ninf(IBEX_NAN), sup(IBEX_NAN) { }
+		INLINE_INTERVAL(double a, double b) : ninf(-a), sup(b) { }
+		INLINE_INTERVAL(double a) : ninf(-a), sup(a) { }
+	};
+
+#endif
 #endif
 #endif
 #endif
@@ -127,6 +156,9 @@ void fpu_round_down();
 
 /**
  * \brief Sets the rounding direction mode of the FPU towards +oo.
+ *
+ * With the inline arithmetic (--with-inline), this is the mode all the
+ * operations assume (see #ibex::RoundUpScope).
  */
 void fpu_round_up();
 
@@ -140,6 +172,35 @@ void fpu_round_near();
  */
 void fpu_round_zero();
 
+/**
+ * \brief Rounding mode of the interval arithmetic in a scope.
+ *
+ * With the inline arithmetic (--with-inline), the rounding mode of the FPU is
+ * set upward (the mode all the operations assume) when this object is created,
+ * and the previous mode is restored when it is deleted. The other arithmetics
+ * switch the mode by themselves: this object does nothing.
+ *
+ * Each search (solver, optimizer, paver) and each of their threads creates such
+ * an object, so that the rounding mode of the calling code is left unchanged.
+ * Intervals used outside a search require such an object (or a call to
+ * #fpu_round_up()) with the inline arithmetic.
+ */
+class RoundUpScope {
+public:
+	/** \brief Set the rounding mode upward. */
+	RoundUpScope();
+
+	/** \brief Restore the previous rounding mode. */
+	~RoundUpScope();
+
+private:
+	RoundUpScope(const RoundUpScope&);            // forbidden
+	RoundUpScope& operator=(const RoundUpScope&); // forbidden
+
+	/* The previous rounding mode */
+	int mode;
+};
+
 /**
  * \brief Return the previous float
  */
@@ -159,7 +220,7 @@ double next_float(double x);
  * \brief Interval
  *
  * This class defines the interval interface of IBEX and encapsulates an interval "itv" whose
- * type depends on the chosen implementation (currently: Gaol, Bias of filib).
+ * type depends on the chosen implementation (currently: Gaol, Bias, filib, direct or inline).
  *
  * Note that some functions of the Gaol interval interface do not appear here (like "possibly relations")
  * because there are not used by ibex; while other have been introduced (like "ratio_delta"). Some
@@ -554,6 +615,15 @@ class Interval {
     Interval& operator=(const DIRECT_INTERVAL& x);
 
     DIRECT_INTERVAL itv;
+#else
+#ifdef _IBEX_WITH_INLINE_
+    /* \brief Wrap the inline-interval [x]. */
+    Interval(const INLINE_INTERVAL& x);
+    /* \brief Assign this to the inline-interval [x]. */
+    Interval& operator=(const INLINE_INTERVAL& x);
+
+    INLINE_INTERVAL itv;
+#endif
 #endif
 #endif
 #endif
@@ -882,6 +952,10 @@ bool bwd_imod(Interval& x, Interval& y, const double& p);
 #else
 #ifdef _IBEX_WITH_DIRECT_
 #include "ibex_direct_Interval.h_"
+#else
+#ifdef _IBEX_WITH_INLINE_
+#include "ibex_inline_Interval.h_"
+#endif
 #endif
 #endif
 #endif
@@ -1004,6 +1078,10 @@ inline double distance(const Interval &x1, const Interval &x2) {
 #else
 #ifdef _IBEX_WITH_DIRECT_
     	return fabs(x1.lb()-x2.lb()) <fabs(x1.ub()-x2.ub()) ? fabs(x1.ub()-x2.ub()) : fabs(x1.lb()-x2.lb()) ;
+#else
+#ifdef _IBEX_WITH_INLINE_
+    	return fabs(x1.lb()-x2.lb()) <fabs(x1.ub()-x2.ub()) ? fabs(x1.ub()-x2.ub()) : fabs(x1.lb()-x2.lb()) ;
+#endif
 #endif
 #endif
 #endif
@@ -13,8 +13,207 @@
 #include "ibex_Agenda.h"
 #include "ibex_TemplateMatrix.h_"
 
+#include <fenv.h>
+#include <algorithm>
+
 namespace ibex {
 
+const int MIDRAD_MIN_SIZE=16;
+
+namespace {
+
+/*
+ * Save the rounding mode of the FPU and restore it
+ * at destruction.
+ */
+class RoundingMode {
+public:
+	RoundingMode() : saved(fegetround()) { }
+
+	void set(int mode) { fesetround(mode); }
+
+	~RoundingMode() { fesetround(saved); }
+
+private:
+	const int saved;
+};
+
+/*
+ * c+=a*b where a is m x n, b is n x p and c is m x p (row-major arrays).
+ *
+ * The loops are tiled so that a block of b stays in the cache while it is
+ * multiplied by all the rows of a. The inner loop (on j) is vectorized by
+ * the compiler. Every operation is rounded in the current rounding mode.
+ */
+void gemm(int m, int n, int p, const double* a, const double* b, double* c) {
+	const int KB=64;  // rows of a block of b
+	const int JB=256; // columns of a block of b
+
+	for (int k0=0; k0<n; k0+=KB) {
+		const int k1=k0+KB<n? k0+KB : n;
+		for (int j0=0; j0<p; j0+=JB) {
+			const int j1=j0+JB<p? j0+JB : p;
+			for (int i=0; i<m; i++) {
+				const double* ai=a+i*n;
+				double* ci=c+i*p;
+				for (int k=k0; k<k1; k++) {
+					const double aik=ai[k];
+					const double* bk=b+k*p;
+					for (int j=j0; j<j1; j++)
+						ci[j]+=aik*bk[j];
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Midpoint-radius form <c,r> of a matrix (row-major arrays).
+ *
+ * A vector is a column. The radius of a real matrix is NULL.
+ * The radii are rounded upward so the object must be built in
+ * upward rounding mode. "bounded" is false if an entry is unbounded.
+ */
+class MidRad {
+public:
+	MidRad(const IntervalMatrix& A) : rows(A.nb_rows()), cols(A.nb_cols()), c(new double[rows*cols]), r(new double[rows*cols]), bounded(true) {
+		for (int i=0; i<rows && bounded; i++)
+			bounded=split(A[i],c+i*cols,r+i*cols);
+	}
+
+	MidRad(const IntervalVector& x) : rows(x.size()), cols(1), c(new double[rows]), r(new double[rows]), bounded(true) {
+		bounded=split(x,c,r);
+	}
+
+	MidRad(const Matrix& A) : rows(A.nb_rows()), cols(A.nb_cols()), c(new double[rows*cols]), r(NULL), bounded(true) {
+		for (int i=0; i<rows; i++)
+			for (int j=0; j<cols; j++) {
+				c[i*cols+j]=A[i][j];
+				if (A[i][j]==NEG_INFINITY || A[i][j]==POS_INFINITY) bounded=false;
+			}
+	}
+
+	~MidRad() {
+		delete[] c;
+		if (r) delete[] r;
+	}
+
+	const int rows;
+	const int cols;
+	double* const c;
+	double* const r;
+	bool bounded;
+
+private:
+	static bool split(const IntervalVector& x, double* c, double* r) {
+		for (int i=0; i<x.size(); i++) {
+			const double l=x[i].lb();
+			const double u=x[i].ub();
+			if (l==NEG_INFINITY || u==POS_INFINITY) return false;
+			c[i]=0.5*l+0.5*u; // no overflow
+			r[i]=c[i]-l>u-c[i] ? c[i]-l : u-c[i];
+		}
+		return true;
+	}
+};
+
+inline void set(IntervalMatrix& m, int i, int j, const Interval& x) {
+	m[i][j]=x;
+}
+
+inline void set(IntervalVector& v, int i, int, const Interval& x) {
+	v[i]=x;
+}
+
+/*
+ * res=A*B with Rump's algorithm (see mul_midrad). Return false
+ * (and res is undefined) if an entry of A or B is unbounded.
+ */
+template<class M1, class M2, class Mout>
+bool midrad_mul(const M1& A, const M2& B, Mout& res) {
+
+	if (___is_empty(A) || ___is_empty(B)) { ___set_empty(res); return true; }
+
+	RoundingMode mode;
+	mode.set(FE_UPWARD);
+
+	MidRad a(A);
+	MidRad b(B);
+	if (!a.bounded || !b.bounded) return false;
+
+	const int m=a.rows;
+	const int n=a.cols;
+	const int p=b.cols;
+	assert(b.rows==n);
+
+	double* lo=new double[m*p];
+	double* up=new double[m*p];
+	double* rad=new double[m*p];
+	std::fill(lo,lo+m*p,0.0);
+	std::fill(up,up+m*p,0.0);
+	std::fill(rad,rad+m*p,0.0);
+
+	// c_a*c_b is in [lo,up]
+	mode.set(FE_DOWNWARD);
+	gemm(m,n,p,a.c,b.c,lo);
+	mode.set(FE_UPWARD);
+	gemm(m,n,p,a.c,b.c,up);
+
+	// rad=|c_a|*r_b + r_a*(|c_b|+r_b)
+	if (b.r) {
+		double* abs_ca=new double[m*n];
+		for (int i=0; i<m*n; i++) abs_ca[i]=fabs(a.c[i]);
+		gemm(m,n,p,abs_ca,b.r,rad);
+		delete[] abs_ca;
+	}
+	if (a.r) {
+		double* mag_b=new double[n*p];
+		for (int i=0; i<n*p; i++) mag_b[i]=b.r? fabs(b.c[i])+b.r[i] : fabs(b.c[i]);
+		gemm(m,n,p,a.r,mag_b,rad);
+		delete[] mag_b;
+	}
+
+	for (int i=0; i<m; i++)
+		for (int j=0; j<p; j++) {
+			const int ij=i*p+j;
+			const double c=lo[ij]+0.5*(up[ij]-lo[ij]);
+			const double r=(c-lo[ij])+rad[ij];
+			const double l=-((-c)+r); // rounded downward
+			const double u=c+r;
+			// NaN if c=r=+oo (overflow)
+			set(res,i,j,Interval(l==l? l : NEG_INFINITY, u==u? u : POS_INFINITY));
+		}
+
+	delete[] lo;
+	delete[] up;
+	delete[] rad;
+	return true;
+}
+
+inline bool large(int m, int n, int p) {
+	return m>=MIDRAD_MIN_SIZE && n>=MIDRAD_MIN_SIZE && p>=MIDRAD_MIN_SIZE;
+}
+
+/*
+ * Standard product: m3[i]=sum_k m1[i][k]*m2[k]
+ * (the matrix m2 is traversed row by row).
+ */
+IntervalMatrix mul_rows(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols(),Interval::ZERO);
+
+	if (m1.is_empty() || m2.is_empty()) { m3.set_empty(); return m3; }
+
+	for (int i=0; i<m1.nb_rows(); i++)
+		for (int k=0; k<m1.nb_cols(); k++)
+			vec_axpy(&m3[i][0],&m2[k][0],m1[i][k],m2.nb_cols());
+
+	return m3;
+}
+
+} // end anonymous namespace
+
 IntervalMatrix::IntervalMatrix() : _nb_rows(0), _nb_cols(0), M(NULL) {
 
 }
@@ -238,6 +437,76 @@ std::ostream& operator<<(std::ostream& os, const IntervalMatrix& m) {
 	return _displayM(os,m);
 }
 
+IntervalVector operator*(const IntervalVector& v, const IntervalMatrix& m) {
+	assert(m.nb_rows()==v.size());
+
+	IntervalVector y(m.nb_cols(),Interval::ZERO);
+
+	if (m.is_empty() || v.is_empty()) { y.set_empty(); return y; }
+
+	// y=sum_i v[i]*m[i] (the matrix is traversed row by row)
+	for (int i=0; i<m.nb_rows(); i++)
+		vec_axpy(&y[0],&m[i][0],v[i],m.nb_cols());
+
+	return y;
+}
+
+IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+	if (large(m1.nb_rows(),m1.nb_cols(),m2.nb_cols()))
+		return mul_midrad(m1,m2);
+	else
+		return mul_rows(m1,m2);
+}
+
+IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+	if (large(m1.nb_rows(),m1.nb_cols(),m2.nb_cols()))
+		return mul_midrad(m1,m2);
+	else
+		return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+}
+
+IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+	if (large(m1.nb_rows(),m1.nb_cols(),m2.nb_cols()))
+		return mul_midrad(m1,m2);
+	else
+		return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
+}
+
+IntervalVector operator*(const IntervalMatrix& m, const IntervalVector& x) {
+	assert(m.nb_cols()==x.size());
+	if (m.nb_rows()>=MIDRAD_MIN_SIZE && m.nb_cols()>=MIDRAD_MIN_SIZE)
+		return mul_midrad(m,x);
+	else
+		return mulMV<IntervalMatrix,IntervalVector,IntervalVector>(m,x);
+}
+
+IntervalMatrix mul_midrad(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols());
+	if (midrad_mul(m1,m2,m3)) return m3;
+	else return mul_rows(m1,m2);
+}
+
+IntervalMatrix mul_midrad(const Matrix& m1, const IntervalMatrix& m2) {
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols());
+	if (midrad_mul(m1,m2,m3)) return m3;
+	else return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+}
+
+IntervalMatrix mul_midrad(const IntervalMatrix& m1, const Matrix& m2) {
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols());
+	if (midrad_mul(m1,m2,m3)) return m3;
+	else return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
+}
+
+IntervalVector mul_midrad(const IntervalMatrix& m, const IntervalVector& x) {
+	IntervalVector y(m.nb_rows());
+	if (midrad_mul(m,x,y)) return y;
+	else return mulMV<IntervalMatrix,IntervalVector,IntervalVector>(m,x);
+}
+
 bool bwd_add(const IntervalMatrix& y, IntervalMatrix& x1, IntervalMatrix& x2) {
 	x1 &= y-x2;
 	x2 &= y-x1;
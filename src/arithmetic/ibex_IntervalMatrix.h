@@ -45,6 +45,15 @@ public:
 	 */
 	IntervalMatrix(const IntervalMatrix& m);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Create a matrix by moving \a m.
+	 *
+	 * \a m must not be used anymore, except for being assigned or destroyed.
+	 */
+	IntervalMatrix(IntervalMatrix&& m);
+#endif
+
 	/**
 	 * \brief Create a degenerated interval matrix.
 	 */
@@ -84,6 +93,16 @@ public:
 	 */
 	IntervalMatrix& operator=(const IntervalMatrix& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Set *this to m, by moving m.
+	 *
+	 * The entries of \a m are taken without copy only if
+	 * the dimensions do not match.
+	 */
+	IntervalMatrix& operator=(IntervalMatrix&& x);
+#endif
+
 	/**
 	 * \brief Set *this to its intersection with x
 	 *
@@ -552,6 +571,51 @@ IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2);
  */
 IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2);
 
+/**
+ * \brief $[m]_1*[m]_2$ with the midpoint-radius algorithm.
+ *
+ * Let m1=<c1,r1> and m2=<c2,r2> (midpoints and radii). The product c1*c2
+ * is enclosed by two floating-point products (rounded downward and upward)
+ * and the radius of the result is bounded by |c1|*r2+r1*(|c2|+r2) (rounded
+ * upward). This is Rump's algorithm: only products of real matrices are
+ * computed, by a cache-tiled loop, instead of n^3 interval multiplications.
+ *
+ * The radius of the result can be larger than with the standard product,
+ * but by a factor of at most 1.5. The product operators call this function
+ * as soon as all the dimensions are at least #MIDRAD_MIN_SIZE.
+ *
+ * If an entry is unbounded, the standard product is computed.
+ */
+IntervalMatrix mul_midrad(const IntervalMatrix& m1, const IntervalMatrix& m2);
+
+/**
+ * \brief $m_1*[m]_2$ with the midpoint-radius algorithm.
+ *
+ * \see #mul_midrad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalMatrix mul_midrad(const Matrix& m1, const IntervalMatrix& m2);
+
+/**
+ * \brief $[m]_1*m_2$ with the midpoint-radius algorithm.
+ *
+ * \see #mul_midrad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalMatrix mul_midrad(const IntervalMatrix& m1, const Matrix& m2);
+
+/**
+ * \brief $[m]*[x]$ with the midpoint-radius algorithm.
+ *
+ * \see #mul_midrad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalVector mul_midrad(const IntervalMatrix& m, const IntervalVector& x);
+
+/**
+ * \brief Minimal dimension for the midpoint-radius product.
+ *
+ * \see #mul_midrad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+extern const int MIDRAD_MIN_SIZE;
+
 /**
  * \brief Outer product (multiplication of a column vector by a row vector).
  */
@@ -644,6 +708,29 @@ inline IntervalMatrix IntervalMatrix::empty(int m, int n) {
 	return IntervalMatrix(m, n, Interval::EMPTY_SET);
 }
 
+#if __cplusplus >= 201103L
+inline IntervalMatrix::IntervalMatrix(IntervalMatrix&& m) : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols), M(m.M) {
+	m._nb_rows=0;
+	m._nb_cols=0;
+	m.M=NULL;
+}
+
+inline IntervalMatrix& IntervalMatrix::operator=(IntervalMatrix&& x) {
+	if ((_nb_rows==x._nb_rows && _nb_cols==x._nb_cols) || x.M==NULL)
+		return *this=(const IntervalMatrix&) x;
+
+	// the entries of *this would be reallocated anyway
+	delete[] M;
+	_nb_rows=x._nb_rows;
+	_nb_cols=x._nb_cols;
+	M=x.M;
+	x._nb_rows=0;
+	x._nb_cols=0;
+	x.M=NULL;
+	return *this;
+}
+#endif
+
 inline bool IntervalMatrix::operator!=(const IntervalMatrix& m) const {
 	return !(*this==m);
 }
@@ -790,30 +877,10 @@ inline IntervalVector operator*(const IntervalMatrix& m, const Vector& v) {
 	return mulMV<IntervalMatrix,Vector,IntervalVector>(m,v);
 }
 
-inline IntervalVector operator*(const IntervalMatrix& m, const IntervalVector& v) {
-	return mulMV<IntervalMatrix,IntervalVector,IntervalVector>(m,v);
-}
-
 inline IntervalVector operator*(const Vector& v, const IntervalMatrix& m) {
 	return mulVM<Vector,IntervalMatrix,IntervalVector>(v,m);
 }
 
-inline IntervalVector operator*(const IntervalVector& v, const IntervalMatrix& m) {
-	return mulVM<IntervalVector,IntervalMatrix,IntervalVector>(v,m);
-}
-
-inline IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
-	return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
-inline IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
-	return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
-}
-
-inline IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
-	return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
 inline IntervalMatrix abs(const IntervalMatrix& m) {
 	return absM(m);
 }
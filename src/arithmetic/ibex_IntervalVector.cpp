@@ -16,28 +16,38 @@
 #include <math.h>
 #include <float.h>
 #include <algorithm>
+#include <new>
 
 
 #include "ibex_TemplateVector.h_"
 
 namespace ibex {
 
-IntervalVector::IntervalVector(int nn) : n(nn), vec(new Interval[nn]) {
+Interval* IntervalVector::alloc(int n1) {
+	if (n1<=SMALL_SIZE) {
+		Interval* v=(Interval*) small_vec;
+		for (int i=0; i<n1; i++) new (&v[i]) Interval();
+		return v;
+	} else
+		return new Interval[n1];
+}
+
+IntervalVector::IntervalVector(int nn) : n(nn), own(true), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=Interval::ALL_REALS;
 }
 
-IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), own(true), vec(alloc(n1)) {
 	assert(n1>=1);
 	for (int i=0; i<n1; i++) vec[i]=x;
 }
 
-IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(new Interval[x.n]) {
+IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), own(true), vec(alloc(x.n)) {
 	assert(x.vec!=NULL); // forbidden to copy uninitialized boxes
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), own(true), vec(alloc(n1)) {
 	if (bounds==0) // probably, the user called IntervalVector(n,0) and 0 is interpreted as NULL!
 		for (int i=0; i<n1; i++)
 			vec[i]=Interval::ZERO;
@@ -46,7 +56,7 @@ IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Inte
 			vec[i]=Interval(bounds[i][0],bounds[i][1]);
 }
 
-IntervalVector::IntervalVector(const Vector& x) : n(x.size()), vec(new Interval[n]) {
+IntervalVector::IntervalVector(const Vector& x) : n(x.size()), own(true), vec(alloc(n)) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
@@ -62,14 +72,20 @@ void IntervalVector::resize(int n2) {
 
 	if (n2==size()) return;
 
-	Interval* newVec=new Interval[n2];
-	int i=0;
-	for (; i<size() && i<n2; i++)
+	assert(own); // the box of a pooled cell cannot be resized
+
+	if (is_small() && n2<=SMALL_SIZE) {
+		// the inline storage is kept
+		for (int i=n; i<n2; i++) new (&vec[i]) Interval();
+		for (int i=n2; i<n; i++) vec[i].~Interval();
+		n = n2;
+		return;
+	}
+
+	Interval* newVec=alloc(n2); // (-oo,+oo) by default
+	for (int i=0; i<size() && i<n2; i++)
 		newVec[i]=vec[i];
-	for (; i<n2; i++)
-		newVec[i]=Interval::ALL_REALS;
-	if (vec!=NULL) // vec==NULL happens when default constructor is used (n==0)
-		delete[] vec;
+	dealloc(); // vec==NULL happens when default constructor is used (n==0)
 
 	n   = n2;
 	vec = newVec;
@@ -83,13 +99,7 @@ IntervalVector& IntervalVector::operator&=(const IntervalVector& x)  {
 	if (is_empty()) return *this;
 	if (x.is_empty()) { set_empty(); return *this; }
 
-	for (int i=0; i<size(); i++) {
-		(*this)[i] &= x[i];
-		if ((*this)[i].is_empty()) {
-			set_empty();
-			return *this;
-		}
-	}
+	if (!vec_inter(vec,x.vec,n)) set_empty();
 	return *this;
 }
 
@@ -100,9 +110,7 @@ IntervalVector& IntervalVector::operator|=(const IntervalVector& x)  {
 	if (x.is_empty()) return *this;
 	if (is_empty()) { *this=x; return *this; }
 
-	for (int i=0; i<size(); i++) {
-		(*this)[i] |= x[i];
-	}
+	vec_hull(vec,x.vec,n);
 	return *this;
 }
 
@@ -258,7 +266,25 @@ bool bwd_mul(const Interval& z, IntervalVector& x, IntervalVector& y) {
 }
 
 
-IntervalVector& IntervalVector::inflate(double rad1)                              { return _inflate(*this,rad1); }
+IntervalVector& IntervalVector::inflate(double rad1) {
+	if (is_empty()) return *this;
+	vec_inflate(vec,rad1,n);
+	return *this;
+}
+
+Vector IntervalVector::diam() const {
+	if (is_empty()) return _diam(*this);
+	Vector d(n);
+	vec_diam(vec,&d[0],n);
+	return d;
+}
+
+double IntervalVector::rel_distance(const IntervalVector& x) const {
+	assert(size()==x.size());
+	return vec_rel_distance(vec,x.vec,n);
+}
+
+
 IntervalVector  IntervalVector::subvector(int start_index, int end_index) const   { return _subvector(*this,start_index,end_index); }
 void            IntervalVector::put(int start_index, const IntervalVector& x)     { _put(*this, start_index, x); }
 IntervalVector& IntervalVector::operator=(const IntervalVector& x)                { resize(x.size()); // see issue #10
@@ -274,12 +300,10 @@ bool            IntervalVector::is_unbounded() const
 bool            IntervalVector::is_zero() const                                   { return _is_zero(*this); }
 bool            IntervalVector::is_bisectable() const                             { return _is_bisectable(*this); }
 Vector          IntervalVector::rad() const                                       { return _rad(*this); }
-Vector          IntervalVector::diam() const                                      { return _diam(*this); }
 int             IntervalVector::extr_diam_index(bool min) const                   { return _extr_diam_index(*this,min); }
 std::ostream&   operator<<(std::ostream& os, const IntervalVector& x)             { return _displayV(os,x); }
 double          IntervalVector::volume() const                                    { return _volume(*this); }
 double          IntervalVector::perimeter() const                                 { return _perimeter(*this); }
-double          IntervalVector::rel_distance(const IntervalVector& x) const       { return _rel_distance(*this,x); }
 Vector          IntervalVector::random(int seed) const                            { return _random<IntervalVector,Interval>(*this,seed); }
 Vector          IntervalVector::random() const                            		  { return _random<IntervalVector,Interval>(*this); }
 std::pair<IntervalVector,IntervalVector> IntervalVector::bisect(int i, double ratio) const  { return _bisect(*this, i, ratio); }
@@ -24,6 +24,7 @@
 namespace ibex {
 
 class IntervalMatrix; // declared only for friendship
+class Cell;           // declared only for friendship
 
 /**
  * \ingroup arithmetic
@@ -59,6 +60,18 @@ public:
 	 */
 	IntervalVector(const IntervalVector& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Create a vector by moving \a x.
+	 *
+	 * The components of \a x are taken without copy (unless they are
+	 * stored inline, see below, or \a x is the box of a cell allocated
+	 * by a #ibex::CellPool) and \a x must not be used anymore, except
+	 * for being assigned or destroyed.
+	 */
+	IntervalVector(IntervalVector&& x);
+#endif
+
 	/**
 	 * \brief Create the IntervalVector [bounds[0][0],bounds[0][1]]x...x[bounds[n-1][0],bounds[n-1][1]]
 	 *
@@ -168,6 +181,17 @@ public:
 	 */
 	IntervalVector& operator=(const IntervalVector& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Assign this IntervalVector to x, by moving x.
+	 *
+	 * If the dimensions match, the components are copied (so that
+	 * references to the components of *this remain valid). Otherwise,
+	 * the components of \a x are taken without copy.
+	 */
+	IntervalVector& operator=(IntervalVector&& x);
+#endif
+
 	/**
 	 * \brief Set *this to its intersection with x
 	 *
@@ -540,11 +564,29 @@ public:
 
 private:
 	friend class IntervalMatrix;
+	friend class Cell; // for allocating boxes in a pool
+
+	IntervalVector() : n(0), own(true), vec(NULL) { } // for IntervalMatrix & complementary()
+
+	/* Vectors of dimension <= SMALL_SIZE store their components
+	 * inline (in small_vec) instead of in the heap. The buffer is
+	 * kept small because every row of an IntervalMatrix pays for it. */
+	static const int SMALL_SIZE=2;
+
+	/* Return an array of n intervals set to (-oo,+oo), either the inline
+	 * storage or a new array in the heap, depending on n. */
+	Interval* alloc(int n);
 
-	IntervalVector() : n(0), vec(NULL) { } // for IntervalMatrix & complementary()
+	/* Free the array of components (unless it belongs to a cell pool). */
+	void dealloc();
+
+	/* True if the components are stored inline. */
+	bool is_small() const;
 
 	int n;             // dimension (size of vec)
+	bool own;          // false if vec belongs to a cell pool (and must not be freed)
 	Interval *vec;	   // vector of elements
+	double small_vec[SMALL_SIZE*sizeof(Interval)/sizeof(double)]; // inline storage
 };
 
 /** \ingroup arithmetic */
@@ -707,6 +749,7 @@ inline void ___set_empty(IntervalVector& v) { v.set_empty(); }
 } // end namespace ibex
 
 #include "ibex_LinearArith.h_"
+#include "ibex_VectorKernels.h_"
 
 namespace ibex {
 
@@ -714,8 +757,45 @@ inline IntervalVector IntervalVector::empty(int n) {
 	return IntervalVector(n, Interval::EMPTY_SET);
 }
 
+inline bool IntervalVector::is_small() const {
+	return vec==(const Interval*) small_vec;
+}
+
+inline void IntervalVector::dealloc() {
+	if (is_small())
+		for (int i=0; i<n; i++) vec[i].~Interval();
+	else if (own)
+		delete[] vec;
+}
+
+#if __cplusplus >= 201103L
+inline IntervalVector::IntervalVector(IntervalVector&& x) : n(x.n), own(true), vec(x.vec) {
+	if (x.is_small() || !x.own) {
+		// inline storage and the components of a pooled cell cannot be taken
+		vec=alloc(n);
+		for (int i=0; i<n; i++) vec[i]=x.vec[i];
+	} else {
+		x.n=0;
+		x.vec=NULL;
+	}
+}
+
+inline IntervalVector& IntervalVector::operator=(IntervalVector&& x) {
+	if (n==x.n || !own || !x.own || x.is_small())
+		return *this=(const IntervalVector&) x;
+
+	// the components of *this would be reallocated anyway
+	dealloc();
+	n=x.n;
+	vec=x.vec;
+	x.n=0;
+	x.vec=NULL;
+	return *this;
+}
+#endif
+
 inline IntervalVector::~IntervalVector() {
-	delete[] vec;
+	dealloc();
 }
 
 inline void IntervalVector::set_empty() {
@@ -770,7 +850,8 @@ inline bool IntervalVector::is_empty() const {
 }
 
 inline double IntervalVector::max_diam() const {
-	return (*this)[extr_diam_index(false)].diam();
+	if (is_empty()) throw InvalidIntervalVectorOp("Diameter of an empty IntervalVector is undefined");
+	return vec_max_diam(vec,n);
 }
 
 inline double IntervalVector::min_diam() const {
@@ -789,7 +870,10 @@ inline IntervalVector& IntervalVector::operator+=(const Vector& x) {
 }
 
 inline IntervalVector& IntervalVector::operator+=(const IntervalVector& x) {
-	return set_addV<IntervalVector,IntervalVector>(*this,x);
+	assert(size()==x.size());
+	if (is_empty() || x.is_empty()) { set_empty(); return *this; }
+	vec_add(vec,x.vec,n);
+	return *this;
 }
 
 inline IntervalVector& IntervalVector::operator-=(const Vector& x) {
@@ -797,7 +881,10 @@ inline IntervalVector& IntervalVector::operator-=(const Vector& x) {
 }
 
 inline IntervalVector& IntervalVector::operator-=(const IntervalVector& x) {
-	return set_subV<IntervalVector,IntervalVector>(*this,x);
+	assert(size()==x.size());
+	if (is_empty() || x.is_empty()) { set_empty(); return *this; }
+	vec_sub(vec,x.vec,n);
+	return *this;
 }
 
 inline IntervalVector& IntervalVector::operator*=(double x) {
@@ -857,7 +944,9 @@ inline Interval operator*(const IntervalVector& v1, const Vector& v2) {
 }
 
 inline Interval operator*(const IntervalVector& v1, const IntervalVector& v2) {
-	return mulVV<IntervalVector,IntervalVector,Interval>(v1,v2);
+	assert(v1.size()==v2.size());
+	if (v1.is_empty() || v2.is_empty()) return Interval::EMPTY_SET;
+	return vec_dot(&v1[0],&v2[0],v1.size());
 }
 
 inline IntervalVector hadamard_product(const Vector& v1, const IntervalVector& v2) {
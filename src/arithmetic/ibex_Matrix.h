@@ -43,6 +43,15 @@ public:
 	 */
 	Matrix(const Matrix& m);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Create a matrix by moving \a m.
+	 *
+	 * \a m must not be used anymore, except for being assigned or destroyed.
+	 */
+	Matrix(Matrix&& m);
+#endif
+
 	/**
 	 * \brief Create a matrix from an array of doubles.
 	 *
@@ -67,6 +76,16 @@ public:
 	 */
 	Matrix& operator=(const Matrix& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Set *this to m, by moving m.
+	 *
+	 * The entries of \a m are taken without copy only if
+	 * the dimensions do not match.
+	 */
+	Matrix& operator=(Matrix&& x);
+#endif
+
 	/**
 	 * \brief True if the entries of (*this) coincide with m.
 	 *
@@ -281,6 +300,29 @@ inline void ___set_empty(Matrix&)              { }
 namespace ibex {
 
 
+#if __cplusplus >= 201103L
+inline Matrix::Matrix(Matrix&& m) : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols), M(m.M) {
+	m._nb_rows=0;
+	m._nb_cols=0;
+	m.M=NULL;
+}
+
+inline Matrix& Matrix::operator=(Matrix&& x) {
+	if ((_nb_rows==x._nb_rows && _nb_cols==x._nb_cols) || x.M==NULL)
+		return *this=(const Matrix&) x;
+
+	// the entries of *this would be reallocated anyway
+	delete[] M;
+	_nb_rows=x._nb_rows;
+	_nb_cols=x._nb_cols;
+	M=x.M;
+	x._nb_rows=0;
+	x._nb_cols=0;
+	x.M=NULL;
+	return *this;
+}
+#endif
+
 inline bool Matrix::operator!=(const Matrix& m) const {
 	return !(*this==m);
 }
@@ -200,7 +200,26 @@ inline bool basic_is_disjoint(const Interval& x, const Interval& y) {
     return cond; \
   }
 
-__IBEX_GENERATE_BASIC_SET_OP_AND__   (Interval,Interval, basic_is_subset)
+// inclusion of vectors is a whole-vector kernel (see ibex_VectorKernels.h_)
+inline bool basic_is_subset(const IntervalVector& x, const IntervalVector& y) {
+	assert(x.size()==y.size());
+	return vec_is_subset(&x[0],&y[0],x.size());
+}
+
+inline bool basic_is_subset(const IntervalMatrix& x, const IntervalMatrix& y) {
+	assert(x.nb_rows()==y.nb_rows());
+	for (int i=0; i<x.nb_rows(); i++)
+		if (!basic_is_subset(x[i],y[i])) return false;
+	return true;
+}
+
+inline bool basic_is_subset(const IntervalMatrixArray& x, const IntervalMatrixArray& y) {
+	assert(x.size()==y.size());
+	for (int k=0; k<x.size(); k++)
+		if (!basic_is_subset(x[k],y[k])) return false;
+	return true;
+}
+
 __IBEX_GENERATE_BASIC_SET_OP_AND_OR__(Interval,Interval, basic_is_strict_subset)
 __IBEX_GENERATE_BASIC_SET_OP_AND__   (Interval,Interval, basic_is_interior_subset)
 __IBEX_GENERATE_BASIC_SET_OP_AND_OR__(Interval,Interval, basic_is_strict_interior_subset)
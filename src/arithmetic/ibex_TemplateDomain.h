@@ -13,6 +13,7 @@
 #define __IBEX_TENSOR_H__
 
 #include "ibex_Dim.h"
+#include <utility>
 
 namespace ibex {
 
@@ -85,6 +86,16 @@ public:
 	 */
 	TemplateDomain(const TemplateDomain<D>& d, bool is_reference1=false);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Creates a domain by moving \a d.
+	 *
+	 * If \a d is not a reference, its internal domain is taken
+	 * without copy and \a d must not be used anymore.
+	 */
+	TemplateDomain(TemplateDomain<D>&& d);
+#endif
+
 	/**
 	 * \brief Return the ith component of *this.
 	 *
@@ -109,6 +120,17 @@ public:
 	 */
 	TemplateDomain& operator=(const TemplateDomain<D>& d);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Load the domain from another domain, by moving it.
+	 *
+	 * The dimensions match so the internal domain of *this (that
+	 * may be referenced) is kept: see the move assignment of the
+	 * vector and matrix types.
+	 */
+	TemplateDomain& operator=(TemplateDomain<D>&& d);
+#endif
+
 	/**
 	 * \brief Intersect the domain with another domain.
 	 */
@@ -362,6 +384,13 @@ inline TemplateDomain<D>::TemplateDomain(const TemplateDomain<D>& d, bool is_ref
 	}
 }
 
+#if __cplusplus >= 201103L
+template<class D>
+inline TemplateDomain<D>::TemplateDomain(TemplateDomain<D>&& d) : dim(d.dim), is_reference(d.is_reference), domain(d.domain) {
+	if (!is_reference) d.domain=NULL;
+}
+#endif
+
 template<class D>
 inline TemplateDomain<D>::TemplateDomain() : dim(), is_reference(false), domain(NULL) {
 
@@ -386,7 +415,7 @@ const TemplateDomain<D> TemplateDomain<D>::operator[](int ii) const {
 
 template<class D>
 TemplateDomain<D>::~TemplateDomain() {
-	if (!is_reference) {
+	if (!is_reference && domain!=NULL) { // domain==NULL if moved
 		switch(dim.type()) {
 		case Dim::SCALAR:       delete &i();  break;
 		case Dim::ROW_VECTOR:
@@ -410,6 +439,21 @@ TemplateDomain<D>& TemplateDomain<D>::operator=(const TemplateDomain<D>& d) {
 	return *this;
 }
 
+#if __cplusplus >= 201103L
+template<class D>
+TemplateDomain<D>& TemplateDomain<D>::operator=(TemplateDomain<D>&& d) {
+	assert((*this).dim==d.dim);
+	switch((*this).dim.type()) {
+	case Dim::SCALAR:       i()=d.i(); break;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:   v()=std::move(d.v()); break;
+	case Dim::MATRIX:       m()=std::move(d.m()); break;
+	case Dim::MATRIX_ARRAY: ma()=d.ma(); break;
+	}
+	return *this;
+}
+#endif
+
 template<class D>
 TemplateDomain<D>& TemplateDomain<D>::operator&=(const TemplateDomain<D>& d) {
 	assert((*this).dim==d.dim);
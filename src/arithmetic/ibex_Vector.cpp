@@ -15,27 +15,31 @@
 
 namespace ibex {
 
-Vector::Vector(int nn) : n(nn), vec(new double[nn]) {
+double* Vector::alloc(int n1) {
+	return n1<=SMALL_SIZE ? small_vec : new double[n1];
+}
+
+Vector::Vector(int nn) : n(nn), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=0;
 }
 
-Vector::Vector(int nn, double x) : n(nn), vec(new double[nn]) {
+Vector::Vector(int nn, double x) : n(nn), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=x;
 }
 
-Vector::Vector(const Vector& x) : n(x.n), vec(new double[x.n]) {
+Vector::Vector(const Vector& x) : n(x.n), vec(alloc(x.n)) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-Vector::Vector(int nn, double x[]) : n(nn), vec(new double[nn]) {
+Vector::Vector(int nn, double x[]) : n(nn), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=x[i];
 }
 
 Vector::~Vector() {
-	delete[] vec;
+	if (!is_small()) delete[] vec;
 }
 
 void Vector::resize(int n2) {
@@ -44,13 +48,20 @@ void Vector::resize(int n2) {
 
 	if (n2==size()) return;
 
-	double* newVec=new double[n2];
+	if (is_small() && n2<=SMALL_SIZE) {
+		// the inline storage is kept
+		for (int i=n; i<n2; i++) vec[i]=0.0;
+		n = n2;
+		return;
+	}
+
+	double* newVec=alloc(n2);
 	int i=0;
 	for (; i<size() && i<n2; i++)
 		newVec[i]=vec[i];
 	for (; i<n2; i++)
 		newVec[i]=0.0;
-	if (vec!=NULL) // vec==NULL happens when default constructor is used (n==0)
+	if (!is_small()) // vec==NULL happens when default constructor is used (n==0)
 		delete[] vec;
 
 	n   = n2;
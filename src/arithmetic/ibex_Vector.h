@@ -49,6 +49,15 @@ public:
 	 */
 	Vector(const Vector& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Create a vector by moving \a x.
+	 *
+	 * \a x must not be used anymore, except for being assigned or destroyed.
+	 */
+	Vector(Vector&& x);
+#endif
+
 	/**
 	 * \brief Create the Vector [x[0]; ..; x[n]]
 	 *
@@ -108,6 +117,16 @@ public:
 	 */
 	Vector& operator=(const Vector& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Assign this Vector to x, by moving x.
+	 *
+	 * The components of \a x are taken without copy only if
+	 * the dimensions do not match.
+	 */
+	Vector& operator=(Vector&& x);
+#endif
+
 	/**
 	 * \brief Return true if the components of this Vector match that of \a x.
 	 */
@@ -173,8 +192,20 @@ private:
 
 	Vector() : n(0), vec(NULL) { } // for Matrix
 
+	/* Vectors of dimension <= SMALL_SIZE store their components
+	 * inline (in small_vec) instead of in the heap. */
+	static const int SMALL_SIZE=8;
+
+	/* Return an array of n doubles, either the inline
+	 * storage or a new array in the heap, depending on n. */
+	double* alloc(int n);
+
+	/* True if the components are stored inline. */
+	bool is_small() const;
+
 	int n;             // dimension (size of vec)
 	double *vec;	   // vector of elements
+	double small_vec[SMALL_SIZE]; // inline storage
 };
 
 /** \ingroup arithmetic */
@@ -245,6 +276,36 @@ inline void ___set_empty(Vector&)              { }
 namespace ibex {
 
 
+inline bool Vector::is_small() const {
+	return vec==small_vec;
+}
+
+#if __cplusplus >= 201103L
+inline Vector::Vector(Vector&& x) : n(x.n), vec(x.vec) {
+	if (x.is_small()) {
+		// inline storage cannot be taken
+		vec=small_vec;
+		for (int i=0; i<n; i++) vec[i]=x.vec[i];
+	} else {
+		x.n=0;
+		x.vec=NULL;
+	}
+}
+
+inline Vector& Vector::operator=(Vector&& x) {
+	if (n==x.n || x.is_small())
+		return *this=(const Vector&) x;
+
+	// the components of *this would be reallocated anyway
+	if (!is_small()) delete[] vec;
+	n=x.n;
+	vec=x.vec;
+	x.n=0;
+	x.vec=NULL;
+	return *this;
+}
+#endif
+
 inline const double& Vector::operator[](int i) const {
 	assert(i>=0 && i<n);
 	return vec[i];
@@ -0,0 +1,383 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_VectorKernels.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Interval.h"
+#include "ibex_VectorKernels.h_"
+
+#if defined(_IBEX_WITH_INLINE_) && defined(__SSE2__) && defined(__GNUC__)
+#define __IBEX_SIMD_KERNELS__
+#include <immintrin.h>
+#endif
+
+namespace ibex {
+
+#ifndef __IBEX_SIMD_KERNELS__
+
+void vec_add(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++)
+		x[i]+=y[i];
+}
+
+void vec_sub(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++)
+		x[i]-=y[i];
+}
+
+bool vec_inter(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++) {
+		if ((x[i]&=y[i]).is_empty()) return false;
+	}
+	return true;
+}
+
+void vec_hull(Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++)
+		x[i]|=y[i];
+}
+
+void vec_inflate(Interval* x, double rad, int n) {
+	Interval r(-rad,rad);
+	for (int i=0; i<n; i++)
+		x[i]+=r;
+}
+
+void vec_diam(const Interval* x, double* d, int n) {
+	for (int i=0; i<n; i++)
+		d[i]=x[i].diam();
+}
+
+double vec_max_diam(const Interval* x, int n) {
+	double max=x[0].diam();
+	for (int i=1; i<n; i++) {
+		double cand=x[i].diam();
+		if (max<cand) max=cand;
+	}
+	return max;
+}
+
+bool vec_is_subset(const Interval* x, const Interval* y, int n) {
+	for (int i=0; i<n; i++)
+		if (!(y[i].lb()<=x[i].lb() && y[i].ub()>=x[i].ub())) return false;
+	return true;
+}
+
+double vec_rel_distance(const Interval* x, const Interval* y, int n) {
+	double max=x[0].rel_distance(y[0]);
+	for (int i=1; i<n; i++) {
+		double cand=x[i].rel_distance(y[i]);
+		if (max<cand) max=cand;
+	}
+	return max;
+}
+
+Interval vec_dot(const Interval* x, const Interval* y, int n) {
+	Interval s=0;
+	for (int i=0; i<n; i++)
+		s+=x[i]*y[i];
+	return s;
+}
+
+void vec_axpy(Interval* y, const Interval* x, const Interval& a, int n) {
+	for (int i=0; i<n; i++)
+		y[i]+=x[i]*a;
+}
+
+#else
+
+namespace {
+
+// An interval is the pair (-lb,ub), i.e., one SSE2 register.
+typedef char __ibex_interval_is_a_pair[sizeof(Interval)==2*sizeof(double)? 1 : -1];
+
+#define __IBEX_AVX2__ __attribute__((target("avx2")))
+
+/*
+ * Whether the processor supports AVX2 (detected once).
+ */
+bool has_avx2() {
+	static const bool avx2=(__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+	return avx2;
+}
+
+inline const double* ptr(const Interval* x) {
+	return reinterpret_cast<const double*>(x);
+}
+
+inline double* ptr(Interval* x) {
+	return reinterpret_cast<double*>(x);
+}
+
+inline __m128d load(const Interval* x) {
+	return _mm_loadu_pd(ptr(x));
+}
+
+inline void store(Interval* x, __m128d v) {
+	_mm_storeu_pd(ptr(x),v);
+}
+
+inline __m128d swap(__m128d x) {
+	return _mm_shuffle_pd(x,x,1);
+}
+
+/*
+ * Whether all the bounds of x and y are finite
+ * (0*oo is NaN).
+ */
+inline bool bounded(__m128d x, __m128d y) {
+	const __m128d z=_mm_add_pd(_mm_mul_pd(x,_mm_setzero_pd()),_mm_mul_pd(y,_mm_setzero_pd()));
+	return _mm_movemask_pd(_mm_cmpeq_pd(z,z))==3;
+}
+
+/*
+ * Product of two bounded intervals: since the FPU rounds upward,
+ * each bound (-lb or ub) is the maximum of the four products
+ * that can give it.
+ */
+inline __m128d mul(__m128d x, __m128d y) {
+	const __m128d ys=swap(y);
+	const __m128d nx=_mm_xor_pd(x,_mm_set1_pd(-0.0));
+	const __m128d l=_mm_max_pd(_mm_mul_pd(x,ys),_mm_mul_pd(nx,y));  // (-a*d,-b*c) and (-a*c,-b*d)
+	const __m128d u=_mm_max_pd(_mm_mul_pd(x,y),_mm_mul_pd(nx,ys));  // (a*c,b*d) and (a*d,b*c)
+	return _mm_max_pd(_mm_unpacklo_pd(l,u),_mm_unpackhi_pd(l,u));
+}
+
+/*
+ * Product of x[i] and y (the scalar product of Interval
+ * handles the unbounded cases).
+ */
+inline __m128d mul(const Interval* x, __m128d xi, const Interval& y, __m128d yi) {
+	if (bounded(xi,yi))
+		return mul(xi,yi);
+	else {
+		Interval p=(*x)*y;
+		return load(&p);
+	}
+}
+
+// ==================== AVX2 kernels (two intervals per register) ====================
+// The number m of intervals processed is a multiple of 2 (or 4 for diam).
+
+__IBEX_AVX2__ void add_avx2(double* x, const double* y, int m) {
+	for (int i=0; i<2*m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_add_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(y+i)));
+}
+
+__IBEX_AVX2__ void sub_avx2(double* x, const double* y, int m) {
+	for (int i=0; i<2*m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_add_pd(_mm256_loadu_pd(x+i),_mm256_permute_pd(_mm256_loadu_pd(y+i),5)));
+}
+
+__IBEX_AVX2__ bool inter_avx2(double* x, const double* y, int m) {
+	for (int i=0; i<2*m; i+=4) {
+		__m256d r=_mm256_min_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(y+i));
+		_mm256_storeu_pd(x+i,r);
+		// empty iff ub<lb, i.e., ub+(-lb)<0
+		if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_add_pd(r,_mm256_permute_pd(r,5)),_mm256_setzero_pd(),_CMP_LT_OQ)))
+			return false;
+	}
+	return true;
+}
+
+__IBEX_AVX2__ void hull_avx2(double* x, const double* y, int m) {
+	for (int i=0; i<2*m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_max_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(y+i)));
+}
+
+__IBEX_AVX2__ void inflate_avx2(double* x, double rad, int m) {
+	const __m256d r=_mm256_set1_pd(rad);
+	for (int i=0; i<2*m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_add_pd(_mm256_loadu_pd(x+i),r));
+}
+
+__IBEX_AVX2__ void diam_avx2(const double* x, double* d, int m) {
+	for (int i=0; i<2*m; i+=8) {
+		// (d0,d2,d1,d3) -> (d0,d1,d2,d3)
+		__m256d h=_mm256_hadd_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(x+i+4));
+		_mm256_storeu_pd(d+i/2,_mm256_permute4x64_pd(h,0xD8));
+	}
+}
+
+__IBEX_AVX2__ __m128d max_diam_avx2(const double* x, int m) {
+	__m256d max=_mm256_setzero_pd();
+	for (int i=0; i<2*m; i+=4) {
+		__m256d v=_mm256_loadu_pd(x+i);
+		max=_mm256_max_pd(max,_mm256_add_pd(v,_mm256_permute_pd(v,5)));
+	}
+	return _mm_max_pd(_mm256_castpd256_pd128(max),_mm256_extractf128_pd(max,1));
+}
+
+__IBEX_AVX2__ bool is_subset_avx2(const double* x, const double* y, int m) {
+	for (int i=0; i<2*m; i+=4)
+		if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(y+i),_mm256_loadu_pd(x+i),_CMP_GE_OQ))!=0xF)
+			return false;
+	return true;
+}
+
+__IBEX_AVX2__ inline bool bounded_avx2(__m256d x, __m256d y) {
+	const __m256d z=_mm256_add_pd(_mm256_mul_pd(x,_mm256_setzero_pd()),_mm256_mul_pd(y,_mm256_setzero_pd()));
+	return _mm256_movemask_pd(_mm256_cmp_pd(z,z,_CMP_EQ_OQ))==0xF;
+}
+
+__IBEX_AVX2__ inline __m256d mul_avx2(__m256d x, __m256d y) {
+	const __m256d ys=_mm256_permute_pd(y,5);
+	const __m256d nx=_mm256_xor_pd(x,_mm256_set1_pd(-0.0));
+	const __m256d l=_mm256_max_pd(_mm256_mul_pd(x,ys),_mm256_mul_pd(nx,y));
+	const __m256d u=_mm256_max_pd(_mm256_mul_pd(x,y),_mm256_mul_pd(nx,ys));
+	return _mm256_max_pd(_mm256_unpacklo_pd(l,u),_mm256_unpackhi_pd(l,u));
+}
+
+__IBEX_AVX2__ __m128d dot_avx2(const Interval* x, const Interval* y, int m) {
+	__m256d s=_mm256_setzero_pd();
+	__m128d s2=_mm_setzero_pd(); // for the products with unbounded intervals
+	for (int i=0; i<m; i+=2) {
+		__m256d xi=_mm256_loadu_pd(ptr(x+i));
+		__m256d yi=_mm256_loadu_pd(ptr(y+i));
+		if (bounded_avx2(xi,yi))
+			s=_mm256_add_pd(s,mul_avx2(xi,yi));
+		else {
+			s2=_mm_add_pd(s2,mul(x+i,load(x+i),y[i],load(y+i)));
+			s2=_mm_add_pd(s2,mul(x+i+1,load(x+i+1),y[i+1],load(y+i+1)));
+		}
+	}
+	return _mm_add_pd(s2,_mm_add_pd(_mm256_castpd256_pd128(s),_mm256_extractf128_pd(s,1)));
+}
+
+__IBEX_AVX2__ void axpy_avx2(Interval* y, const Interval* x, const Interval& a, int m) {
+	const __m256d ai=_mm256_broadcast_pd(reinterpret_cast<const __m128d*>(ptr(&a)));
+	for (int i=0; i<m; i+=2) {
+		__m256d xi=_mm256_loadu_pd(ptr(x+i));
+		if (bounded_avx2(xi,ai))
+			_mm256_storeu_pd(ptr(y+i),_mm256_add_pd(_mm256_loadu_pd(ptr(y+i)),mul_avx2(xi,ai)));
+		else {
+			store(y+i,_mm_add_pd(load(y+i),mul(x+i,load(x+i),a,load(&a))));
+			store(y+i+1,_mm_add_pd(load(y+i+1),mul(x+i+1,load(x+i+1),a,load(&a))));
+		}
+	}
+}
+
+} // end anonymous namespace
+
+// ==================== SSE2 kernels (one interval per register) ====================
+
+void vec_add(Interval* x, const Interval* y, int n) {
+	int i=0;
+	if (has_avx2()) add_avx2(ptr(x),ptr(y),i=n&~1);
+	for (; i<n; i++)
+		store(x+i,_mm_add_pd(load(x+i),load(y+i)));
+}
+
+void vec_sub(Interval* x, const Interval* y, int n) {
+	int i=0;
+	if (has_avx2()) sub_avx2(ptr(x),ptr(y),i=n&~1);
+	// x-y=(-lb(x)+ub(y),ub(x)+(-lb(y)))
+	for (; i<n; i++)
+		store(x+i,_mm_add_pd(load(x+i),swap(load(y+i))));
+}
+
+bool vec_inter(Interval* x, const Interval* y, int n) {
+	int i=0;
+	if (has_avx2() && !inter_avx2(ptr(x),ptr(y),i=n&~1)) return false;
+	for (; i<n; i++) {
+		__m128d r=_mm_min_pd(load(x+i),load(y+i));
+		store(x+i,r);
+		if (_mm_movemask_pd(_mm_cmplt_pd(_mm_add_pd(r,swap(r)),_mm_setzero_pd()))) return false;
+	}
+	return true;
+}
+
+void vec_hull(Interval* x, const Interval* y, int n) {
+	int i=0;
+	if (has_avx2()) hull_avx2(ptr(x),ptr(y),i=n&~1);
+	for (; i<n; i++)
+		store(x+i,_mm_max_pd(load(x+i),load(y+i)));
+}
+
+void vec_inflate(Interval* x, double rad, int n) {
+	int i=0;
+	if (has_avx2()) inflate_avx2(ptr(x),rad,i=n&~1);
+	const __m128d r=_mm_set1_pd(rad);
+	for (; i<n; i++)
+		store(x+i,_mm_add_pd(load(x+i),r));
+}
+
+void vec_diam(const Interval* x, double* d, int n) {
+	int i=0;
+	if (has_avx2()) diam_avx2(ptr(x),d,i=n&~3);
+	for (; i+1<n; i+=2) {
+		__m128d x0=load(x+i);
+		__m128d x1=load(x+i+1);
+		_mm_storeu_pd(d+i,_mm_add_pd(_mm_unpacklo_pd(x0,x1),_mm_unpackhi_pd(x0,x1)));
+	}
+	if (i<n) d[i]=x[i].diam();
+}
+
+double vec_max_diam(const Interval* x, int n) {
+	int i=0;
+	__m128d max=_mm_setzero_pd();
+	if (has_avx2()) max=max_diam_avx2(ptr(x),i=n&~1);
+	for (; i<n; i++) {
+		__m128d v=load(x+i);
+		max=_mm_max_pd(max,_mm_add_pd(v,swap(v)));
+	}
+	return _mm_cvtsd_f64(_mm_max_sd(max,swap(max)));
+}
+
+bool vec_is_subset(const Interval* x, const Interval* y, int n) {
+	int i=0;
+	if (has_avx2() && !is_subset_avx2(ptr(x),ptr(y),i=n&~1)) return false;
+	for (; i<n; i++)
+		if (_mm_movemask_pd(_mm_cmpge_pd(load(y+i),load(x+i)))!=3) return false;
+	return true;
+}
+
+double vec_rel_distance(const Interval* x, const Interval* y, int n) {
+	double max=0;
+	for (int i=0; i<n; i++) {
+		const __m128d xi=load(x+i);
+		const __m128d yi=load(y+i);
+		double cand;
+		if (!bounded(xi,yi))
+			cand=x[i].rel_distance(y[i]);
+		else {
+			// (|lb(x)-lb(y)|,|ub(x)-ub(y)|)
+			__m128d d=_mm_sub_pd(_mm_shuffle_pd(yi,xi,2),_mm_shuffle_pd(xi,yi,2));
+			d=_mm_andnot_pd(_mm_set1_pd(-0.0),d);
+			double dist=_mm_cvtsd_f64(_mm_max_sd(d,swap(d)));
+			double D=_mm_cvtsd_f64(_mm_add_sd(xi,swap(xi)));
+			if (dist==POS_INFINITY) cand=1;
+			else cand=(D==0 || D==POS_INFINITY) ? 0.0 : (dist/D);
+		}
+		if (i==0 || max<cand) max=cand;
+	}
+	return max;
+}
+
+Interval vec_dot(const Interval* x, const Interval* y, int n) {
+	int i=0;
+	__m128d s=_mm_setzero_pd();
+	if (has_avx2()) s=dot_avx2(x,y,i=n&~1);
+	for (; i<n; i++)
+		s=_mm_add_pd(s,mul(x+i,load(x+i),y[i],load(y+i)));
+	Interval res;
+	store(&res,s);
+	return res;
+}
+
+void vec_axpy(Interval* y, const Interval* x, const Interval& a, int n) {
+	int i=0;
+	if (has_avx2()) axpy_avx2(y,x,a,i=n&~1);
+	const __m128d ai=load(&a);
+	for (; i<n; i++)
+		store(y+i,_mm_add_pd(load(y+i),mul(x+i,load(x+i),a,ai)));
+}
+
+#endif
+
+} // end namespace ibex
@@ -140,6 +140,14 @@ public:
 		return std::pair<Backtrackable*,Backtrackable*>(new BisectedVar(var),new BisectedVar(var));
 	}
 
+	void save(std::ostream& os) const {
+		os.write((char*) &var, sizeof(int));
+	}
+
+	void load(std::istream& is) {
+		is.read((char*) &var, sizeof(int));
+	}
+
 	int var;
 };
 
@@ -17,14 +17,37 @@ namespace ibex {
 
 
 pair<IntervalVector,IntervalVector> SmearFunction::bisect(const IntervalVector& box, int& last_var) {
-	IntervalMatrix J(sys.nb_ctr, sys.nb_var);
+	SparseJacobian J(sys.f);
 
 	sys.f.jacobian(box,J);
+
+	bool round_robin=J.is_empty();
+
+	// number of nonzero entries in each column
+	int* col_size = new int[nbvars];
+	for (int j=0; j<nbvars; j++) col_size[j]=0;
+
 	// in case of infinite derivatives  changing to roundrobin bisection
-	for (int i=0;i < sys.nb_ctr;i++)
-		for (int j=0;j < sys.nb_var;j++)
-			if (J[i][j].mag() == POS_INFINITY ||((J[i][j].mag() ==0) && box[j].diam()== POS_INFINITY ))
-				return RoundRobin::bisect(box,last_var);
+	for (int i=0; i<J.nb_rows() && !round_robin; i++)
+		for (int k=0; k<J.row_size(i); k++) {
+			int j=J.col(i,k);
+			if (J(i,k).mag() == POS_INFINITY ||((J(i,k).mag() ==0) && box[j].diam()== POS_INFINITY )) {
+				round_robin=true;
+				break;
+			}
+			col_size[j]++;
+		}
+
+	// same with the zero entries that are not stored in J
+	for (int j=0; j<nbvars && !round_robin; j++)
+		if (col_size[j] < J.nb_rows() && box[j].diam()== POS_INFINITY)
+			round_robin=true;
+
+	delete[] col_size;
+
+	if (round_robin)
+		return RoundRobin::bisect(box,last_var);
+
 	int var = var_to_bisect (J,box);
 	// in case of selected var with infinite domain, change to round-robin bisection
 	if (var == -1 || !(box[var].is_bisectable()))
@@ -33,103 +56,144 @@ pair<IntervalVector,IntervalVector> SmearFunction::bisect(const IntervalVector&
 		return box.bisect(var,ratio);
 }
 
+// Note: the zero entries of J are not stored; their impact is 0.
+
 // computes the variable with the greatest maximal impact
-int SmearMax::var_to_bisect (IntervalMatrix& J, const IntervalVector& box) const {
+int SmearMax::var_to_bisect (SparseJacobian& J, const IntervalVector& box) const {
 	double max_magn = NEG_INFINITY;
 	int var=-1;
+
+	// the maximal impact of each variable
+	double* max_impact = new double[nbvars];
+	for (int j=0; j<nbvars; j++)
+		max_impact[j] = J.nb_rows()>0 ? 0 : NEG_INFINITY;
+
+	for (int i=0; i<J.nb_rows(); i++) {
+		for (int k=0; k<J.row_size(i); k++) {
+			int j=J.col(i,k);
+			if ( J(i,k).mag() * box[j].diam() > max_impact[j] )
+				max_impact[j] = J(i,k).mag() * box[j].diam();
+		}
+	}
+
 	for (int j=0; j<nbvars; j++) {
 		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			for (int i=0; i<sys.nb_ctr; i++) {
-				if ( J[i][j].mag() * box[j].diam() > max_magn ) {
-					max_magn = J[i][j].mag()* box[j].diam();
-					var = j;
-				}
+			if ( max_impact[j] > max_magn ) {
+				max_magn = max_impact[j];
+				var = j;
 			}
 		}
 	}
-
+	delete[] max_impact;
 	return var;
 }
 
 
 // computes the variable with the greatest  sum of impacts
-int SmearSum::var_to_bisect(IntervalMatrix& J,const IntervalVector& box) const {
+int SmearSum::var_to_bisect(SparseJacobian& J, const IntervalVector& box) const {
 	double max_magn = NEG_INFINITY;
 	int var = -1;
 
+	double* sum_smear = new double[nbvars];
+	for (int j=0; j<nbvars; j++) sum_smear[j]=0;
+
+	for (int i=0; i<J.nb_rows(); i++) {
+		for (int k=0; k<J.row_size(i); k++) {
+			int j=J.col(i,k);
+			sum_smear[j]+= J(i,k).mag() *box[j].diam();
+		}
+	}
+
 	for (int j=0; j<nbvars; j++) {
 		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			double sum_smear=0;
-			for (int i=0; i<sys.nb_ctr; i++) {
-				sum_smear+= J[i][j].mag() *box[j].diam();
-			}
-			if (sum_smear > max_magn) {
-				max_magn = sum_smear;
+			if (sum_smear[j] > max_magn) {
+				max_magn = sum_smear[j];
 				var = j;
 			}
 		}
 	}
+	delete[] sum_smear;
 	return var;
 }
 
 
-int SmearSumRelative::var_to_bisect(IntervalMatrix & J, const IntervalVector& box) const {
+int SmearSumRelative::var_to_bisect(SparseJacobian& J, const IntervalVector& box) const {
 	double max_magn = NEG_INFINITY;
 	int var = -1;
 	// the normalizing factor per constraint
-	double* ctrjsum = new double[sys.nb_ctr];
+	double* ctrjsum = new double[J.nb_rows()];
 
-	for (int i=0; i<sys.nb_ctr; i++) {
+	for (int i=0; i<J.nb_rows(); i++) {
 		ctrjsum[i]=0;
-		for (int j=0; j<nbvars ; j++) {
-			ctrjsum[i]+= J[i][j].mag() * box[j].diam();
+		for (int k=0; k<J.row_size(i); k++) {
+			ctrjsum[i]+= J(i,k).mag() * box[J.col(i,k)].diam();
 		}
 	}
+
+	double* sum_smear = new double[nbvars];
+	for (int j=0; j<nbvars; j++) sum_smear[j]=0;
+
+	for (int i=0; i<J.nb_rows(); i++) {
+		if (ctrjsum[i]!=0)
+			for (int k=0; k<J.row_size(i); k++) {
+				int j=J.col(i,k);
+				sum_smear[j]+= J(i,k).mag() * box[j].diam() / ctrjsum[i];
+			}
+	}
+
 	// computes the variable with the maximal sum of normalized impacts
 	for (int j=0; j<nbvars; j++) {
 		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
-			double sum_smear=0;
-			for (int i=0; i<sys.nb_ctr; i++) {
-				if (ctrjsum[i]!=0)
-					sum_smear+= J[i][j].mag() * box[j].diam() / ctrjsum[i];
-			}
-			if (sum_smear > max_magn) {
-				max_magn = sum_smear;
+			if (sum_smear[j] > max_magn) {
+				max_magn = sum_smear[j];
 				var = j;
 			}
 		}
 	}
+	delete[] sum_smear;
 	delete[] ctrjsum;
 	return var;
 }
 
-int SmearMaxRelative::var_to_bisect(IntervalMatrix & J,const IntervalVector& box) const {
+int SmearMaxRelative::var_to_bisect(SparseJacobian& J, const IntervalVector& box) const {
 
 	double max_magn = NEG_INFINITY;
 	int var = -1;
 
-	double* ctrjsum = new double[sys.nb_ctr]; // the normalizing factor per constraint
-	for (int i=0; i<sys.nb_ctr; i++) {
+	double* ctrjsum = new double[J.nb_rows()]; // the normalizing factor per constraint
+	for (int i=0; i<J.nb_rows(); i++) {
 		ctrjsum[i]=0;
-		for (int j=0; j<nbvars ; j++) {
-			ctrjsum[i]+= J[i][j].mag() * box[j].diam() ;
+		for (int k=0; k<J.row_size(i); k++) {
+			ctrjsum[i]+= J(i,k).mag() * box[J.col(i,k)].diam() ;
 		}
 	}
 
+	// the maximal normalized impact of each variable (a constraint
+	// with a normalizing factor of 0 has no impact, as before)
+	double* max_impact = new double[nbvars];
+	for (int j=0; j<nbvars; j++)
+		max_impact[j] = J.nb_rows()>0 ? 0 : NEG_INFINITY;
+
+	for (int i=0; i<J.nb_rows(); i++) {
+		if (ctrjsum[i]!=0)
+			for (int k=0; k<J.row_size(i); k++) {
+				int j=J.col(i,k);
+				double maxsmear = J(i,k).mag() * box[j].diam() / ctrjsum[i];
+				if (maxsmear > max_impact[j])
+					max_impact[j] = maxsmear;
+			}
+	}
+
 	// computes the variable with the greatest normalized impact
-	double maxsmear=0;
 	for (int j=0; j<nbvars; j++) {
-		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j)))
-
-			for (int i=0; i<sys.nb_ctr; i++) {
-				if (ctrjsum[i]!=0)
-					maxsmear = J[i][j].mag() * box[j].diam() / ctrjsum[i];
-				if (maxsmear > max_magn) {
-					max_magn = maxsmear;
-					var = j;
-				}
+		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			if (max_impact[j] > max_magn) {
+				max_magn = max_impact[j];
+				var = j;
 			}
+		}
 	}
+	delete[] max_impact;
 	delete[] ctrjsum;
 	return var;
 }
@@ -64,9 +64,9 @@ public:
 	 *
 	 * Return the index i of the variable with the greatest maximum impact Abs(Dfj/Dxi) * Diam(xi).
 	 *
-	 * \param J the jacobian matrix J
+	 * \param J the jacobian matrix J (in sparse form)
 	 */
-	virtual int var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const=0;
+	virtual int var_to_bisect(SparseJacobian& J, const IntervalVector& box) const=0;
 
 protected :
 	int nbvars;
@@ -111,7 +111,7 @@ public :
 	 *
 	 * \param J the jacobian matrix J
 	 */
-	int var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const;
+	int var_to_bisect(SparseJacobian& J, const IntervalVector& box) const;
 };
 
 /**
@@ -151,7 +151,7 @@ public :
 	 *
 	 * \param J the jacobian matrix J
 	 */
-	int var_to_bisect(IntervalMatrix& J, const IntervalVector& box ) const;
+	int var_to_bisect(SparseJacobian& J, const IntervalVector& box) const;
 };
 
 
@@ -190,7 +190,7 @@ public :
 	 *
 	 * \param J the jacobian matrix J
 	 */
-	int var_to_bisect(IntervalMatrix & J, const IntervalVector& box ) const;
+	int var_to_bisect(SparseJacobian& J, const IntervalVector& box) const;
 };
 
 
@@ -220,7 +220,7 @@ public :
 	 * Returns the variable to bisect : the variable i with the greatest normalized  impact over the constraints fj :  Dfj/Dxi * Diam (xi) / NC(fj) , where NC(fj) = sum(i) Abs(Dfj/Dxi) * Diam(xi)
 	 * \param J the jacobian matrix J
 	 */
-	int var_to_bisect(IntervalMatrix & J, const IntervalVector& box ) const;
+	int var_to_bisect(SparseJacobian& J, const IntervalVector& box) const;
 };
 
 
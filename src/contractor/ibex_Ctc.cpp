@@ -12,6 +12,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_SepCtcPair.h"
 #include "ibex_CtcIdentity.h"
+#include "ibex_Cell.h"
 
 namespace ibex {
 
@@ -64,6 +65,48 @@ void Ctc::contract(IntervalVector& box, const BitSet& impact, BitSet& flags) {
 	_output_flags = NULL;
 }
 
+void Ctc::contract(Cell& cell) {
+	_cell = &cell;
+
+	try {
+		contract(cell.box);
+	}
+	catch (...) {
+		_cell = NULL;
+		throw;
+	}
+
+	_cell = NULL;
+}
+
+void Ctc::contract(Cell& cell, const BitSet& impact) {
+	_cell = &cell;
+
+	try {
+		contract(cell.box,impact);
+	}
+	catch (...) {
+		_cell = NULL;
+		throw;
+	}
+
+	_cell = NULL;
+}
+
+void Ctc::contract(Cell& cell, const BitSet& impact, BitSet& flags) {
+	_cell = &cell;
+
+	try {
+		contract(cell.box,impact,flags);
+	}
+	catch (...) {
+		_cell = NULL;
+		throw;
+	}
+
+	_cell = NULL;
+}
+
 bool Ctc::check_nb_var_ctc_list (const Array<Ctc>& l)  {
 	int i=1, n=l[0].nb_var;
 	while (i<l.size() && l[i].nb_var==n) {
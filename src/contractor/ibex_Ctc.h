@@ -19,6 +19,8 @@
 
 namespace ibex {
 
+class Cell;
+
 /**
  * \defgroup contractor Contractors
  */
@@ -80,6 +82,37 @@ public:
 	 */
 	void contract(IntervalVector& box, const BitSet& impact, BitSet& flags);
 
+	/**
+	 * \brief Contraction of the box of a cell.
+	 *
+	 * During the call to #contract(IntervalVector&), the cell can be
+	 * retrieved with #cell(), so that the contractor can use backtrackable
+	 * data (see #add_backtrackable(Cell&)). By default, this function
+	 * calls contract(cell.box).
+	 */
+	void contract(Cell& cell);
+
+	/**
+	 * \brief Contraction of the box of a cell with specified impact.
+	 *
+	 * \see #contract(Cell&), #contract(IntervalVector&, const BitSet&).
+	 */
+	void contract(Cell& cell, const BitSet& impact);
+
+	/**
+	 * \brief Contraction of the box of a cell with specified impact and output flags.
+	 *
+	 * \see #contract(Cell&), #contract(IntervalVector&, const BitSet&, BitSet&).
+	 */
+	void contract(Cell& cell, const BitSet& impact, BitSet& flags);
+
+	/**
+	 * \brief Add backtrackable data required by this contractor to the root cell.
+	 *
+	 * By default: nothing.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/**
 	 * \brief The number of variables this contractor works with.
 	 */
@@ -125,6 +158,13 @@ protected:
 	 */
 	const BitSet* impact();
 
+	/**
+	 * \brief Return the cell whose box is being contracted (NULL pointer if none).
+	 *
+	 * \see #contract(Cell&).
+	 */
+	Cell* cell();
+
 	/**
 	 * Set an output flag.
 	 */
@@ -139,6 +179,7 @@ protected:
 private:
 	const BitSet* _impact;
 	BitSet* _output_flags;
+	Cell* _cell;
 
 
 };
@@ -150,9 +191,9 @@ private:
 
 
 
-inline Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL) { }
+inline Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL), _cell(NULL) { }
 
-inline Ctc::Ctc(const Array<Ctc>& l) : nb_var(l[0].nb_var), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL) { }
+inline Ctc::Ctc(const Array<Ctc>& l) : nb_var(l[0].nb_var), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL), _cell(NULL) { }
 
 inline Ctc::~Ctc() { }
 
@@ -160,6 +201,12 @@ inline const BitSet* Ctc::impact() {
 	return _impact;
 }
 
+inline Cell* Ctc::cell() {
+	return _cell;
+}
+
+inline void Ctc::add_backtrackable(Cell&) { }
+
 inline void Ctc::set_flag(unsigned int f) {
 	assert(f<NB_OUTPUT_FLAGS);
 	if (_output_flags) _output_flags->add(f);
@@ -377,4 +377,8 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 }
 
 
+void Ctc3BCid::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
 } // end namespace ibex
@@ -113,6 +113,11 @@ class Ctc3BCid : public Ctc {
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add backtrackable data required by the sub-contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
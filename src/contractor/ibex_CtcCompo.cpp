@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_CtcCompo.h"
+#include "ibex_Cell.h"
 
 namespace ibex {
 
@@ -200,13 +201,18 @@ void CtcCompo::contract(IntervalVector& box) {
 
 	BitSet impact(BitSet::all(nb_var)); // always set to "all" for the moment (to be improved later)
 
+	// the cell (if any) is transmitted to the sub-contractors
+	Cell* c=cell() && &cell()->box==&box ? cell() : NULL;
+
 	for (int i=0; i<list.size(); i++) {
 		if (inactive) {
 			flags.clear();
-			list[i].contract(box,impact,flags);
+			if (c) list[i].contract(*c,impact,flags);
+			else list[i].contract(box,impact,flags);
 			if (!flags[INACTIVE]) inactive=false;
 		} else {
-			list[i].contract(box);
+			if (c) list[i].contract(*c);
+			else list[i].contract(box);
 		}
 
 		if (box.is_empty()) {
@@ -218,4 +224,9 @@ void CtcCompo::contract(IntervalVector& box) {
 	if (inactive) set_flag(INACTIVE);
 }
 
+void CtcCompo::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
 } // end namespace ibex
@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_CtcFixPoint.h"
+#include "ibex_Cell.h"
 
 namespace ibex {
 
@@ -27,10 +28,14 @@ void CtcFixPoint::contract(IntervalVector& box) {
 	BitSet flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS));
 	BitSet impact(BitSet::all(nb_var)); // always set to "all" for the moment (to be improved later)
 
+	// the cell (if any) is transmitted to the sub-contractor
+	Cell* c=cell() && &cell()->box==&box ? cell() : NULL;
+
 	do {
 		old_box=box;
 
-		ctc.contract(box,impact,flags);
+		if (c) ctc.contract(*c,impact,flags);
+		else ctc.contract(box,impact,flags);
 
 		if (box.is_empty()) {
 			set_flag(FIXPOINT);
@@ -43,4 +48,8 @@ void CtcFixPoint::contract(IntervalVector& box) {
 	if (flags[INACTIVE] && init_box==box) set_flag(INACTIVE);
 }
 
+void CtcFixPoint::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
 } // end namespace ibex
@@ -44,6 +44,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add backtrackable data required by the sub-contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The sub-contractor */
 	Ctc& ctc;
 
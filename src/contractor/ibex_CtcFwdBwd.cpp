@@ -41,41 +41,41 @@ void int_ctr_domain(Domain& d, CmpOp op) {
 
 } // end anonymous namespace
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const Domain& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const Domain& y, Function::eval_mode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), mode(mode) {
 	assert(f.expr().dim==y.dim);
 	d = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const Interval& y) : Ctc(f.nb_var()), f(f), d(Dim()) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const Interval& y, Function::eval_mode mode) : Ctc(f.nb_var()), f(f), d(Dim()), mode(mode) {
 	assert(f.expr().dim==d.dim);
 	d.i() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalVector& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalVector& y, Function::eval_mode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), mode(mode) {
 	assert(f.expr().dim.is_vector() && f.expr().dim.vec_size()==y.size());
 	d.v() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalMatrix& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalMatrix& y, Function::eval_mode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), mode(mode) {
 	assert(f.expr().dim==Dim::matrix(y.nb_rows(),y.nb_cols()));
 	d.m() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op) : Ctc(f.nb_var()), f(f), d(f.expr().dim)  {
+CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op, Function::eval_mode mode) : Ctc(f.nb_var()), f(f), d(f.expr().dim), mode(mode) {
 	int_ctr_domain(d,op);
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr) : Ctc(ctr.f.nb_var()), f(ctr.f), d(ctr.f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr, Function::eval_mode mode) : Ctc(ctr.f.nb_var()), f(ctr.f), d(ctr.f.expr().dim), mode(mode) {
 	int_ctr_domain(d,ctr.op);
 
 	init();
@@ -104,6 +104,11 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	assert(box.size()==f.nb_var());
 
 	//std::cout << " hc4 of " << f << "=" << d << " with box=" << box << std::endl;
+	if (mode!=Function::NATURAL && (d.dim.is_scalar() || d.dim.is_vector())) {
+		contract_centered(box);
+		return;
+	}
+
 	if (f.backward(d,box)) {
 		set_flag(INACTIVE);
 		set_flag(FIXPOINT);
@@ -119,4 +124,37 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	// may be non-optimal in backward mode.
 }
 
+void CtcFwdBwd::contract_centered(IntervalVector& box) {
+
+	// image of the box
+	IntervalVector y=f.eval_vector(box,mode);
+
+	if (y.is_empty()) {
+		box.set_empty();
+		set_flag(FIXPOINT);
+		return;
+	}
+
+	// the projection is done onto the intersection of y and d
+	Domain yd(d.dim);
+	bool inactive;
+
+	if (d.dim.is_scalar()) {
+		inactive=y[0].is_subset(d.i());
+		yd.i()=y[0] & d.i();
+	} else {
+		inactive=y.is_subset(d.v());
+		yd.v()=y & d.v();
+	}
+
+	if (inactive || f.backward(yd,box)) {
+		set_flag(INACTIVE);
+		set_flag(FIXPOINT);
+	}
+
+	if (box.is_empty()) {
+		set_flag(FIXPOINT);
+	}
+}
+
 } // namespace ibex
@@ -29,34 +29,35 @@ public:
 	 * \brief Build the contractor for "f(x)=0" or "f(x)<=0".
 	 *
 	 * \param op: by default: EQ.
+	 * \param mode: evaluation mode (see #mode).
 	 *
 	 */
-	CtcFwdBwd(Function& f, CmpOp op=EQ);
+	CtcFwdBwd(Function& f, CmpOp op=EQ, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \brief Build the contractor for "f(x) in [y]".
 	 */
-	CtcFwdBwd(Function& f, const Domain& y);
+	CtcFwdBwd(Function& f, const Domain& y, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \brief Build the contractor for "f(x) in [y]".
 	 */
-	CtcFwdBwd(Function& f, const Interval& y);
+	CtcFwdBwd(Function& f, const Interval& y, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \brief Build the contractor for "f(x) in [y]".
 	 */
-	CtcFwdBwd(Function& f, const IntervalVector& y);
+	CtcFwdBwd(Function& f, const IntervalVector& y, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \brief Build the contractor for "f(x) in [y]".
 	 */
-	CtcFwdBwd(Function& f, const IntervalMatrix& y);
+	CtcFwdBwd(Function& f, const IntervalMatrix& y, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \remark ctr is not kept by reference.
 	 */
-	CtcFwdBwd(const NumConstraint& ctr);
+	CtcFwdBwd(const NumConstraint& ctr, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \brief Delete this.
@@ -81,8 +82,26 @@ public:
 	/** The domain "y". */
 	Domain d;
 
+	/**
+	 * \brief Evaluation mode of f.
+	 *
+	 * With a centered form (see #ibex::Function::eval_mode), the image of
+	 * the box is first calculated with this form and the projection is
+	 * done onto its intersection with y. This detects more often that the
+	 * box does not satisfy the constraint or that the constraint is inactive.
+	 *
+	 * Only used if f is real or vector-valued. The value can be fixed by the
+	 * user. By default: NATURAL (HC4Revise alone).
+	 */
+	Function::eval_mode mode;
+
 protected:
 	void init();
+
+	/*
+	 * Contraction with a centered form.
+	 */
+	void contract_centered(IntervalVector& box);
 };
 
 } // namespace ibex
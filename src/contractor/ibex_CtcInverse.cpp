@@ -57,4 +57,8 @@ void CtcInverse::contract(IntervalVector& box) {
 
 }
 
+void CtcInverse::add_backtrackable(Cell& root) {
+	c.add_backtrackable(root);
+}
+
 } // end namespace ibex
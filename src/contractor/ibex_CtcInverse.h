@@ -22,6 +22,11 @@ public:
 	~CtcInverse();
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add backtrackable data required by the sub-contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	Ctc& c;
 	Function& f;
 
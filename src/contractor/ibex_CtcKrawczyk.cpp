@@ -0,0 +1,198 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcKrawczyk.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CtcKrawczyk.h"
+#include "ibex_Cell.h"
+#include "ibex_Linear.h"
+#include "ibex_LinearException.h"
+#include "ibex_Thread.h"
+#include "ibex_Exception.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// atomically incremented (contractors may be created by different threads)
+volatile unsigned long id_count=0;
+
+}
+
+const double CtcKrawczyk::default_ceil = 0.01;
+
+const double CtcKrawczyk::default_refactor_ratio = 0.5;
+
+CtcKrawczyk::CtcKrawczyk(const Function& f, Operator op, double ceil, double prec, double ratio, double refactor_ratio) :
+		Ctc(f.nb_var()), f(f), op(op), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		refactor_ratio(refactor_ratio), nb_precond(0), H(f), C(f.nb_var(),f.nb_var()), C_diam(-1),
+		id(atomic_add(id_count,1UL)-1) {
+
+	if (f.nb_var()!=f.image_dim()) {
+		not_implemented("Krawczyk operator with rectangular systems.");
+	}
+}
+
+CtcKrawczyk::~CtcKrawczyk() {
+
+}
+
+void CtcKrawczyk::add_backtrackable(Cell& root) {
+	root.add<KrawczykPrecond>();
+}
+
+const Matrix& CtcKrawczyk::preconditioner(const IntervalVector& box, const IntervalMatrix& J) {
+	double diam=box.max_diam();
+
+	KrawczykPrecond* data=cell() && cell()->has<KrawczykPrecond>() ? &cell()->get<KrawczykPrecond>() : NULL;
+
+	if (data) {
+		KrawczykPrecond::Shared* s=data->get(id);
+		if (s && diam>=refactor_ratio*s->diam) return s->C;
+	} else {
+		if (C_diam>=0 && diam>=refactor_ratio*C_diam) return C;
+	}
+
+	Matrix C2(nb_var,nb_var);
+	try { real_inverse(J.mid(), C2); }
+	catch (SingularMatrixException&) {
+		try { real_inverse(J.lb(), C2); }
+		catch (SingularMatrixException&) {
+			real_inverse(J.ub(), C2);
+		}
+	}
+	nb_precond++;
+
+	if (data) {
+		KrawczykPrecond::Shared* s=new KrawczykPrecond::Shared(id,C2,diam);
+		data->set(s);
+		return s->C;
+	} else {
+		C=C2;
+		C_diam=diam;
+		return C;
+	}
+}
+
+void CtcKrawczyk::contract(IntervalVector& box) {
+	if (!(box.max_diam()<=ceil)) return;
+
+	int n=nb_var;
+
+	IntervalMatrix J(n,n);
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(n);
+	double gain;
+
+	C_diam=-1; // the preconditioner of the last call is not used
+
+	y1 = box.mid();
+
+	do {
+		f.hansen_matrix(box,H);
+		H.to_dense(J);
+
+		if (J.is_empty()) break;
+
+		mid = box.mid();
+
+		Fmid = f.eval_vector(mid);
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		IntervalVector box2(n);
+
+		try {
+			const Matrix& P=preconditioner(box,J);
+
+			IntervalMatrix PJ=P*J;
+			IntervalVector PF=P*Fmid;
+
+			if (op==HANSEN_SENGUPTA) {
+				gauss_seidel(PJ, PF, y, gauss_seidel_ratio);
+
+				if (y.is_empty()) {
+					box.set_empty();
+					break;
+				}
+				box2=mid-y;
+			} else {
+				// K(x) = mid - P*f(mid) + (I-P*J)(x-mid) with x-mid=-y
+				for (int i=0; i<n; i++) PJ[i][i]-=1.0;
+				box2=mid-PF+PJ*y;
+			}
+		} catch (LinearException& ) {
+			break;
+		}
+
+		if ((box2 &= box).is_empty()) {
+			box.set_empty();
+			break;
+		}
+		gain = box.maxdelta(box2);
+
+		box=box2;
+	}
+	while (gain >= prec);
+
+	if (box.is_empty()) {
+		set_flag(FIXPOINT);
+	}
+}
+
+KrawczykPrecond::Shared::Shared(unsigned long ctc_id, const Matrix& C, double diam) : ctc_id(ctc_id), C(C), diam(diam), ref(1) {
+
+}
+
+KrawczykPrecond::KrawczykPrecond() {
+
+}
+
+KrawczykPrecond::KrawczykPrecond(const KrawczykPrecond& father) : Backtrackable(), shared(father.shared) {
+	for (unsigned int i=0; i<shared.size(); i++)
+		atomic_add(shared[i]->ref,1);
+}
+
+KrawczykPrecond::~KrawczykPrecond() {
+	for (unsigned int i=0; i<shared.size(); i++)
+		release(i);
+}
+
+pair<Backtrackable*,Backtrackable*> KrawczykPrecond::down() {
+	return pair<Backtrackable*,Backtrackable*>(new KrawczykPrecond(*this),new KrawczykPrecond(*this));
+}
+
+KrawczykPrecond::Shared* KrawczykPrecond::get(unsigned long ctc_id) const {
+	for (unsigned int i=0; i<shared.size(); i++)
+		if (shared[i]->ctc_id==ctc_id) return shared[i];
+	return NULL;
+}
+
+void KrawczykPrecond::set(Shared* s) {
+	for (unsigned int i=0; i<shared.size(); i++)
+		if (shared[i]->ctc_id==s->ctc_id) {
+			release(i);
+			shared[i]=s;
+			return;
+		}
+	shared.push_back(s);
+}
+
+void KrawczykPrecond::release(int i) {
+	// the cells that share the preconditioner may be in different threads
+	if (atomic_add(shared[i]->ref,-1)==0)
+		delete shared[i];
+}
+
+} // end namespace ibex
@@ -0,0 +1,192 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcKrawczyk.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_KRAWCZYK_H__
+#define __IBEX_CTC_KRAWCZYK_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Newton.h"
+#include "ibex_SparseJacobian.h"
+#include "ibex_Backtrackable.h"
+
+#include <vector>
+
+namespace ibex {
+
+class CtcKrawczyk;
+
+/** \ingroup contractor
+ *
+ * \brief Krawczyk / Hansen-Sengupta contractor.
+ *
+ * Interval Newton contractor for square systems f(x)=0, where the linearized
+ * system is preconditioned by a real matrix C, the inverse of the midpoint
+ * of the Hansen matrix. Either the Krawczyk operator
+ *
+ *   K(x) = mid - C*f(mid) + (I - C*J)(x - mid)
+ *
+ * or the Hansen-Sengupta operator (Gauss-Seidel applied to the preconditioned
+ * system C*J(x - mid) = -C*f(mid)) is used.
+ *
+ * Contrary to #ibex::CtcNewton, the preconditioner is not recalculated at each
+ * call. Any real matrix being a valid preconditioner, only the strength of the
+ * contraction depends on C. So C is stored in the cell (see #ibex::KrawczykPrecond)
+ * and inherited by the subcells, until the box has shrunk too much with respect to the
+ * box where C was calculated (see #refactor_ratio).
+ *
+ * If the box is not contracted as the box of a cell (see #ibex::Ctc::contract(Cell&)),
+ * the preconditioner is only kept for the iterations of the same call.
+ */
+class CtcKrawczyk : public Ctc {
+public:
+	/**
+	 * \brief The interval Newton operator.
+	 */
+	typedef enum { KRAWCZYK, HANSEN_SENGUPTA } Operator;
+
+	/**
+	 * \brief Build the contractor for f(x)=0.
+	 *
+	 * \param f      - The function (square system).
+	 * \param op     - The operator. By default: Hansen-Sengupta.
+	 * \param ceil   - The contractor is applied only when the diameter of all
+	 *                 components of the box is smaller than \a ceil. Default value is #default_ceil.
+	 * \param prec   - Precision. See #ibex::newton(const Function&, IntervalVector&, double, double).
+	 * \param ratio  - Gauss-Seidel ratio. See #ibex::newton(const Function&, IntervalVector&, double, double).
+	 * \param refactor_ratio - The preconditioner is recalculated when the maximal diameter of
+	 *                 the box is less than \a refactor_ratio times the maximal diameter of the box where
+	 *                 it was calculated. Default value is #default_refactor_ratio.
+	 */
+	CtcKrawczyk(const Function& f, Operator op=HANSEN_SENGUPTA,
+			double ceil=default_ceil,
+			double prec=default_newton_prec,
+			double ratio=default_gauss_seidel_ratio,
+			double refactor_ratio=default_refactor_ratio);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CtcKrawczyk();
+
+	/**
+	 * \brief Contract a box.
+	 */
+	void contract(IntervalVector& box);
+
+	/**
+	 * \brief Add the preconditioner to the root cell.
+	 */
+	void add_backtrackable(Cell& root);
+
+	/** The function. */
+	const Function& f;
+
+	/** The operator. */
+	const Operator op;
+
+	/** Application ceiling. */
+	const double ceil;
+
+	/** Precision. */
+	const double prec;
+
+	/** Gauss-Seidel ratio. */
+	const double gauss_seidel_ratio;
+
+	/** Ratio for recalculating the preconditioner. */
+	const double refactor_ratio;
+
+	/**
+	 * \brief Number of preconditioners calculated so far.
+	 */
+	unsigned long nb_precond;
+
+	/** Initialized to 0.01 */
+	static const double default_ceil;
+
+	/** Initialized to 0.5 */
+	static const double default_refactor_ratio;
+
+private:
+
+	/* Return the preconditioner for the current box (calculate it if necessary).
+	 * Throw SingularMatrixException if no preconditioner can be calculated. */
+	const Matrix& preconditioner(const IntervalVector& box, const IntervalMatrix& J);
+
+	/* Sparse Hansen matrix */
+	SparseJacobian H;
+
+	/* Preconditioner of the current call if the box is not the box of a cell */
+	Matrix C;
+	/* Max diameter of the box where C was calculated (-1 if C is not calculated). */
+	double C_diam;
+
+	/* Identifies the contractor in the preconditioners of a cell. Unlike
+	 * the address, it cannot be reused by a contractor created later. */
+	const unsigned long id;
+};
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Preconditioners of #ibex::CtcKrawczyk (backtrackable data).
+ *
+ * A cell stores one preconditioner per contractor (several Krawczyk
+ * contractors may be applied on the same cell, e.g., in a composition,
+ * or by the different workers of a #ibex::ParallelSolver).
+ * The preconditioners are shared by a cell and its descendants
+ * (nothing is copied when a cell is bisected).
+ */
+class KrawczykPrecond : public Backtrackable {
+public:
+	/**
+	 * \brief Create the data of the root cell (no preconditioner).
+	 */
+	KrawczykPrecond();
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~KrawczykPrecond();
+
+	/**
+	 * \brief Create the data of the subcells (same preconditioner).
+	 */
+	std::pair<Backtrackable*,Backtrackable*> down();
+
+private:
+	friend class CtcKrawczyk;
+
+	/* Share the preconditioner of the father cell */
+	explicit KrawczykPrecond(const KrawczykPrecond& father);
+
+	struct Shared {
+		Shared(unsigned long ctc_id, const Matrix& C, double diam);
+		const unsigned long ctc_id; // id of the contractor which has calculated C
+		const Matrix C;         // the preconditioner
+		const double diam;      // max diameter of the box where C was calculated
+		volatile int ref;       // number of cells that share C
+	};
+
+	/* Return the preconditioner of a contractor, given by its id
+	 * (NULL if not calculated yet) */
+	Shared* get(unsigned long ctc_id) const;
+
+	/* Replace the preconditioner of the contractor s->ctc_id */
+	void set(Shared* s);
+
+	/* Release the preconditioner at position i */
+	void release(int i);
+
+	std::vector<Shared*> shared; // one per contractor (usually, only one)
+};
+
+} // end namespace ibex
+#endif // __IBEX_CTC_KRAWCZYK_H__
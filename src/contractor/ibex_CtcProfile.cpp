@@ -0,0 +1,221 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfile.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include <cstring>
+
+#include "ibex_CtcProfile.h"
+#include "ibex_Cell.h"
+#include "ibex_Thread.h"
+#include "ibex_UnknownFileException.h"
+
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <cmath>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <ctime>
+#else
+#include <time.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const unsigned int CtcProfile::default_sampling=16;
+
+namespace {
+
+/* All the existing profiled contractors, by order of creation */
+vector<CtcProfile*>& profiles() {
+	static vector<CtcProfile*> p;
+	return p;
+}
+
+/* Protects profiles() (contractors may be created in different threads) */
+Mutex& profiles_mutex() {
+	static Mutex m;
+	return m;
+}
+
+/* Number of profiled contractors created so far (atomic) */
+volatile int nb_created=0;
+
+/* Number of cycles since some arbitrary point (0 if not available) */
+inline double rdtsc() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	unsigned int lo,hi;
+	__asm__ __volatile__ ("rdtsc" : "=a"(lo), "=d"(hi));
+	return ((double) hi)*4294967296.0+lo;
+#else
+	return 0;
+#endif
+}
+
+/* Wall-clock and CPU times (in seconds) */
+void now(double& wall, double& cpu) {
+#ifdef _WIN32
+	wall=cpu=((double) clock())/CLOCKS_PER_SEC;
+#else
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	wall=t.tv_sec+1e-9*t.tv_nsec;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+	cpu=t.tv_sec+1e-9*t.tv_nsec;
+#endif
+}
+
+/* Name of a new profiled contractor ("ctc<n>" by default, n being
+ * the number of contractors created before) */
+string new_name(const char* name) {
+	int n=atomic_add(nb_created,1)-1;
+	if (name) return name;
+	ostringstream s;
+	s << "ctc" << n;
+	return s.str();
+}
+
+/* Write a JSON string */
+void write_string(ostream& os, const string& s) {
+	os << '"';
+	for (string::const_iterator it=s.begin(); it!=s.end(); it++) {
+		if (*it=='"' || *it=='\\') os << '\\' << *it;
+		else if (*it=='\n') os << "\\n";
+		else os << *it;
+	}
+	os << '"';
+}
+
+}
+
+CtcProfile::CtcProfile(Ctc& ctc, const char* name, unsigned int sampling) : Ctc(ctc.nb_var), ctc(ctc),
+		name(new_name(name)), sampling(sampling>0? sampling : 1),
+		flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS)), diam(new double[ctc.nb_var]) {
+	reset();
+	Lock l(profiles_mutex());
+	profiles().push_back(this);
+}
+
+CtcProfile::~CtcProfile() {
+	Lock l(profiles_mutex());
+	vector<CtcProfile*>& p=profiles();
+	p.erase(std::remove(p.begin(),p.end(),this),p.end());
+	delete[] diam;
+}
+
+void CtcProfile::reset() {
+	nb_calls=0;
+	nb_empty=0;
+	nb_sampled=0;
+	nb_measured=0;
+	cycles=0;
+	wall_time=0;
+	cpu_time=0;
+	log_reduction=0;
+}
+
+void CtcProfile::call(IntervalVector& box) {
+	// the cell (if any) is transmitted to the sub-contractor
+	Cell* c=cell() && &cell()->box==&box ? cell() : NULL;
+
+	if (impact()) {
+		flags.clear();
+		if (c) ctc.contract(*c,*impact(),flags);
+		else ctc.contract(box,*impact(),flags);
+		if (flags[FIXPOINT]) set_flag(FIXPOINT);
+		if (flags[INACTIVE]) set_flag(INACTIVE);
+	} else {
+		if (c) ctc.contract(*c);
+		else ctc.contract(box);
+	}
+}
+
+void CtcProfile::contract(IntervalVector& box) {
+	bool timed=(nb_calls%sampling==0);
+	nb_calls++;
+
+	if (!timed) {
+		double c0=rdtsc();
+		call(box);
+		cycles+=rdtsc()-c0;
+		if (box.is_empty()) nb_empty++;
+		return;
+	}
+
+	bool empty_before=box.is_empty();
+	if (!empty_before)
+		for (int i=0; i<nb_var; i++) diam[i]=box[i].diam();
+
+	double wall0,cpu0,wall1,cpu1;
+	now(wall0,cpu0);
+	double c0=rdtsc();
+	call(box);
+	cycles+=rdtsc()-c0;
+	now(wall1,cpu1);
+
+	nb_sampled++;
+	wall_time+=wall1-wall0;
+	cpu_time+=cpu1-cpu0;
+
+	if (box.is_empty()) {
+		nb_empty++;
+		return;
+	}
+	if (empty_before) return;
+
+	double r=0;
+	for (int i=0; i<nb_var; i++) {
+		double d=box[i].diam();
+		if (diam[i]>0 && diam[i]<POS_INFINITY && d>0)
+			r+=std::log(diam[i])-std::log(d);
+	}
+	log_reduction+=r;
+	nb_measured++;
+}
+
+void CtcProfile::to_json(ostream& os) const {
+	streamsize prec=os.precision(12);
+	os << "{\"name\": ";
+	write_string(os,name);
+	os << ", \"calls\": " << nb_calls
+	   << ", \"empty\": " << nb_empty
+	   << ", \"sampled\": " << nb_sampled
+	   << ", \"cycles\": " << cycles
+	   << ", \"wall_time\": " << total_wall_time()
+	   << ", \"cpu_time\": " << total_cpu_time()
+	   << ", \"mean_log_reduction\": " << mean_log_reduction() << "}";
+	os.precision(prec);
+}
+
+void CtcProfile::report(ostream& os) {
+	Lock l(profiles_mutex());
+	const vector<CtcProfile*>& p=profiles();
+	os << "{\"contractors\": [";
+	for (vector<CtcProfile*>::const_iterator it=p.begin(); it!=p.end(); it++) {
+		if (it!=p.begin()) os << ",";
+		os << "\n  ";
+		(*it)->to_json(os);
+	}
+	os << "\n]}" << endl;
+}
+
+void CtcProfile::report(const char* filename) {
+	ofstream os(filename);
+	if (!os.is_open()) throw UnknownFileException(filename);
+	report(os);
+}
+
+void CtcProfile::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
+} // end namespace ibex
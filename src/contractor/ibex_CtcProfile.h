@@ -0,0 +1,177 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfile.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_PROFILE_H__
+#define __IBEX_CTC_PROFILE_H__
+
+#include "ibex_Ctc.h"
+
+#include <string>
+#include <iostream>
+
+namespace ibex {
+
+/** \ingroup contractor
+ *
+ * \brief Profiling of a contractor.
+ *
+ * This contractor applies a sub-contractor and records statistics on
+ * its calls: number of calls, number of empty boxes, time spent and
+ * contraction obtained. The statistics of all the profiled contractors
+ * can be written in JSON format with #report(std::ostream&), or
+ * automatically at the end of a search (see #ibex::Solver::profile_file).
+ *
+ * Wrapping each sub-contractor of a composition (#ibex::CtcCompo,
+ * #ibex::CtcFixPoint, etc.) gives the share of each one in the
+ * total time.
+ *
+ * To keep the overhead low, only one call out of #sampling is timed (with the
+ * system clocks) and measured (contraction). The number of calls, of empty
+ * boxes and of processor cycles (on x86 only) are recorded for all calls.
+ *
+ * \note Profiled contractors can be created and deleted in different threads.
+ *       However, the statistics are not protected against concurrent calls: a
+ *       profiled contractor should not be shared by several threads.
+ */
+class CtcProfile : public Ctc {
+public:
+	/**
+	 * \brief Profile \a ctc.
+	 *
+	 * \param ctc      - the sub-contractor
+	 * \param name     - the name of the contractor in the report. By default,
+	 *                   "ctc" followed by a number.
+	 * \param sampling - one call out of \a sampling is timed (1 means all calls).
+	 */
+	CtcProfile(Ctc& ctc, const char* name=NULL, unsigned int sampling=default_sampling);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CtcProfile();
+
+	/**
+	 * \brief Contract the box with the sub-contractor.
+	 */
+	void contract(IntervalVector& box);
+
+	/**
+	 * \brief Add backtrackable data required by the sub-contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Reset the statistics.
+	 */
+	void reset();
+
+	/**
+	 * \brief Estimated wall-clock time of all the calls (in seconds).
+	 */
+	double total_wall_time() const;
+
+	/**
+	 * \brief Estimated CPU time of all the calls (in seconds).
+	 */
+	double total_cpu_time() const;
+
+	/**
+	 * \brief Average contraction of a call.
+	 *
+	 * The contraction is the logarithm of the volume of the box before the
+	 * call, minus the logarithm of the volume after the call. Unbounded and
+	 * degenerated components are ignored, and so are the calls that return
+	 * an empty box.
+	 */
+	double mean_log_reduction() const;
+
+	/**
+	 * \brief Write the statistics of *this (a JSON object).
+	 */
+	void to_json(std::ostream& os) const;
+
+	/**
+	 * \brief Write the statistics of all the existing profiled contractors (JSON).
+	 */
+	static void report(std::ostream& os);
+
+	/**
+	 * \brief Write the statistics of all the existing profiled contractors into a file.
+	 *
+	 * \throw UnknownFileException if the file cannot be created.
+	 */
+	static void report(const char* filename);
+
+	/** The sub-contractor. */
+	Ctc& ctc;
+
+	/** The name of the contractor. */
+	const std::string name;
+
+	/** One call out of #sampling is timed. */
+	const unsigned int sampling;
+
+	/** Number of calls. */
+	unsigned long nb_calls;
+
+	/** Number of calls that returned an empty box. */
+	unsigned long nb_empty;
+
+	/** Number of timed calls. */
+	unsigned long nb_sampled;
+
+	/** Number of processor cycles of all the calls (0 if not available). */
+	double cycles;
+
+	/** Wall-clock time of the timed calls (in seconds). */
+	double wall_time;
+
+	/** CPU time of the timed calls (in seconds). */
+	double cpu_time;
+
+	/** Sum of the contractions of the timed calls that returned a non-empty box. */
+	double log_reduction;
+
+	/** Default sampling: 16. */
+	static const unsigned int default_sampling;
+
+private:
+	CtcProfile(const CtcProfile&);            // forbidden
+	CtcProfile& operator=(const CtcProfile&); // forbidden
+
+	/* Call the sub-contractor with the current impact and output flags. */
+	void call(IntervalVector& box);
+
+	/* Output flags of the sub-contractor */
+	BitSet flags;
+
+	/* Diameters of the box before a timed call */
+	double* diam;
+
+	/* Number of timed calls that returned a non-empty box */
+	unsigned long nb_measured;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline double CtcProfile::total_wall_time() const {
+	return nb_sampled==0? 0 : wall_time*nb_calls/nb_sampled;
+}
+
+inline double CtcProfile::total_cpu_time() const {
+	return nb_sampled==0? 0 : cpu_time*nb_calls/nb_sampled;
+}
+
+inline double CtcProfile::mean_log_reduction() const {
+	return nb_measured==0? 0 : log_reduction/nb_measured;
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_PROFILE_H__
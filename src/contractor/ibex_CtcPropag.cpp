@@ -52,6 +52,9 @@ void CtcPropag::contract(IntervalVector& box) {
 	 */
 	_impact.fill(0,nb_var-1);
 
+	// the cell (if any) is transmitted to the sub-contractors
+	Cell* cc=cell() && &cell()->box==&box ? cell() : NULL;
+
 	// By default, all contractors are active
 	active.fill(0,list.size()-1);
 
@@ -113,7 +116,8 @@ void CtcPropag::contract(IntervalVector& box) {
 		//cout << "Contraction with " << c << endl;
 
 
-		list[c].contract(box, _impact, flags);
+		if (cc) list[c].contract(*cc, _impact, flags);
+		else list[c].contract(box, _impact, flags);
 
 		if (box.is_empty()) {
 			agenda.flush();
@@ -162,4 +166,9 @@ void CtcPropag::contract(IntervalVector& box) {
 
 const double CtcPropag::default_ratio = __IBEX_DEFAULT_RATIO_PROPAG;
 
+void CtcPropag::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
 } // namespace ibex
@@ -59,6 +59,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add backtrackable data required by the sub-contractors.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The list of contractors to propagate */
 	Array<Ctc> list;
 
@@ -28,4 +28,9 @@ void CtcQInter::contract(IntervalVector& box) {
 	box = qinter(refs,q);
 }
 
+void CtcQInter::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
 } // end namespace ibex
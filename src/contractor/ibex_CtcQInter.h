@@ -36,6 +36,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add backtrackable data required by the sub-contractors.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/**
 	 * List of contractors
 	 */
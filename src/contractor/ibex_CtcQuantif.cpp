@@ -55,4 +55,8 @@ void CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
 	y=vars.param_box(fullbox);
 }
 
+void CtcQuantif::add_backtrackable(Cell& root) {
+	ctc->add_backtrackable(root);
+}
+
 } // namespace ibex
@@ -63,6 +63,11 @@ public:
 	 */
 	virtual ~CtcQuantif();
 
+	/**
+	 * \brief Add backtrackable data required by the sub-contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/**
 	 * \brief Initial box of the parameters (can be set dynamically)
 	 */
@@ -144,6 +144,11 @@ void CtcUnion::contract(IntervalVector& box) {
 	}
 
 	box = result;
-} // end namespace ibex
+}
 
+void CtcUnion::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
 }
+
+} // end namespace ibex
@@ -0,0 +1,120 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchEval.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_BatchEval.h"
+
+namespace ibex {
+
+BatchEval::BatchEval(Function& f) : f(f), nb_boxes(0), d(NULL), capacity(0), empty(NULL), X(NULL) {
+	if (!is_supported(f))
+		not_implemented("batch evaluation of functions with non-real arguments or nodes");
+}
+
+BatchEval::~BatchEval() {
+	delete[] d;
+	delete[] empty;
+}
+
+bool BatchEval::is_supported(const Function& f) {
+	if (!f.all_args_scalar()) return false;
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprNode& e=f.node(i);
+		if (dynamic_cast<const ExprApply*>(&e) || dynamic_cast<const ExprIndex*>(&e))
+			return false;
+		if (!e.dim.is_scalar()) {
+			// only the root can be a vector (of real nodes)
+			if (i>0 || !e.dim.is_vector() || !dynamic_cast<const ExprVector*>(&e))
+				return false;
+		}
+	}
+	return true;
+}
+
+void BatchEval::forward(const IntervalMatrix& X) {
+	assert(X.nb_rows()==f.nb_var());
+
+	nb_boxes=X.nb_cols();
+
+	if (nb_boxes>capacity) {
+		delete[] d;
+		delete[] empty;
+		capacity=nb_boxes;
+		d=new Interval[f.nb_nodes()*capacity];
+		empty=new bool[capacity];
+	}
+
+	for (int k=0; k<nb_boxes; k++) empty[k]=false;
+
+	this->X=&X;
+	f.forward<BatchEval>(*this);
+	this->X=NULL;
+}
+
+void BatchEval::eval(const IntervalMatrix& X, IntervalVector& y) {
+	assert(f.expr().dim.is_scalar());
+
+	forward(X);
+
+	y.resize(nb_boxes);
+	Interval* r=(*this)[0];
+	for (int k=0; k<nb_boxes; k++)
+		y[k] = empty[k] ? Interval::EMPTY_SET : r[k];
+}
+
+void BatchEval::eval_vector(const IntervalMatrix& X, IntervalMatrix& Y) {
+	assert(f.expr().dim.is_vector());
+
+	forward(X);
+
+	const ExprVector& v=(const ExprVector&) f.expr();
+
+	Y.resize(v.nb_args,nb_boxes);
+
+	for (int i=0; i<v.nb_args; i++) {
+		Interval* r=(*this)[f.nodes.rank(v.arg(i))];
+		for (int k=0; k<nb_boxes; k++)
+			Y[i][k] = empty[k] ? Interval::EMPTY_SET : r[k];
+	}
+}
+
+void BatchEval::symbol_fwd(int y) {
+	const IntervalVector& x=(*X)[((const ExprSymbol&) f.node(y)).key];
+	Interval* r=(*this)[y];
+	for (int k=0; k<nb_boxes; k++) r[k]=x[k];
+}
+
+void BatchEval::cst_fwd(int y) {
+	const Interval& c=((const ExprConstant&) f.node(y)).get_value();
+	Interval* r=(*this)[y];
+	for (int k=0; k<nb_boxes; k++) r[k]=c;
+}
+
+void BatchEval::vector_fwd(int*, int) {
+	/* nothing to do: the components of the root are read in eval_vector */
+}
+
+void BatchEval::apply_fwd(int*, int)      { assert(false); }
+void BatchEval::index_fwd(int, int)       { assert(false); }
+void BatchEval::trans_V_fwd(int, int)     { assert(false); }
+void BatchEval::trans_M_fwd(int, int)     { assert(false); }
+void BatchEval::add_V_fwd(int, int, int)  { assert(false); }
+void BatchEval::add_M_fwd(int, int, int)  { assert(false); }
+void BatchEval::mul_SV_fwd(int, int, int) { assert(false); }
+void BatchEval::mul_SM_fwd(int, int, int) { assert(false); }
+void BatchEval::mul_VV_fwd(int, int, int) { assert(false); }
+void BatchEval::mul_MV_fwd(int, int, int) { assert(false); }
+void BatchEval::mul_VM_fwd(int, int, int) { assert(false); }
+void BatchEval::mul_MM_fwd(int, int, int) { assert(false); }
+void BatchEval::sub_V_fwd(int, int, int)  { assert(false); }
+void BatchEval::sub_M_fwd(int, int, int)  { assert(false); }
+
+} // namespace ibex
@@ -0,0 +1,229 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchEval.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_EVAL_H__
+#define __IBEX_BATCH_EVAL_H__
+
+#include "ibex_FwdAlgorithm.h"
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ * \brief Evaluation of a function on many boxes at once.
+ *
+ * The boxes are given in structure-of-arrays layout: the jth row of a matrix X
+ * contains the domains of the jth variable, and the kth column is the kth box.
+ *
+ * The compiled code of the function is run only once: each operation is applied
+ * to the domains of all the boxes, which are stored contiguously. The result
+ * is the same as #ibex::Eval applied to each box.
+ *
+ * Only functions with real arguments and real nodes are supported. The root
+ * node can also be a vector of real nodes (e.g., Return(f1,f2)).
+ */
+class BatchEval : public FwdAlgorithm {
+public:
+	/**
+	 * \brief Build the evaluator.
+	 *
+	 * \pre f must be supported (see #is_supported(const Function&)).
+	 */
+	BatchEval(Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BatchEval();
+
+	/**
+	 * \brief True if the function can be evaluated by a BatchEval.
+	 */
+	static bool is_supported(const Function& f);
+
+	/**
+	 * \brief Evaluate a real-valued function on the columns of X.
+	 *
+	 * y[k] is set to the image of the kth box (the kth column of X).
+	 */
+	void eval(const IntervalMatrix& X, IntervalVector& y);
+
+	/**
+	 * \brief Evaluate a vector-valued function on the columns of X.
+	 *
+	 * The kth column of Y is set to the image of the kth box.
+	 */
+	void eval_vector(const IntervalMatrix& X, IntervalMatrix& Y);
+
+	/**
+	 * \brief Domains of the ith node (one per box).
+	 */
+	Interval* operator[](int i);
+
+	/**
+	 * \brief True if the evaluation of the kth box of the
+	 * last batch is empty.
+	 */
+	bool is_empty(int k) const;
+
+	/**
+	 * \brief The function.
+	 */
+	Function& f;
+
+	/**
+	 * \brief Number of boxes of the last batch.
+	 */
+	int nb_boxes;
+
+protected:
+	friend class BatchHC4Revise;
+
+	/*
+	 * Run the compiled code on the columns of X.
+	 */
+	void forward(const IntervalMatrix& X);
+
+	/* domains of all the nodes, "capacity" intervals per node */
+	Interval* d;
+
+	/* maximal number of boxes (storage allocated) */
+	int capacity;
+
+	/* whether the evaluation is empty for each box */
+	bool* empty;
+
+	/* the current batch */
+	const IntervalMatrix* X;
+
+public: // because called from CompiledFunction
+
+	       void vector_fwd (int* x, int y);
+	       void apply_fwd  (int* x, int y);
+	       void index_fwd  (int x, int y);
+	       void symbol_fwd (int y);
+	       void cst_fwd    (int y);
+	inline void chi_fwd    (int x1, int x2, int x3, int y);
+	inline void add_fwd    (int x1, int x2, int y);
+	inline void mul_fwd    (int x1, int x2, int y);
+	inline void sub_fwd    (int x1, int x2, int y);
+	inline void div_fwd    (int x1, int x2, int y);
+	inline void max_fwd    (int x1, int x2, int y);
+	inline void min_fwd    (int x1, int x2, int y);
+	inline void atan2_fwd  (int x1, int x2, int y);
+	inline void minus_fwd  (int x, int y);
+	       void trans_V_fwd(int x, int y);
+	       void trans_M_fwd(int x, int y);
+	inline void sign_fwd   (int x, int y);
+	inline void abs_fwd    (int x, int y);
+	inline void power_fwd  (int x, int y, int p);
+	inline void sqr_fwd    (int x, int y);
+	inline void sqrt_fwd   (int x, int y);
+	inline void exp_fwd    (int x, int y);
+	inline void log_fwd    (int x, int y);
+	inline void cos_fwd    (int x, int y);
+	inline void sin_fwd    (int x, int y);
+	inline void tan_fwd    (int x, int y);
+	inline void cosh_fwd   (int x, int y);
+	inline void sinh_fwd   (int x, int y);
+	inline void tanh_fwd   (int x, int y);
+	inline void acos_fwd   (int x, int y);
+	inline void asin_fwd   (int x, int y);
+	inline void atan_fwd   (int x, int y);
+	inline void acosh_fwd  (int x, int y);
+	inline void asinh_fwd  (int x, int y);
+	inline void atanh_fwd  (int x, int y);
+	       void add_V_fwd  (int x1, int x2, int y);
+	       void add_M_fwd  (int x1, int x2, int y);
+	       void mul_SV_fwd (int x1, int x2, int y);
+	       void mul_SM_fwd (int x1, int x2, int y);
+	       void mul_VV_fwd (int x1, int x2, int y);
+	       void mul_MV_fwd (int x1, int x2, int y);
+	       void mul_VM_fwd (int x1, int x2, int y);
+	       void mul_MM_fwd (int x1, int x2, int y);
+	       void sub_V_fwd  (int x1, int x2, int y);
+	       void sub_M_fwd  (int x1, int x2, int y);
+
+private:
+	BatchEval(const BatchEval&);            // forbidden
+	BatchEval& operator=(const BatchEval&); // forbidden
+};
+
+/* ============================================================================
+ 	 	 	 	 	 	 	 implementation
+  ============================================================================*/
+
+inline Interval* BatchEval::operator[](int i) {
+	return d+i*capacity;
+}
+
+inline bool BatchEval::is_empty(int k) const {
+	assert(k>=0 && k<nb_boxes);
+	return empty[k];
+}
+
+/* note: the loops below are left simple so that the compiler can vectorize them */
+
+#define IBEX_BATCH_BINARY(op) \
+	Interval *a=(*this)[x1], *b=(*this)[x2], *r=(*this)[y]; \
+	for (int k=0; k<nb_boxes; k++) r[k]=op;
+
+#define IBEX_BATCH_UNARY(op) \
+	Interval *a=(*this)[x], *r=(*this)[y]; \
+	for (int k=0; k<nb_boxes; k++) r[k]=op;
+
+/* for operators whose result can be empty on a non-empty argument */
+#define IBEX_BATCH_UNARY_CHECK(op) \
+	Interval *a=(*this)[x], *r=(*this)[y]; \
+	for (int k=0; k<nb_boxes; k++) if ((r[k]=op).is_empty()) empty[k]=true;
+
+inline void BatchEval::chi_fwd(int x1, int x2, int x3, int y) {
+	Interval *a=(*this)[x1], *b=(*this)[x2], *c=(*this)[x3], *r=(*this)[y];
+	for (int k=0; k<nb_boxes; k++) r[k]=chi(a[k],b[k],c[k]);
+}
+
+inline void BatchEval::add_fwd(int x1, int x2, int y)   { IBEX_BATCH_BINARY(a[k]+b[k]) }
+inline void BatchEval::mul_fwd(int x1, int x2, int y)   { IBEX_BATCH_BINARY(a[k]*b[k]) }
+inline void BatchEval::sub_fwd(int x1, int x2, int y)   { IBEX_BATCH_BINARY(a[k]-b[k]) }
+inline void BatchEval::div_fwd(int x1, int x2, int y)   { IBEX_BATCH_BINARY(a[k]/b[k]) }
+inline void BatchEval::max_fwd(int x1, int x2, int y)   { IBEX_BATCH_BINARY(max(a[k],b[k])) }
+inline void BatchEval::min_fwd(int x1, int x2, int y)   { IBEX_BATCH_BINARY(min(a[k],b[k])) }
+inline void BatchEval::atan2_fwd(int x1, int x2, int y) { IBEX_BATCH_BINARY(atan2(a[k],b[k])) }
+inline void BatchEval::minus_fwd(int x, int y)          { IBEX_BATCH_UNARY(-a[k]) }
+inline void BatchEval::sign_fwd(int x, int y)           { IBEX_BATCH_UNARY(sign(a[k])) }
+inline void BatchEval::abs_fwd(int x, int y)            { IBEX_BATCH_UNARY(abs(a[k])) }
+inline void BatchEval::power_fwd(int x, int y, int p)   { IBEX_BATCH_UNARY(pow(a[k],p)) }
+inline void BatchEval::sqr_fwd(int x, int y)            { IBEX_BATCH_UNARY(sqr(a[k])) }
+inline void BatchEval::sqrt_fwd(int x, int y)           { IBEX_BATCH_UNARY_CHECK(sqrt(a[k])) }
+inline void BatchEval::exp_fwd(int x, int y)            { IBEX_BATCH_UNARY(exp(a[k])) }
+inline void BatchEval::log_fwd(int x, int y)            { IBEX_BATCH_UNARY_CHECK(log(a[k])) }
+inline void BatchEval::cos_fwd(int x, int y)            { IBEX_BATCH_UNARY(cos(a[k])) }
+inline void BatchEval::sin_fwd(int x, int y)            { IBEX_BATCH_UNARY(sin(a[k])) }
+inline void BatchEval::tan_fwd(int x, int y)            { IBEX_BATCH_UNARY_CHECK(tan(a[k])) }
+inline void BatchEval::cosh_fwd(int x, int y)           { IBEX_BATCH_UNARY(cosh(a[k])) }
+inline void BatchEval::sinh_fwd(int x, int y)           { IBEX_BATCH_UNARY(sinh(a[k])) }
+inline void BatchEval::tanh_fwd(int x, int y)           { IBEX_BATCH_UNARY(tanh(a[k])) }
+inline void BatchEval::acos_fwd(int x, int y)           { IBEX_BATCH_UNARY_CHECK(acos(a[k])) }
+inline void BatchEval::asin_fwd(int x, int y)           { IBEX_BATCH_UNARY_CHECK(asin(a[k])) }
+inline void BatchEval::atan_fwd(int x, int y)           { IBEX_BATCH_UNARY(atan(a[k])) }
+inline void BatchEval::acosh_fwd(int x, int y)          { IBEX_BATCH_UNARY_CHECK(acosh(a[k])) }
+inline void BatchEval::asinh_fwd(int x, int y)          { IBEX_BATCH_UNARY(asinh(a[k])) }
+inline void BatchEval::atanh_fwd(int x, int y)          { IBEX_BATCH_UNARY_CHECK(atanh(a[k])) }
+
+#undef IBEX_BATCH_BINARY
+#undef IBEX_BATCH_UNARY
+#undef IBEX_BATCH_UNARY_CHECK
+
+} // namespace ibex
+
+#endif // __IBEX_BATCH_EVAL_H__
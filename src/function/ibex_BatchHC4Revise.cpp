@@ -0,0 +1,130 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchHC4Revise.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_BatchHC4Revise.h"
+
+namespace ibex {
+
+BatchHC4Revise::BatchHC4Revise(BatchEval& e) : f(e.f), eval(e), status(NULL), capacity(0) {
+
+}
+
+BatchHC4Revise::~BatchHC4Revise() {
+	delete[] status;
+}
+
+void BatchHC4Revise::proj(const Interval& y, IntervalMatrix& X) {
+	assert(f.expr().dim.is_scalar());
+
+	eval.forward(X);
+
+	int n=eval.nb_boxes;
+	if (n>capacity) {
+		delete[] status;
+		capacity=n;
+		status=new char[capacity];
+	}
+
+	Interval* root=eval[0];
+
+	for (int k=0; k<n; k++) {
+		if (eval.empty[k] || root[k].is_empty())
+			status[k]=EMPTY;
+		else if (root[k].is_subset(y))
+			status[k]=INNER;
+		else if ((root[k] &= y).is_empty())
+			status[k]=EMPTY;
+		else
+			status[k]=ACTIVE;
+	}
+
+	backward(X);
+}
+
+void BatchHC4Revise::proj(const IntervalVector& y, IntervalMatrix& X) {
+	assert(f.expr().dim.is_vector());
+
+	eval.forward(X);
+
+	int n=eval.nb_boxes;
+	if (n>capacity) {
+		delete[] status;
+		capacity=n;
+		status=new char[capacity];
+	}
+
+	const ExprVector& v=(const ExprVector&) f.expr();
+	assert(y.size()==v.nb_args);
+
+	for (int k=0; k<n; k++) {
+		status[k]=eval.empty[k]? EMPTY : INNER;
+	}
+
+	for (int i=0; i<v.nb_args; i++) {
+		Interval* r=eval[f.nodes.rank(v.arg(i))];
+		for (int k=0; k<n; k++) {
+			if (status[k]==EMPTY) continue;
+			if (r[k].is_empty()) status[k]=EMPTY;
+			else if (status[k]==INNER && !r[k].is_subset(y[i])) status[k]=ACTIVE;
+		}
+	}
+
+	for (int i=0; i<v.nb_args; i++) {
+		Interval* r=eval[f.nodes.rank(v.arg(i))];
+		for (int k=0; k<n; k++)
+			if (status[k]==ACTIVE && (r[k] &= y[i]).is_empty()) status[k]=EMPTY;
+	}
+
+	backward(X);
+}
+
+void BatchHC4Revise::backward(IntervalMatrix& X) {
+	int n=eval.nb_boxes;
+
+	bool active=false;
+	for (int k=0; k<n; k++)
+		if (status[k]==ACTIVE) { active=true; break; }
+
+	if (active) f.backward<BatchHC4Revise>(*this);
+
+	// write the domains of the symbols in X
+	for (int i=0; i<f.nb_arg(); i++) {
+		Interval* r=eval[f.nodes.rank(f.arg(i))];
+		IntervalVector& x=X[i];
+		for (int k=0; k<n; k++)
+			if (status[k]==ACTIVE) x[k]=r[k];
+	}
+
+	for (int k=0; k<n; k++) {
+		if (status[k]==EMPTY)
+			for (int i=0; i<f.nb_arg(); i++) X[i][k].set_empty();
+	}
+}
+
+void BatchHC4Revise::vector_bwd(int*, int) {
+	/* nothing to do: the components of the root are contracted in proj */
+}
+
+void BatchHC4Revise::apply_bwd(int*, int)       { assert(false); }
+void BatchHC4Revise::add_V_bwd(int, int, int)   { assert(false); }
+void BatchHC4Revise::add_M_bwd(int, int, int)   { assert(false); }
+void BatchHC4Revise::mul_SV_bwd(int, int, int)  { assert(false); }
+void BatchHC4Revise::mul_SM_bwd(int, int, int)  { assert(false); }
+void BatchHC4Revise::mul_VV_bwd(int, int, int)  { assert(false); }
+void BatchHC4Revise::mul_MV_bwd(int, int, int)  { assert(false); }
+void BatchHC4Revise::mul_VM_bwd(int, int, int)  { assert(false); }
+void BatchHC4Revise::mul_MM_bwd(int, int, int)  { assert(false); }
+void BatchHC4Revise::sub_V_bwd(int, int, int)   { assert(false); }
+void BatchHC4Revise::sub_M_bwd(int, int, int)   { assert(false); }
+void BatchHC4Revise::trans_V_bwd(int, int)      { assert(false); }
+void BatchHC4Revise::trans_M_bwd(int, int)      { assert(false); }
+
+} // namespace ibex
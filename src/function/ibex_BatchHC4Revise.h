@@ -0,0 +1,216 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchHC4Revise.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_HC4_REVISE_H__
+#define __IBEX_BATCH_HC4_REVISE_H__
+
+#include "ibex_BatchEval.h"
+#include "ibex_BwdAlgorithm.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Forward-backward contraction of many boxes at once.
+ *
+ * The boxes are the columns of a matrix (see #ibex::BatchEval).
+ * The result is the same as #ibex::HC4Revise applied to each box.
+ */
+class BatchHC4Revise : public BwdAlgorithm {
+public:
+
+	/**
+	 * \brief Build the algorithm.
+	 *
+	 * For memory saving, the algorithm is built from an
+	 * already existing batch evaluator "e".
+	 */
+	BatchHC4Revise(BatchEval& e);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BatchHC4Revise();
+
+	/**
+	 * \brief Contract each column of X w.r.t. f(x)=y.
+	 *
+	 * A box with no solution is set to the empty box.
+	 * A box whose image is included in y is not contracted.
+	 *
+	 * \pre f is real-valued.
+	 */
+	void proj(const Interval& y, IntervalMatrix& X);
+
+	/**
+	 * \brief Contract each column of X w.r.t. f(x)=y.
+	 *
+	 * \pre f is vector-valued.
+	 */
+	void proj(const IntervalVector& y, IntervalMatrix& X);
+
+	/**
+	 * \brief True if the image of the kth box of the
+	 * last batch is included in y.
+	 */
+	bool is_inner(int k) const;
+
+	/**
+	 * The function.
+	 */
+	Function& f;
+
+	/**
+	 * The evaluator.
+	 */
+	BatchEval& eval;
+
+protected:
+	/*
+	 * Status of the boxes
+	 */
+	enum { ACTIVE, EMPTY, INNER };
+
+	/*
+	 * Run the backward step on the active boxes and
+	 * write the result in X.
+	 */
+	void backward(IntervalMatrix& X);
+
+	/* status of each box */
+	char* status;
+
+	/* allocated size of "status" */
+	int capacity;
+
+public: // because called from CompiledFunction
+	inline void index_bwd  (int, int)          { /* nothing to do */ }
+	       void vector_bwd (int* x, int y);
+	inline void symbol_bwd (int)               { /* nothing to do */ }
+	inline void cst_bwd    (int)               { /* nothing to do */ }
+	       void apply_bwd  (int* x, int y);
+	inline void chi_bwd    (int a, int b, int c, int y);
+	inline void add_bwd    (int x1, int x2, int y);
+	       void add_V_bwd  (int x1, int x2, int y);
+	       void add_M_bwd  (int x1, int x2, int y);
+	inline void mul_bwd    (int x1, int x2, int y);
+	       void mul_SV_bwd (int x1, int x2, int y);
+	       void mul_SM_bwd (int x1, int x2, int y);
+	       void mul_VV_bwd (int x1, int x2, int y);
+	       void mul_MV_bwd (int x1, int x2, int y);
+	       void mul_VM_bwd (int x1, int x2, int y);
+	       void mul_MM_bwd (int x1, int x2, int y);
+	inline void sub_bwd    (int x1, int x2, int y);
+	       void sub_V_bwd  (int x1, int x2, int y);
+	       void sub_M_bwd  (int x1, int x2, int y);
+	inline void div_bwd    (int x1, int x2, int y);
+	inline void max_bwd    (int x1, int x2, int y);
+	inline void min_bwd    (int x1, int x2, int y);
+	inline void atan2_bwd  (int x1, int x2, int y);
+	inline void minus_bwd  (int x, int y);
+	       void trans_V_bwd(int x, int y);
+	       void trans_M_bwd(int x, int y);
+	inline void sign_bwd   (int x, int y);
+	inline void abs_bwd    (int x, int y);
+	inline void power_bwd  (int x, int y, int p);
+	inline void sqr_bwd    (int x, int y);
+	inline void sqrt_bwd   (int x, int y);
+	inline void exp_bwd    (int x, int y);
+	inline void log_bwd    (int x, int y);
+	inline void cos_bwd    (int x, int y);
+	inline void sin_bwd    (int x, int y);
+	inline void tan_bwd    (int x, int y);
+	inline void cosh_bwd   (int x, int y);
+	inline void sinh_bwd   (int x, int y);
+	inline void tanh_bwd   (int x, int y);
+	inline void acos_bwd   (int x, int y);
+	inline void asin_bwd   (int x, int y);
+	inline void atan_bwd   (int x, int y);
+	inline void acosh_bwd  (int x, int y);
+	inline void asinh_bwd  (int x, int y);
+	inline void atanh_bwd  (int x, int y);
+
+private:
+	BatchHC4Revise(const BatchHC4Revise&);            // forbidden
+	BatchHC4Revise& operator=(const BatchHC4Revise&); // forbidden
+};
+
+/* ============================================================================
+ 	 	 	 	 	 	 	 implementation
+  ============================================================================*/
+
+inline bool BatchHC4Revise::is_inner(int k) const {
+	assert(k>=0 && k<eval.nb_boxes);
+	return status[k]==INNER;
+}
+
+/* a box becomes empty as soon as one projection fails */
+
+#define IBEX_BATCH_BWD_BINARY(bwd) \
+	Interval *a=eval[x1], *b=eval[x2], *r=eval[y]; \
+	for (int k=0; k<eval.nb_boxes; k++) \
+		if (status[k]==ACTIVE && !bwd(r[k],a[k],b[k])) status[k]=EMPTY;
+
+#define IBEX_BATCH_BWD_UNARY(bwd) \
+	Interval *a=eval[x], *r=eval[y]; \
+	for (int k=0; k<eval.nb_boxes; k++) \
+		if (status[k]==ACTIVE && !bwd(r[k],a[k])) status[k]=EMPTY;
+
+inline void BatchHC4Revise::chi_bwd(int a, int b, int c, int y) {
+	Interval *xa=eval[a], *xb=eval[b], *xc=eval[c], *r=eval[y];
+	for (int k=0; k<eval.nb_boxes; k++)
+		if (status[k]==ACTIVE && !bwd_chi(r[k],xa[k],xb[k],xc[k])) status[k]=EMPTY;
+}
+
+inline void BatchHC4Revise::add_bwd(int x1, int x2, int y)   { IBEX_BATCH_BWD_BINARY(bwd_add) }
+inline void BatchHC4Revise::mul_bwd(int x1, int x2, int y)   { IBEX_BATCH_BWD_BINARY(bwd_mul) }
+inline void BatchHC4Revise::sub_bwd(int x1, int x2, int y)   { IBEX_BATCH_BWD_BINARY(bwd_sub) }
+inline void BatchHC4Revise::div_bwd(int x1, int x2, int y)   { IBEX_BATCH_BWD_BINARY(bwd_div) }
+inline void BatchHC4Revise::max_bwd(int x1, int x2, int y)   { IBEX_BATCH_BWD_BINARY(bwd_max) }
+inline void BatchHC4Revise::min_bwd(int x1, int x2, int y)   { IBEX_BATCH_BWD_BINARY(bwd_min) }
+inline void BatchHC4Revise::atan2_bwd(int x1, int x2, int y) { IBEX_BATCH_BWD_BINARY(bwd_atan2) }
+
+inline void BatchHC4Revise::minus_bwd(int x, int y) {
+	Interval *a=eval[x], *r=eval[y];
+	for (int k=0; k<eval.nb_boxes; k++)
+		if (status[k]==ACTIVE && (a[k] &= -r[k]).is_empty()) status[k]=EMPTY;
+}
+
+inline void BatchHC4Revise::power_bwd(int x, int y, int p) {
+	Interval *a=eval[x], *r=eval[y];
+	for (int k=0; k<eval.nb_boxes; k++)
+		if (status[k]==ACTIVE && !bwd_pow(r[k],p,a[k])) status[k]=EMPTY;
+}
+
+inline void BatchHC4Revise::sign_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_sign) }
+inline void BatchHC4Revise::abs_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_abs) }
+inline void BatchHC4Revise::sqr_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_sqr) }
+inline void BatchHC4Revise::sqrt_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_sqrt) }
+inline void BatchHC4Revise::exp_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_exp) }
+inline void BatchHC4Revise::log_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_log) }
+inline void BatchHC4Revise::cos_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_cos) }
+inline void BatchHC4Revise::sin_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_sin) }
+inline void BatchHC4Revise::tan_bwd(int x, int y)   { IBEX_BATCH_BWD_UNARY(bwd_tan) }
+inline void BatchHC4Revise::cosh_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_cosh) }
+inline void BatchHC4Revise::sinh_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_sinh) }
+inline void BatchHC4Revise::tanh_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_tanh) }
+inline void BatchHC4Revise::acos_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_acos) }
+inline void BatchHC4Revise::asin_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_asin) }
+inline void BatchHC4Revise::atan_bwd(int x, int y)  { IBEX_BATCH_BWD_UNARY(bwd_atan) }
+inline void BatchHC4Revise::acosh_bwd(int x, int y) { IBEX_BATCH_BWD_UNARY(bwd_acosh) }
+inline void BatchHC4Revise::asinh_bwd(int x, int y) { IBEX_BATCH_BWD_UNARY(bwd_asinh) }
+inline void BatchHC4Revise::atanh_bwd(int x, int y) { IBEX_BATCH_BWD_UNARY(bwd_atanh) }
+
+#undef IBEX_BATCH_BWD_BINARY
+#undef IBEX_BATCH_BWD_UNARY
+
+} // namespace ibex
+
+#endif // __IBEX_BATCH_HC4_REVISE_H__
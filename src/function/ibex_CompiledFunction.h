@@ -54,6 +54,13 @@ public:
 	template<class V>
 	void forward(const V& algo) const;
 
+	/**
+	 * Run the forward phase of a forward algorithm
+	 * on the ith node only.
+	 */
+	template<class V>
+	void forward(const V& algo, int i) const;
+
 	/**
 	 * Run the backward phase.  V must be a subclass of BwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
@@ -157,54 +164,59 @@ void CompiledFunction::forward(const V& algo) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
 
 	for (int i=n-1; i>=0; i--) {
-		switch(code[i]) {
-		case IDX:    ((V&) algo).index_fwd  (args[i][0], i); break;
-		case VEC:    ((V&) algo).vector_fwd (args[i], i); break;
-		case SYM:    ((V&) algo).symbol_fwd (i); break;
-		case CST:    ((V&) algo).cst_fwd    (i); break;
-		case APPLY:  ((V&) algo).apply_fwd  (args[i],i); break;
-		case CHI:    ((V&) algo).chi_fwd    (args[i][0], args[i][1], args[i][2], i); break;
-		case ADD:    ((V&) algo).add_fwd    (args[i][0], args[i][1], i); break;
-		case ADD_V:  ((V&) algo).add_V_fwd  (args[i][0], args[i][1], i); break;
-		case ADD_M:  ((V&) algo).add_M_fwd  (args[i][0], args[i][1], i); break;
-		case MUL:    ((V&) algo).mul_fwd    (args[i][0], args[i][1], i); break;
-		case MUL_SV: ((V&) algo).mul_SV_fwd (args[i][0], args[i][1], i); break;
-		case MUL_SM: ((V&) algo).mul_SM_fwd (args[i][0], args[i][1], i); break;
-		case MUL_VV: ((V&) algo).mul_VV_fwd (args[i][0], args[i][1], i); break;
-		case MUL_MV: ((V&) algo).mul_MV_fwd (args[i][0], args[i][1], i); break;
-		case MUL_MM: ((V&) algo).mul_MM_fwd (args[i][0], args[i][1], i); break;
-		case MUL_VM: ((V&) algo).mul_VM_fwd (args[i][0], args[i][1], i); break;
-		case SUB:    ((V&) algo).sub_fwd    (args[i][0], args[i][1], i); break;
-		case SUB_V:  ((V&) algo).sub_V_fwd  (args[i][0], args[i][1], i); break;
-		case SUB_M:  ((V&) algo).sub_M_fwd  (args[i][0], args[i][1], i); break;
-		case DIV:    ((V&) algo).div_fwd    (args[i][0], args[i][1], i); break;
-		case MAX:    ((V&) algo).max_fwd    (args[i][0], args[i][1], i); break;
-		case MIN:    ((V&) algo).min_fwd    (args[i][0], args[i][1], i); break;
-		case ATAN2:  ((V&) algo).atan2_fwd  (args[i][0], args[i][1], i); break;
-		case MINUS:  ((V&) algo).minus_fwd  (args[i][0], i); break;
-		case TRANS_V:((V&) algo).trans_V_fwd(args[i][0], i); break;
-		case TRANS_M:((V&) algo).trans_M_fwd(args[i][0], i); break;
-		case SIGN:   ((V&) algo).sign_fwd   (args[i][0], i); break;
-		case ABS:    ((V&) algo).abs_fwd    (args[i][0], i); break;
-		case POWER:  ((V&) algo).power_fwd  (args[i][0], i, ((const ExprPower&) (*nodes)[i]).expon); break;
-		case SQR:    ((V&) algo).sqr_fwd    (args[i][0], i); break;
-		case SQRT:   ((V&) algo).sqrt_fwd   (args[i][0], i); break;
-		case EXP:    ((V&) algo).exp_fwd    (args[i][0], i); break;
-		case LOG:    ((V&) algo).log_fwd    (args[i][0], i); break;
-		case COS:    ((V&) algo).cos_fwd    (args[i][0], i); break;
-		case SIN:    ((V&) algo).sin_fwd    (args[i][0], i); break;
-		case TAN:    ((V&) algo).tan_fwd    (args[i][0], i); break;
-		case COSH:   ((V&) algo).cosh_fwd   (args[i][0], i); break;
-		case SINH:   ((V&) algo).sinh_fwd   (args[i][0], i); break;
-		case TANH:   ((V&) algo).tanh_fwd   (args[i][0], i); break;
-		case ACOS:   ((V&) algo).acos_fwd   (args[i][0], i); break;
-		case ASIN:   ((V&) algo).asin_fwd   (args[i][0], i); break;
-		case ATAN:   ((V&) algo).atan_fwd   (args[i][0], i); break;
-		case ACOSH:  ((V&) algo).acosh_fwd  (args[i][0], i); break;
-		case ASINH:  ((V&) algo).asinh_fwd  (args[i][0], i); break;
-		case ATANH:  ((V&) algo).atanh_fwd  (args[i][0], i); break;
-		default: 	 assert(false);
-		}
+		forward<V>(algo,i);
+	}
+}
+
+template<class V>
+inline void CompiledFunction::forward(const V& algo, int i) const {
+	switch(code[i]) {
+	case IDX:    ((V&) algo).index_fwd  (args[i][0], i); break;
+	case VEC:    ((V&) algo).vector_fwd (args[i], i); break;
+	case SYM:    ((V&) algo).symbol_fwd (i); break;
+	case CST:    ((V&) algo).cst_fwd    (i); break;
+	case APPLY:  ((V&) algo).apply_fwd  (args[i],i); break;
+	case CHI:    ((V&) algo).chi_fwd    (args[i][0], args[i][1], args[i][2], i); break;
+	case ADD:    ((V&) algo).add_fwd    (args[i][0], args[i][1], i); break;
+	case ADD_V:  ((V&) algo).add_V_fwd  (args[i][0], args[i][1], i); break;
+	case ADD_M:  ((V&) algo).add_M_fwd  (args[i][0], args[i][1], i); break;
+	case MUL:    ((V&) algo).mul_fwd    (args[i][0], args[i][1], i); break;
+	case MUL_SV: ((V&) algo).mul_SV_fwd (args[i][0], args[i][1], i); break;
+	case MUL_SM: ((V&) algo).mul_SM_fwd (args[i][0], args[i][1], i); break;
+	case MUL_VV: ((V&) algo).mul_VV_fwd (args[i][0], args[i][1], i); break;
+	case MUL_MV: ((V&) algo).mul_MV_fwd (args[i][0], args[i][1], i); break;
+	case MUL_MM: ((V&) algo).mul_MM_fwd (args[i][0], args[i][1], i); break;
+	case MUL_VM: ((V&) algo).mul_VM_fwd (args[i][0], args[i][1], i); break;
+	case SUB:    ((V&) algo).sub_fwd    (args[i][0], args[i][1], i); break;
+	case SUB_V:  ((V&) algo).sub_V_fwd  (args[i][0], args[i][1], i); break;
+	case SUB_M:  ((V&) algo).sub_M_fwd  (args[i][0], args[i][1], i); break;
+	case DIV:    ((V&) algo).div_fwd    (args[i][0], args[i][1], i); break;
+	case MAX:    ((V&) algo).max_fwd    (args[i][0], args[i][1], i); break;
+	case MIN:    ((V&) algo).min_fwd    (args[i][0], args[i][1], i); break;
+	case ATAN2:  ((V&) algo).atan2_fwd  (args[i][0], args[i][1], i); break;
+	case MINUS:  ((V&) algo).minus_fwd  (args[i][0], i); break;
+	case TRANS_V:((V&) algo).trans_V_fwd(args[i][0], i); break;
+	case TRANS_M:((V&) algo).trans_M_fwd(args[i][0], i); break;
+	case SIGN:   ((V&) algo).sign_fwd   (args[i][0], i); break;
+	case ABS:    ((V&) algo).abs_fwd    (args[i][0], i); break;
+	case POWER:  ((V&) algo).power_fwd  (args[i][0], i, ((const ExprPower&) (*nodes)[i]).expon); break;
+	case SQR:    ((V&) algo).sqr_fwd    (args[i][0], i); break;
+	case SQRT:   ((V&) algo).sqrt_fwd   (args[i][0], i); break;
+	case EXP:    ((V&) algo).exp_fwd    (args[i][0], i); break;
+	case LOG:    ((V&) algo).log_fwd    (args[i][0], i); break;
+	case COS:    ((V&) algo).cos_fwd    (args[i][0], i); break;
+	case SIN:    ((V&) algo).sin_fwd    (args[i][0], i); break;
+	case TAN:    ((V&) algo).tan_fwd    (args[i][0], i); break;
+	case COSH:   ((V&) algo).cosh_fwd   (args[i][0], i); break;
+	case SINH:   ((V&) algo).sinh_fwd   (args[i][0], i); break;
+	case TANH:   ((V&) algo).tanh_fwd   (args[i][0], i); break;
+	case ACOS:   ((V&) algo).acos_fwd   (args[i][0], i); break;
+	case ASIN:   ((V&) algo).asin_fwd   (args[i][0], i); break;
+	case ATAN:   ((V&) algo).atan_fwd   (args[i][0], i); break;
+	case ACOSH:  ((V&) algo).acosh_fwd  (args[i][0], i); break;
+	case ASINH:  ((V&) algo).asinh_fwd  (args[i][0], i); break;
+	case ATANH:  ((V&) algo).atanh_fwd  (args[i][0], i); break;
+	default: 	 assert(false);
 	}
 }
 
@@ -16,12 +16,33 @@
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f) {
+Eval::Eval(Function& f) : incremental(false), last(NULL), last_box(NULL), last_valid(false), restore(false), deps(NULL),
+		f(f), d(f), apply_ctx(NULL) {
 
 }
 
+Eval::~Eval() {
+	set_incremental(false);
+}
+
+void Eval::set_incremental(bool incr) {
+	incremental=incr;
+
+	if (!incremental && last) {
+		delete last;
+		delete last_box;
+		delete[] deps;
+		last=NULL;
+		last_box=NULL;
+		deps=NULL;
+		last_valid=false;
+	}
+}
+
 Domain& Eval::eval(const Array<const Domain>& d2) {
 
+	restore=true;
+
 	d.write_arg_domains(d2);
 
 	//------------- for debug
@@ -40,6 +61,8 @@ Domain& Eval::eval(const Array<const Domain>& d2) {
 
 Domain& Eval::eval(const Array<Domain>& d2) {
 
+	restore=true;
+
 	d.write_arg_domains(d2);
 
 	try {
@@ -52,6 +75,8 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 
 Domain& Eval::eval(const IntervalVector& box) {
 
+	if (incremental && f.nb_var()>0) return eval_incremental(box);
+
 	d.write_arg_domains(box);
 
 	try {
@@ -62,6 +87,95 @@ Domain& Eval::eval(const IntervalVector& box) {
 	return *d.top;
 }
 
+Domain& Eval::eval_incremental(const IntervalVector& box) {
+
+	int n=f.expr().size;
+
+	if (!last) {
+		last=new ExprDomain(f);
+		last_box=new IntervalVector(box);
+
+		// index of the first variable of each symbol
+		int* first=new int[f.nb_arg()];
+		for (int j=0, v=0; j<f.nb_arg(); v+=f.arg(j++).dim.size())
+			first[j]=v;
+
+		// calculate the variables each node depends on
+		// (the arguments of a node have greater ranks)
+		deps=new BitSet[n];
+		for (int i=n-1; i>=0; i--) {
+			const ExprNode& e=f.node(i);
+			deps[i]=BitSet::empty(f.nb_var());
+
+			if (dynamic_cast<const ExprSymbol*>(&e)) {
+				int v=first[((const ExprSymbol&) e).key];
+				deps[i].add_interval(v,v+e.dim.size()-1);
+			} else if (dynamic_cast<const ExprIndex*>(&e)) {
+				const ExprIndex& idx=(const ExprIndex&) e;
+				if (idx.indexed_symbol()) {
+					// only the indexed components
+					std::pair<const ExprSymbol*, int> p=idx.symbol_shift();
+					int v=first[p.first->key]+p.second;
+					deps[i].add_interval(v,v+e.dim.size()-1);
+				} else
+					deps[i].union_with(deps[f.nodes.rank(idx.expr)]);
+			} else if (dynamic_cast<const ExprUnaryOp*>(&e)) {
+				deps[i].union_with(deps[f.nodes.rank(((const ExprUnaryOp&) e).expr)]);
+			} else if (dynamic_cast<const ExprBinaryOp*>(&e)) {
+				deps[i].union_with(deps[f.nodes.rank(((const ExprBinaryOp&) e).left)]);
+				deps[i].union_with(deps[f.nodes.rank(((const ExprBinaryOp&) e).right)]);
+			} else if (dynamic_cast<const ExprNAryOp*>(&e)) {
+				const ExprNAryOp& a=(const ExprNAryOp&) e;
+				for (int j=0; j<a.nb_args; j++)
+					deps[i].union_with(deps[f.nodes.rank(a.arg(j))]);
+			}
+		}
+
+		delete[] first;
+	}
+
+	d.write_arg_domains(box);
+
+	if (!last_valid) {
+		// evaluate all the nodes
+		try {
+			f.forward<Eval>(*this);
+		} catch(EmptyBoxException&) {
+			d.top->set_empty();
+			return *d.top;
+		}
+		for (int i=n-1; i>=0; i--)
+			(*last)[i]=d[i];
+		*last_box=box;
+		last_valid=true;
+		restore=false;
+		return *d.top;
+	}
+
+	BitSet changed=BitSet::empty(f.nb_var());
+	for (int j=0; j<f.nb_var(); j++)
+		if (box[j]!=(*last_box)[j]) changed.add(j);
+
+	try {
+		for (int i=n-1; i>=0; i--) {
+			if (deps[i].intersect(changed)) {
+				f.cf.forward<Eval>(*this,i);
+				(*last)[i]=d[i];
+			} else if (restore)
+				d[i]=(*last)[i];
+		}
+	} catch(EmptyBoxException&) {
+		// some nodes of "last" are not up to date
+		last_valid=false;
+		d.top->set_empty();
+		return *d.top;
+	}
+
+	*last_box=box;
+	restore=false;
+	return *d.top;
+}
+
 void Eval::apply_fwd(int* x, int y) {
 	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
 
@@ -75,7 +189,9 @@ void Eval::apply_fwd(int* x, int y) {
 		d2.set_ref(i,d[x[i]]);
 	}
 
-	d[y] = a.func.basic_evaluator().eval(d2);
+	Eval& e = apply_ctx ? apply_ctx[y]->e : a.func.basic_evaluator();
+
+	d[y] = e.eval(d2);
 }
 
 void Eval::vector_fwd(int* x, int y) {
@@ -15,10 +15,12 @@
 #include <iostream>
 
 #include "ibex_ExprDomain.h"
+#include "ibex_BitSet.h"
 
 namespace ibex {
 
 class Function;
+class EvalContext;
 
 /**
  * \ingroup symbolic
@@ -35,6 +37,11 @@ public:
 	 */
 	Eval(Function &f);
 
+	/**
+	 * \brief Delete this.
+	 */
+	~Eval();
+
 	/**
 	 * \brief Run the forward algorithm with input domains.
 	 */
@@ -47,10 +54,55 @@ public:
 
 	/**
 	 * \brief Run the forward algorithm with an input box.
+	 *
+	 * In incremental mode, only the nodes that depend on variables whose domain
+	 * has changed since the last evaluation (with a box) are recalculated.
 	 */
 	Domain& eval(const IntervalVector& box);
 
+	/**
+	 * \brief Enable or disable the incremental mode.
+	 *
+	 * In this mode, the domains of the nodes after an evaluation with a box are
+	 * stored, and restored by the next evaluation for the nodes that do not
+	 * depend on a modified variable. This is useful when the boxes evaluated
+	 * successively only differ on a few variables (e.g., after a bisection).
+	 */
+	void set_incremental(bool incremental);
+
+	/**
+	 * \brief Signal that the domains of the nodes have been modified
+	 * after the last evaluation (e.g., by a backward algorithm).
+	 *
+	 * Only useful in incremental mode: the domains will be restored
+	 * by the next evaluation.
+	 */
+	void domains_modified();
+
 protected:
+	/*
+	 * Incremental evaluation with a box.
+	 */
+	Domain& eval_incremental(const IntervalVector& box);
+
+	/* incremental mode */
+	bool incremental;
+
+	/* domains of the nodes after the last evaluation, in incremental mode */
+	ExprDomain* last;
+
+	/* the last evaluated box, in incremental mode */
+	IntervalVector* last_box;
+
+	/* whether "last" is valid */
+	bool last_valid;
+
+	/* whether the domains differ from "last" */
+	bool restore;
+
+	/* variables each node depends on */
+	BitSet* deps;
+
 	/**
 	 * Class used internally to interrupt the forward procedure
 	 * when an empty domain occurs (<=> the input box is outside
@@ -108,12 +160,23 @@ public: // because called from CompiledFunction
 
 	Function& f;
 	ExprDomain d;
+
+	/*
+	 * Contexts of the functions called in ExprApply nodes (indexed by node).
+	 * NULL if the evaluators of the called functions are used (default).
+	 * Set by #ibex::EvalContext.
+	 */
+	EvalContext** apply_ctx;
 };
 
 /* ============================================================================
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
 
+inline void Eval::domains_modified() {
+	restore=true;
+}
+
 inline void Eval::index_fwd(int, int) { /* nothing to do */ }
 
 inline void Eval::symbol_fwd(int) { /* nothing to do */ }
@@ -0,0 +1,146 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+
+using namespace std;
+
+namespace ibex {
+
+EvalContext::EvalContext(const Function& f) : f((Function&) f), e(this->f), hc4revise(e), grad(e), inhc4revise(e),
+		apply_ctx(NULL), _comp(NULL) {
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprApply* a=dynamic_cast<const ExprApply*>(&f.node(i));
+		if (!a) continue;
+
+		if (!apply_ctx) {
+			apply_ctx=new EvalContext*[f.nb_nodes()];
+			for (int j=0; j<f.nb_nodes(); j++) apply_ctx[j]=NULL;
+		}
+
+		// the calls to the same function share the same context
+		// (like they share the same evaluator)
+		for (vector<EvalContext*>::iterator it=sub.begin(); it!=sub.end(); it++) {
+			if (&(*it)->f==&a->func) { apply_ctx[i]=*it; break; }
+		}
+		if (!apply_ctx[i]) {
+			apply_ctx[i]=new EvalContext(a->func);
+			sub.push_back(apply_ctx[i]);
+		}
+	}
+
+	e.apply_ctx=apply_ctx;
+	inhc4revise.p_eval.apply_ctx=apply_ctx;
+
+	// generate the components now: this is the only
+	// modification of the function (see jacobian).
+	if (f.image_dim()>1) f[0];
+}
+
+EvalContext::~EvalContext() {
+	for (vector<EvalContext*>::iterator it=sub.begin(); it!=sub.end(); it++)
+		delete *it;
+	delete[] apply_ctx;
+
+	if (_comp) {
+		for (int i=0; i<f.image_dim(); i++)
+			delete _comp[i];
+		delete[] _comp;
+	}
+}
+
+Interval EvalContext::eval(const IntervalVector& box) {
+	return e.eval(box).i();
+}
+
+IntervalVector EvalContext::eval_vector(const IntervalVector& box) {
+	return f.expr().dim.is_scalar() ? IntervalVector(1,e.eval(box).i()) : e.eval(box).v();
+}
+
+bool EvalContext::backward(const Interval& y, IntervalVector& x) {
+	return hc4revise.proj(Domain((Interval&) y),x); // y will not be modified
+}
+
+bool EvalContext::backward(const IntervalVector& y, IntervalVector& x) {
+	assert(f.expr().dim.is_vector());
+	return hc4revise.proj(Domain((IntervalVector&) y, f.expr().dim.type()==Dim::ROW_VECTOR),x); // y will not be modified
+}
+
+void EvalContext::ibwd(const Interval& y, IntervalVector& x) {
+	inhc4revise.iproj(Domain((Interval&) y),x);
+}
+
+void EvalContext::ibwd(const Interval& y, IntervalVector& x, const IntervalVector& xin) {
+	inhc4revise.iproj(Domain((Interval&) y),x,xin);
+}
+
+void EvalContext::gradient(const IntervalVector& x, IntervalVector& g) {
+	assert(g.size()==f.nb_var());
+	assert(x.size()==f.nb_var());
+	grad.gradient(x,g);
+}
+
+EvalContext& EvalContext::comp(int i) {
+	if (f.image_dim()==1) return *this;
+
+	if (!_comp) {
+		_comp=new EvalContext*[f.image_dim()];
+		for (int j=0; j<f.image_dim(); j++) _comp[j]=NULL;
+	}
+	if (!_comp[i]) _comp[i]=new EvalContext(f[i]);
+	return *_comp[i];
+}
+
+void EvalContext::jacobian(const IntervalVector& x, IntervalMatrix& J) {
+	assert(J.nb_cols()==f.nb_var());
+	assert(x.size()==f.nb_var());
+	assert(J.nb_rows()==f.image_dim());
+
+	// calculate the gradient of each component of f
+	for (int i=0; i<f.image_dim(); i++) {
+		comp(i).gradient(x,J[i]);
+	}
+}
+
+void EvalContext::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
+	if (!f.expr().dim.is_vector()) {
+		ibex_error("Cannot called \"jacobian\" on a real-valued function");
+	}
+
+	int m=f.expr().dim.vec_size();
+
+	for (int i=0; i<m; i++) {
+		comp(i).grad.gradient(d,J[i]);
+	}
+}
+
+EvalContextPool::~EvalContextPool() {
+	for (vector<EvalContext*>::iterator it=free.begin(); it!=free.end(); it++)
+		delete *it;
+}
+
+EvalContext& EvalContextPool::checkout(const Function& f) {
+	Lock l(lock);
+	if (free.empty())
+		// the creation is also protected by the lock
+		return *new EvalContext(f);
+	EvalContext* c=free.back();
+	free.pop_back();
+	return *c;
+}
+
+void EvalContextPool::checkin(EvalContext& c) {
+	Lock l(lock);
+	free.push_back(&c);
+}
+
+} // namespace ibex
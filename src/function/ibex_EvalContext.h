@@ -0,0 +1,187 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include "ibex_Eval.h"
+#include "ibex_HC4Revise.h"
+#include "ibex_Gradient.h"
+#include "ibex_InHC4Revise.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Evaluation context of a function.
+ *
+ * A function owns a single evaluator (and projection and gradient algorithms),
+ * which store temporary domains: the same function cannot be used by two threads
+ * at the same time. An evaluation context gathers its own copy of these algorithms
+ * (including for the functions called by the expression), so that different
+ * threads can evaluate, contract and differentiate the same function, each one
+ * with its own context. The expression of the function is shared.
+ *
+ * A context can either be held by a thread, or be taken from the pool of the
+ * function (see #ibex::Function::checkout()).
+ *
+ * \note The native code of a function (see #ibex::Function::compile_native())
+ * is not used by contexts.
+ */
+class EvalContext {
+public:
+	/**
+	 * \brief Build a context for f.
+	 *
+	 * \warning The creation of a context is not thread-safe (unless it is
+	 * done through #ibex::Function::checkout()).
+	 */
+	explicit EvalContext(const Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief Same as #ibex::Function::eval(const IntervalVector&) const.
+	 */
+	Interval eval(const IntervalVector& box);
+
+	/**
+	 * \brief Same as #ibex::Function::eval_vector(const IntervalVector&) const.
+	 */
+	IntervalVector eval_vector(const IntervalVector& box);
+
+	/**
+	 * \brief Same as #ibex::Function::backward(const Interval&, IntervalVector&) const.
+	 */
+	bool backward(const Interval& y, IntervalVector& x);
+
+	/**
+	 * \brief Same as #ibex::Function::backward(const IntervalVector&, IntervalVector&) const.
+	 */
+	bool backward(const IntervalVector& y, IntervalVector& x);
+
+	/**
+	 * \brief Same as #ibex::Function::ibwd(const Interval&, IntervalVector&) const.
+	 */
+	void ibwd(const Interval& y, IntervalVector& x);
+
+	/**
+	 * \brief Same as #ibex::Function::ibwd(const Interval&, IntervalVector&, const IntervalVector&) const.
+	 */
+	void ibwd(const Interval& y, IntervalVector& x, const IntervalVector& xin);
+
+	/**
+	 * \brief Same as #ibex::Function::gradient(const IntervalVector&, IntervalVector&) const.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g);
+
+	/**
+	 * \brief Same as #ibex::Function::jacobian(const IntervalVector&, IntervalMatrix&) const.
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J);
+
+	/**
+	 * \brief The function.
+	 */
+	Function& f;
+
+	/**
+	 * \brief The evaluator.
+	 */
+	Eval e;
+
+	/**
+	 * \brief The HC4Revise algorithm.
+	 */
+	HC4Revise hc4revise;
+
+	/**
+	 * \brief The gradient algorithm.
+	 */
+	Gradient grad;
+
+	/**
+	 * \brief The inner projection algorithm.
+	 */
+	InHC4Revise inhc4revise;
+
+protected:
+	friend class Gradient;
+
+	/*
+	 * Context of the ith component (created on demand)
+	 */
+	EvalContext& comp(int i);
+
+	/*
+	 * Jacobian matrix from the domains of the arguments
+	 * (called for vector-valued functions in an ExprApply node)
+	 */
+	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
+
+	/*
+	 * Contexts of the called functions, one per node (NULL if
+	 * the node is not an ExprApply). Given to the algorithms.
+	 */
+	EvalContext** apply_ctx;
+
+	/*
+	 * All the contexts of the called functions (one per
+	 * called function).
+	 */
+	std::vector<EvalContext*> sub;
+
+	/*
+	 * Contexts of the components.
+	 */
+	EvalContext** _comp;
+
+private:
+	EvalContext(const EvalContext&);            // forbidden
+	EvalContext& operator=(const EvalContext&); // forbidden
+};
+
+/**
+ * \ingroup symbolic
+ * \brief Pool of evaluation contexts of a function (thread-safe).
+ *
+ * For internal purposes (see #ibex::Function::checkout()).
+ */
+class EvalContextPool {
+public:
+	/**
+	 * \brief Delete all the contexts in the pool.
+	 */
+	~EvalContextPool();
+
+	/**
+	 * \brief Take a context from the pool (or create a new one).
+	 */
+	EvalContext& checkout(const Function& f);
+
+	/**
+	 * \brief Give back a context to the pool.
+	 */
+	void checkin(EvalContext& c);
+
+private:
+	Mutex lock;
+	std::vector<EvalContext*> free;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
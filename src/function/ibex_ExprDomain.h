@@ -2,14 +2,64 @@
 #define __IBEX_EXPR_DOMAIN__
 
 #include <iostream>
+#include <new>
 
 #include "ibex_ExprData.h"
 
 namespace ibex {
 
+/**
+ * \brief Contiguous storage of the domains of a function.
+ *
+ * The domains of all the nodes are stored in a single block, aligned on
+ * a cache line. The domains of scalar nodes are packed in a second array,
+ * in the order of the forward algorithms (arguments first), so that
+ * CompiledFunction::forward reads memory sequentially.
+ *
+ * Vector and matrix domains keep their own (heap-allocated) data.
+ */
+template<class D>
+class ExprDomainArena {
+public:
+	/** Allocate the storage for the nodes of f. */
+	ExprDomainArena(const Function& f);
+
+	/** Destroy the domains and free the storage. */
+	~ExprDomainArena();
+
+	/** Storage of the domain of the ith node (not initialized). */
+	void* node(int i);
+
+	/** The next free scalar. */
+	typename D::SCALAR& next_scalar();
+
+	/** Size of a cache line (in bytes). */
+	static const size_t CACHE_LINE=64;
+
+private:
+	ExprDomainArena(const ExprDomainArena&);            // forbidden
+	ExprDomainArena& operator=(const ExprDomainArena&); // forbidden
+
+	typedef typename D::SCALAR SCALAR;
+
+	/* number of nodes and of scalars */
+	int n, nb_scalars;
+
+	/* number of scalars already given */
+	int next;
+
+	char* block;
+
+	TemplateDomain<D>* domains;
+
+	SCALAR* scalars;
+};
+
 template<class D>
 class ExprDomainFactory : public ExprDataFactory<TemplateDomain<D> > {
 public:
+	/** Build the domains into an arena. */
+	ExprDomainFactory(ExprDomainArena<D>& arena);
 	/** Delete this. */
 	virtual ~ExprDomainFactory();
 	/** Visit an indexed expression. */
@@ -24,6 +74,15 @@ public:
 	virtual TemplateDomain<D>* init(const ExprUnaryOp& e, TemplateDomain<D>& expr_deco);
 	/** Visit a transpose. */
 	virtual TemplateDomain<D>* init(const ExprTrans& e, TemplateDomain<D>& expr_deco);
+
+protected:
+	/** Storage of the domain of e. */
+	void* node(const ExprNode& e) const;
+
+	/** New domain of e (a scalar of the arena if e is scalar). */
+	TemplateDomain<D>* domain(const ExprNode& e) const;
+
+	ExprDomainArena<D>& arena;
 };
 
 /**
@@ -34,7 +93,7 @@ public:
  *
  */
 template<class D>
-class ExprTemplateDomain : public ExprData<TemplateDomain<D> > {
+class ExprTemplateDomain : private ExprDomainArena<D>, public ExprData<TemplateDomain<D> > {
 public:
 
 	ExprTemplateDomain(const Function& f);
@@ -92,48 +151,105 @@ typedef ExprTemplateDomain<Interval> ExprDomain;
 /* ============================================================================
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
+template<class D>
+ExprDomainArena<D>::ExprDomainArena(const Function& f) : n(f.nodes.size()), nb_scalars(0), next(0) {
+	for (int i=0; i<n; i++)
+		if (f.nodes[i].dim.is_scalar()) nb_scalars++;
+
+	// the size of the domains is rounded up to a multiple of a cache line
+	size_t domains_size=((n*sizeof(TemplateDomain<D>)+CACHE_LINE-1)/CACHE_LINE)*CACHE_LINE;
+
+	block=new char[domains_size+nb_scalars*sizeof(SCALAR)+CACHE_LINE];
+
+	char* start=block+(CACHE_LINE-((size_t) block)%CACHE_LINE)%CACHE_LINE;
+	domains=(TemplateDomain<D>*) start;
+	scalars=(SCALAR*) (start+domains_size);
+
+	for (int i=0; i<nb_scalars; i++)
+		new (&scalars[i]) SCALAR();
+}
+
+template<class D>
+ExprDomainArena<D>::~ExprDomainArena() {
+	for (int i=0; i<n; i++)
+		domains[i].~TemplateDomain<D>();
+	for (int i=0; i<nb_scalars; i++)
+		scalars[i].~SCALAR();
+	delete[] block;
+}
+
+template<class D>
+inline void* ExprDomainArena<D>::node(int i) {
+	assert(i>=0 && i<n);
+	return &domains[i];
+}
+
+template<class D>
+inline typename D::SCALAR& ExprDomainArena<D>::next_scalar() {
+	assert(next<nb_scalars);
+	return scalars[next++];
+}
+
+template<class D>
+ExprDomainFactory<D>::ExprDomainFactory(ExprDomainArena<D>& arena) : ExprDataFactory<TemplateDomain<D> >(), arena(arena) {
+
+}
+
 template<class D>
 ExprDomainFactory<D>::~ExprDomainFactory() {
 
 }
 
+template<class D>
+inline void* ExprDomainFactory<D>::node(const ExprNode& e) const {
+	return arena.node(this->data->f.nodes.rank(e));
+}
+
+template<class D>
+inline TemplateDomain<D>* ExprDomainFactory<D>::domain(const ExprNode& e) const {
+	if (e.dim.is_scalar())
+		return new (node(e)) TemplateDomain<D>(arena.next_scalar());
+	else
+		return new (node(e)) TemplateDomain<D>(e.dim);
+}
+
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprIndex& e, TemplateDomain<D>& d_expr) {
 	switch (e.expr.type()) {
 	case Dim::SCALAR:
-		return new TemplateDomain<D>(d_expr.i());
+		return new (node(e)) TemplateDomain<D>(d_expr.i());
 		break;
 	case Dim::ROW_VECTOR:
 	case Dim::COL_VECTOR:
-		return new TemplateDomain<D>(d_expr.v()[e.index]);
+		return new (node(e)) TemplateDomain<D>(d_expr.v()[e.index]);
 		break;
 	case Dim::MATRIX:
-		return new TemplateDomain<D>(d_expr.m()[e.index],true);
+		return new (node(e)) TemplateDomain<D>(d_expr.m()[e.index],true);
 		break;
 	default: // Dim::MATRIX_ARRAY:
-		return new TemplateDomain<D>(d_expr.ma()[e.index]);
+		return new (node(e)) TemplateDomain<D>(d_expr.ma()[e.index]);
 		break;
 	}
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprLeaf& e) {
-	return new TemplateDomain<D>(e.dim);
+	return domain(e);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprNAryOp& e, Array<TemplateDomain<D> >&) {
-	return new TemplateDomain<D>(e.dim);
+	return domain(e);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprBinaryOp& e, TemplateDomain<D>&, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return domain(e);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprUnaryOp& e, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return domain(e);
 }
 
 template<class D>
@@ -141,16 +257,16 @@ TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprTrans& e, TemplateDomain
 
 	if (e.dim.is_vector()) {
 		// share references
-		return new TemplateDomain<D>(expr_deco, true);
+		return new (node(e)) TemplateDomain<D>(expr_deco, true);
 	} else {
 		// TODO: seems impossible to have references
 		// in case of matrices...
-		return new TemplateDomain<D>(e.dim);
+		return domain(e);
 	}
 }
 
 template<class D>
-inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>()) {
+inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprDomainArena<D>(f), ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>(*this)) {
 
 }
 
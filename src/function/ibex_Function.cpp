@@ -23,6 +23,11 @@ using namespace std;
 namespace ibex {
 
 Function::~Function() {
+	// contexts refer to the expression and the components
+	if (_pool!=NULL) delete _pool;
+
+	if (_hessian!=NULL) delete _hessian;
+
 	if (_used_var!=NULL)
 		delete[] _used_var;
 
@@ -51,12 +56,29 @@ Function::~Function() {
 
 	if (df!=NULL) delete df;
 
+	if (_native!=NULL) delete _native;
+
 	if (name!=NULL) { // name==NULL if init/build_from_string was never called.
 		free((char*) name);
 		delete[] symbol_index;
 	}
 }
 
+EvalContext& Function::checkout() const {
+	return _pool->checkout(*this);
+}
+
+void Function::checkin(EvalContext& c) const {
+	assert(&c.f==this);
+	_pool->checkin(c);
+}
+
+void Function::compile_native(const char* cache, const char* compiler) {
+	NativeFunction* n=new NativeFunction(*this,cache,compiler);
+	if (_native!=NULL) delete _native;
+	_native=n;
+}
+
 void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	assert(J.nb_cols()==nb_var());
 	assert(x.size()==nb_var());
@@ -68,6 +90,92 @@ void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	}
 }
 
+Interval Function::eval(const IntervalVector& box, eval_mode mode) const {
+	assert(expr().dim.is_scalar());
+
+	if (mode==NATURAL) return eval(box);
+
+	IntervalVector y(1);
+	if (!centered_form(box,y)) return eval(box);
+
+	return mode==CENTERED ? y[0] : y[0] & eval(box);
+}
+
+IntervalVector Function::eval_vector(const IntervalVector& box, eval_mode mode) const {
+	if (mode==NATURAL) return eval_vector(box);
+
+	IntervalVector y(image_dim());
+	if (!centered_form(box,y)) return eval_vector(box);
+
+	return mode==CENTERED ? y : y & eval_vector(box);
+}
+
+bool Function::centered_form(const IntervalVector& box, IntervalVector& y) const {
+	assert(expr().dim.is_scalar() || expr().dim.is_vector());
+	assert(y.size()==image_dim());
+
+	if (box.is_empty() || box.is_unbounded()) return false;
+
+	Vector mid=box.mid();
+	IntervalVector fmid=eval_vector(IntervalVector(mid));
+	if (fmid.is_empty()) return false;
+
+	IntervalVector dx=box-mid;
+
+	// note: only the derivatives w.r.t. the used variables
+	// are calculated (with a sparse Jacobian matrix).
+	if (image_dim()==1) {
+		y[0]=fmid[0];
+		if (nb_used_vars()==0) return true;
+
+		IntervalVector g(nb_used_vars()); // inline if small
+		bool ok=sparse_gradient(box,&g[0]);
+		if (ok)
+			for (int k=0; k<nb_used_vars(); k++)
+				y[0]+=g[k]*dx[used_var(k)];
+		return ok;
+	} else {
+		SparseJacobian J(*this);
+		jacobian(box,J);
+		if (J.is_empty()) return false;
+
+		for (int i=0; i<image_dim(); i++) {
+			y[i]=fmid[i];
+			for (int k=0; k<J.row_size(i); k++)
+				y[i]+=J(i,k)*dx[J.col(i,k)];
+		}
+		return true;
+	}
+}
+
+bool Function::sparse_gradient(const IntervalVector& x, Interval* g) const {
+	assert(x.size()==nb_var());
+
+	if (_native || !all_args_scalar()) {
+		IntervalVector gbox(nb_var());
+		gradient(x,gbox);
+		if (gbox.is_empty()) return false;
+		for (int k=0; k<nb_used_vars(); k++)
+			g[k]=gbox[used_var(k)];
+		return true;
+	} else
+		return _grad->sparse_gradient(x,g);
+}
+
+void Function::jacobian(const IntervalVector& x, SparseJacobian& J) const {
+	assert(&J.f==this);
+	assert(x.size()==nb_var());
+
+	J.empty=false;
+
+	for (int i=0; i<image_dim(); i++) {
+		if (J.row_size(i)==0) continue;
+
+		// outside definition domain -> empty matrix
+		if (!(*this)[i].sparse_gradient(x,J.row(i))) { J.set_empty(); return; }
+	}
+}
+
 void Function::jacobian(const IntervalVector& box, IntervalMatrix& J, const VarSet& set) const {
 
 	assert(J.nb_cols()==set.nb_var);
@@ -84,28 +192,50 @@ void Function::jacobian(const IntervalVector& box, IntervalMatrix& J, const VarS
 }
 
 void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H) const {
-	int n=nb_var();
-	int m=image_dim();
+	assert(H.nb_cols()==nb_var());
+	assert(box.size()==nb_var());
+	assert(H.nb_rows()==image_dim());
 
-	assert(H.nb_cols()==n);
-	assert(box.size()==n);
-	assert(H.nb_rows()==m);
+	SparseJacobian J(*this);
+	hansen_matrix(box,J);
+	J.to_dense(H);
+}
+
+void Function::hansen_matrix(const IntervalVector& box, SparseJacobian& H) const {
+	assert(&H.f==this);
+	assert(box.size()==nb_var());
 
 	IntervalVector x=box.mid();
-	IntervalMatrix J(m,n);
 
-	// test!
-//	int tab[box.size()];
-//	box.sort_indices(false,tab);
-//	int var;
+	H.empty=false;
 
-	for (int var=0; var<n; var++) {
-		//var=tab[i];
-		x[var]=box[var];
-		jacobian(x,J);
-		H.set_col(var,J.col(var));
-	}
+	// The jth column of the Hansen matrix is the jth column of the Jacobian
+	// matrix on (box[0],...,box[j],mid[j+1],...). As the ith component only
+	// depends on its used variables, the entries of the ith row are obtained
+	// by instantiating the used variables of this component, one by one.
+	for (int i=0; i<image_dim(); i++) {
+		int nu=H.row_size(i);
+		if (nu==0) continue;
+
+		const Function& fi=(*this)[i];
+		IntervalVector g(nu); // inline if small
+
+		for (int k=0; k<nu; k++) {
+			int j=H.col(i,k);
+			x[j]=box[j];
+			if (!fi.sparse_gradient(x,&g[0])) {
+				H.set_empty();
+				return;
+			}
+			H(i,k)=g[k];
+		}
 
+		// restore the midpoint
+		for (int k=0; k<nu; k++) {
+			int j=H.col(i,k);
+			x[j]=box[j].mid();
+		}
+	}
 }
 
 void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const VarSet& set) const {
@@ -130,6 +260,44 @@ void Function::hansen_matrix(const IntervalVector& box, IntervalMatrix& H, const
 	}
 }
 
+void Function::hessian(const IntervalVector& x, IntervalMatrix& H) const {
+	assert(x.size()==nb_var());
+	assert(H.nb_rows()==nb_var() && H.nb_cols()==nb_var());
+
+	if (!expr().dim.is_scalar()) {
+		ibex_error("Cannot called \"hessian\" on a vector-valued function");
+	}
+
+	// the symbolic derivative is only used for non-supported functions
+	if (_hessian==NULL && Hessian::is_supported(*this))
+		_hessian=new Hessian(*_eval);
+
+	if (_hessian!=NULL)
+		_hessian->hessian(x,H);
+	else if (nb_var()==1)
+		diff().gradient(x,H[0]);
+	else
+		diff().jacobian(x,H);
+}
+
+void Function::hessian_vector(const IntervalVector& x, const IntervalVector& v, IntervalVector& hv) const {
+	assert(x.size()==nb_var());
+	assert(v.size()==nb_var());
+	assert(hv.size()==nb_var());
+
+	if (_hessian==NULL && Hessian::is_supported(*this))
+		_hessian=new Hessian(*_eval);
+
+	if (_hessian!=NULL)
+		_hessian->hessian_vector(x,v,hv);
+	else {
+		IntervalMatrix H(nb_var(),nb_var());
+		hessian(x,H);
+		if (H.is_empty()) hv.set_empty();
+		else hv=H*v;
+	}
+}
+
 void Function::print(std::ostream& os) const {
 	if (name!=NULL) os << name << ":";
 	os << "(";
@@ -30,6 +30,11 @@ class Eval;
 class HC4Revise;
 class Gradient;
 class InHC4Revise;
+class NativeFunction;
+class EvalContext;
+class EvalContextPool;
+class SparseJacobian;
+class Hessian;
 
 /**
  * \ingroup function
@@ -667,6 +672,39 @@ public:
 	 */
 	IntervalVector eval_vector(const IntervalVector& box) const;
 
+	/**
+	 * \brief Evaluation mode.
+	 *
+	 * <ul>
+	 * <li> NATURAL:          natural extension (interval arithmetic)
+	 * <li> CENTERED:         mean-value (centered) form f(mid)+J(box)*(box-mid)
+	 *                        where J is the interval Jacobian matrix.
+	 * <li> CENTERED_NATURAL: intersection of both.
+	 * </ul>
+	 * The centered form overestimates the range quadratically with the diameter
+	 * of the box (instead of linearly with the natural extension): it is sharper
+	 * on small boxes, but requires an evaluation of the Jacobian matrix.
+	 */
+	typedef enum { NATURAL, CENTERED, CENTERED_NATURAL } eval_mode;
+
+	/**
+	 * \brief Calculate f(box) with a given evaluation mode.
+	 *
+	 * The natural extension is used if the centered form cannot be
+	 * calculated (unbounded box or midpoint outside the definition domain).
+	 *
+	 * \pre f must be real-valued
+	 */
+	Interval eval(const IntervalVector& box, eval_mode mode) const;
+
+	/**
+	 * \brief Calculate f(box) with a given evaluation mode.
+	 *
+	 * \see #eval(const IntervalVector&, eval_mode) const.
+	 * \pre f must be real or vector-valued
+	 */
+	IntervalVector eval_vector(const IntervalVector& box, eval_mode mode) const;
+
 	/**
 	 * \brief Calculate f(x) using interval arithmetic.
 	 *
@@ -709,6 +747,20 @@ public:
 	 */
 	IntervalVector gradient(const IntervalVector& x) const;
 
+	/**
+	 * \brief Calculate the derivatives of f w.r.t. the used variables.
+	 *
+	 * g[k] is set to the derivative w.r.t. the variable used_var(k).
+	 * Cheaper than gradient(const IntervalVector&, IntervalVector&) const
+	 * when f only depends on a few variables.
+	 *
+	 * \param g - an array of nb_used_vars() intervals (output parameter).
+	 * \return false if x is outside the definition domain of f
+	 *         (g is then unspecified).
+	 * \pre f must be real-valued
+	 */
+	bool sparse_gradient(const IntervalVector& x, Interval* g) const;
+
 	/**
 	 * \brief Calculate the Jacobian matrix of f
 	 *
@@ -724,6 +776,18 @@ public:
 	 */
 	IntervalMatrix jacobian(const IntervalVector& x) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f in sparse form
+	 *
+	 * Only the derivatives of each component w.r.t. the variables it
+	 * uses are calculated: the cost depends on the number of nonzero
+	 * entries, not on the size of the matrix.
+	 *
+	 * \param J - a sparse Jacobian built for this function (output parameter).
+	 *              J is set empty if x is outside the definition domain of f.
+	 */
+	void jacobian(const IntervalVector& x, SparseJacobian& J) const;
+
 	/**
 	 * \brief Calculate the Jacobian matrix of a restriction of f
 	 *
@@ -737,6 +801,13 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& x, IntervalMatrix& h) const;
 
+	/**
+	 * \brief Calculate the Hansen matrix of f in sparse form
+	 *
+	 * \see #jacobian(const IntervalVector&, SparseJacobian&) const.
+	 */
+	void hansen_matrix(const IntervalVector& x, SparseJacobian& h) const;
+
 	/**
 	 * \brief Calculate the Hansen matrix of a restriction of f
 	 *
@@ -745,6 +816,36 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& full_box, IntervalMatrix& h, const VarSet& set) const;
 
+	/**
+	 * \brief Calculate the Hessian matrix of f
+	 *
+	 * The matrix is calculated by automatic differentiation (see #ibex::Hessian)
+	 * when f is supported; otherwise, by the Jacobian matrix of the symbolic
+	 * derivative of f (generated once for all).
+	 *
+	 * \param H - an nb_var() x nb_var() matrix (output parameter).
+	 *             H is set empty if x is outside the definition domain of f.
+	 * \pre f must be real-valued
+	 */
+	void hessian(const IntervalVector& x, IntervalMatrix& H) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f
+	 * \pre f must be real-valued
+	 */
+	IntervalMatrix hessian(const IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of f by v
+	 *
+	 * Cheaper than hessian(const IntervalVector&, IntervalMatrix&) const:
+	 * the cost of a product is that of a gradient.
+	 *
+	 * \param hv - the product (output parameter).
+	 * \pre f must be real-valued
+	 */
+	void hessian_vector(const IntervalVector& x, const IntervalVector& v, IntervalVector& hv) const;
+
 	/**
 	 * \brief Contract x w.r.t. f(x)=y.
 	 * \throw EmptyBoxException if x is empty.
@@ -789,6 +890,51 @@ public:
 	 */
 	void ibwd(const Interval& y, IntervalVector& x, const IntervalVector& xin) const;
 
+	/**
+	 * \brief Use native code for evaluation, backward projection and gradient.
+	 *
+	 * The code is generated, compiled and loaded by #ibex::NativeFunction (see this
+	 * class for the parameters). Once loaded, #eval(const IntervalVector&) const,
+	 * #backward(const Domain&, IntervalVector&) const and #gradient(const IntervalVector&, IntervalVector&) const
+	 * directly call this code.
+	 *
+	 * \throw NativeFunctionException if the code cannot be generated or loaded. The function
+	 * is then still evaluated by the interpreted algorithms.
+	 */
+	void compile_native(const char* cache=NULL, const char* compiler=NULL);
+
+	/**
+	 * \brief The native code (NULL if #compile_native() has not been called).
+	 */
+	const NativeFunction* native() const;
+
+	/**
+	 * \brief Enable or disable the incremental evaluation.
+	 *
+	 * In incremental mode, the evaluation with a box (including in the
+	 * backward projection and the gradient) only recalculates the nodes that depend
+	 * on variables whose domain has changed since the last evaluation.
+	 * See #ibex::Eval::set_incremental(bool).
+	 */
+	void set_incremental(bool incremental=true);
+
+	/**
+	 * \brief Take an evaluation context from the pool of this function.
+	 *
+	 * The context is created if the pool is empty. This method is thread-safe,
+	 * and different threads can use their contexts at the same time
+	 * (see #ibex::EvalContext). The context must be given back with
+	 * #checkin(EvalContext&) const.
+	 */
+	EvalContext& checkout() const;
+
+	/**
+	 * \brief Give back a context to the pool of this function.
+	 *
+	 * This method is thread-safe.
+	 */
+	void checkin(EvalContext& c) const;
+
 	/*
 	 * \brief Get a reference to the evaluator.
 	 *
@@ -861,6 +1007,13 @@ protected:
 	 */
 	void print_expr(std::ostream& os) const;
 
+	/**
+	 * \brief Calculate the centered form of f on box.
+	 *
+	 * Return false if it cannot be calculated.
+	 */
+	bool centered_form(const IntervalVector& box, IntervalVector& y) const;
+
 private:
 	friend class VarSet;
 
@@ -903,6 +1056,11 @@ private:
 	HC4Revise *_hc4revise;
 	Gradient *_grad;
 	InHC4Revise *_inhc4revise;
+	NativeFunction *_native;
+	EvalContextPool *_pool;
+
+	// only generated if required (see hessian)
+	mutable Hessian *_hessian;
 
 	// number of used vars (value "-1" means "not yet generated")
 	mutable int _nb_used_vars;
@@ -917,6 +1075,10 @@ private:
 #include "ibex_Gradient.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
+#include "ibex_NativeFunction.h"
+#include "ibex_EvalContext.h"
+#include "ibex_SparseJacobian.h"
+#include "ibex_Hessian.h"
 
 namespace ibex {
 
@@ -990,6 +1152,7 @@ inline Domain& Function::eval_domain(const Array<Domain>& d) const {
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
+	if (_native) return _native->eval(box);
 	return eval_domain(box).i();
 }
 
@@ -1025,6 +1188,7 @@ inline void Function::backward(const V& algo) const {
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
+	if (_native) return _native->backward(y.i(),x);
 	return ((Function*) this)->_hc4revise->proj(y,x);
 }
 
@@ -1072,7 +1236,8 @@ inline int Function::image_dim() const {
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
 	assert(g.size()==nb_var());
 	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	if (_native) _native->gradient(x,g);
+	else _grad->gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1089,6 +1254,16 @@ inline IntervalMatrix Function::jacobian(const IntervalVector& x) const {
 	return J;
 }
 
+inline IntervalMatrix Function::hessian(const IntervalVector& x) const {
+	IntervalMatrix H(nb_var(),nb_var());
+	hessian(x,H);
+	return H;
+}
+
+inline void Function::set_incremental(bool incremental) {
+	_eval->set_incremental(incremental);
+}
+
 inline Eval& Function::basic_evaluator() const {
 	return *_eval;
 }
@@ -1105,6 +1280,10 @@ inline InHC4Revise& Function::inhc4revise() const {
 	return *_inhc4revise;
 }
 
+inline const NativeFunction* Function::native() const {
+	return _native;
+}
+
 inline int Function::nb_used_vars() const {
 	if (_nb_used_vars==-1) generate_used_vars();
 	return _nb_used_vars;
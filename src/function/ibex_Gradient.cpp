@@ -65,6 +65,28 @@ void Gradient::gradient(const IntervalVector& box, IntervalVector& gbox) {
 	g.read_arg_domains(gbox);
 }
 
+bool Gradient::sparse_gradient(const IntervalVector& box, Interval* gu) {
+	assert(f.expr().dim.is_scalar());
+	assert(f.all_args_scalar());
+
+	if (_eval.eval(box).is_empty())
+		// outside definition domain
+		return false;
+
+	// note: the derivatives of the (used) symbols are
+	// set to zero by the forward phase.
+	f.forward<Gradient>(*this);
+
+	g.top->i()=1.0;
+
+	f.backward<Gradient>(*this);
+
+	for (int k=0; k<f.nb_used_vars(); k++)
+		gu[k]=g.args[f.used_var(k)].i();
+
+	return true;
+}
+
 
 void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 
@@ -139,7 +161,8 @@ void Gradient::apply_bwd(int* x, int y) {
 	IntervalVector tmp_g(n);
 
 	if (a.func.expr().dim.is_scalar()) {
-		a.func.deriv_calculator().gradient(d2,tmp_g);
+		Gradient& grad = _eval.apply_ctx ? _eval.apply_ctx[y]->grad : a.func.deriv_calculator();
+		grad.gradient(d2,tmp_g);
 		//cout << "tmp-g=" << tmp_g << endl;
 		tmp_g *= g[y].i();   // pre-multiplication by y.g
 		tmp_g += old_g;      // addition to the old value of g
@@ -149,7 +172,10 @@ void Gradient::apply_bwd(int* x, int y) {
 			not_implemented("automatic differentiation of matrix-valued function");
 		int m=a.func.expr().dim.vec_size();
 		IntervalMatrix J(m,n);
-		a.func.deriv_calculator().jacobian(d2,J);
+		if (_eval.apply_ctx)
+			_eval.apply_ctx[y]->jacobian(d2,J);
+		else
+			a.func.deriv_calculator().jacobian(d2,J);
 		tmp_g = g[y].v()*J; // pre-multiplication by y.g
 		tmp_g += old_g;
 		load(g2,tmp_g);
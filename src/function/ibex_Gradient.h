@@ -44,6 +44,20 @@ public:
 	 */
 	void gradient(const IntervalVector& box, IntervalVector& g);
 
+	/**
+	 * \brief Calculate the derivatives of f on the box \a box w.r.t. the used
+	 * variables only and store the result in \a g.
+	 *
+	 * g[k] is set to the derivative w.r.t. the kth used variable
+	 * (see #ibex::Function::used_var(int) const). The cost does not
+	 * depend on the total number of variables.
+	 *
+	 * \return false if the box is outside the definition domain of f
+	 *         (g is then unspecified).
+	 * \pre f must be real-valued with real arguments.
+	 */
+	bool sparse_gradient(const IntervalVector& box, Interval* g);
+
 	/**
 	 * \brief Calculate the Jacobian on the domains \a d and store the result in \a J.
 	 */
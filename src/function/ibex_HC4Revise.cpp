@@ -67,6 +67,8 @@ bool HC4Revise::backward(const Domain& y) {
 	case Dim::MATRIX_ARRAY: assert(false); /* impossible */ break;
 	}
 
+	eval.domains_modified();
+
 	root &= y;
 
 	if (root.is_empty())
@@ -96,7 +98,8 @@ void HC4Revise::apply_bwd(int* x, int y) {
 	// it will be caught by proj(...,IntervalVector& x).
 	// (it is a protected function, not called outside of the class
 	// so there is no risk)
-	a.func.hc4revise().proj(d[y],d2);
+	HC4Revise& h = eval.apply_ctx ? eval.apply_ctx[y]->hc4revise : a.func.hc4revise();
+	h.proj(d[y],d2);
 }
 
 void HC4Revise::vector_bwd(int* x, int y) {
@@ -0,0 +1,398 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Hessian.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_Hessian.h"
+
+using namespace std;
+
+namespace ibex {
+
+Hessian::Hessian(Eval& e): f(e.f), _eval(e), d(e.d), dt(f), g(f), gt(f) {
+	if (!is_supported(f))
+		not_implemented("Hessian of functions with non-real operations");
+}
+
+bool Hessian::is_supported(const Function& f) {
+	if (!f.expr().dim.is_scalar()) return false;
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprNode& e=f.node(i);
+
+		// the domains of the components are references
+		if (dynamic_cast<const ExprLeaf*>(&e) || dynamic_cast<const ExprIndex*>(&e))
+			continue;
+
+		// function calls, vectors and chi
+		if (dynamic_cast<const ExprNAryOp*>(&e))
+			return false;
+
+		if (!e.dim.is_scalar()) return false;
+
+		const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e);
+		if (b && (!b->left.dim.is_scalar() || !b->right.dim.is_scalar()))
+			return false;
+
+		const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e);
+		if (u && !u->expr.dim.is_scalar())
+			return false;
+	}
+	return true;
+}
+
+void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector& v, IntervalVector& hv) {
+	assert(box.size()==f.nb_var());
+	assert(v.size()==f.nb_var());
+	assert(hv.size()==f.nb_var());
+
+	if (_eval.eval(box).is_empty()) {
+		// outside definition domain -> empty result
+		hv.set_empty(); return;
+	}
+
+	hessian_vector(v,hv);
+}
+
+void Hessian::hessian(const IntervalVector& box, IntervalMatrix& H) {
+	assert(box.size()==f.nb_var());
+	assert(H.nb_rows()==f.nb_var());
+	assert(H.nb_cols()==f.nb_var());
+
+	if (_eval.eval(box).is_empty()) {
+		// outside definition domain -> empty matrix
+		H.set_empty(); return;
+	}
+
+	H.clear();
+
+	IntervalVector v(f.nb_var(),Interval::ZERO);
+	IntervalVector hv(f.nb_var());
+
+	// the domains are evaluated once for all the columns
+	for (int k=0; k<f.nb_used_vars(); k++) {
+		int j=f.used_var(k);
+		v[j]=1.0;
+		hessian_vector(v,hv);
+		H.set_col(j,hv);
+		v[j]=0.0;
+	}
+}
+
+void Hessian::hessian_vector(const IntervalVector& v, IntervalVector& hv) {
+
+	dt.write_arg_domains(v);
+
+	// calculate the tangents and set the adjoints to zero
+	f.forward<Hessian>(*this);
+
+	g.top->i()=1.0;
+	gt.top->i()=0.0;
+
+	f.backward<Hessian>(*this);
+
+	hv.clear();
+	gt.read_arg_domains(hv);
+}
+
+void Hessian::unary_fwd(int x, int y, const Interval& u1) {
+	dt[y].i()=u1*dt[x].i();
+	g[y].i()=0;
+	gt[y].i()=0;
+}
+
+void Hessian::unary_bwd(int x, int y, const Interval& u1, const Interval& u2) {
+	g[x].i()  += g[y].i()*u1;
+	gt[x].i() += gt[y].i()*u1 + g[y].i()*u2*dt[x].i();
+}
+
+void Hessian::binary_fwd(int x1, int x2, int y, const Interval& p1, const Interval& p2) {
+	dt[y].i()=p1*dt[x1].i() + p2*dt[x2].i();
+	g[y].i()=0;
+	gt[y].i()=0;
+}
+
+void Hessian::binary_bwd(int x1, int x2, int y, const Interval& p1, const Interval& p2,
+		const Interval& p11, const Interval& p12, const Interval& p22) {
+	// note: x1 and x2 may be the same node
+	Interval t1=gt[y].i()*p1 + g[y].i()*(p11*dt[x1].i() + p12*dt[x2].i());
+	Interval t2=gt[y].i()*p2 + g[y].i()*(p12*dt[x1].i() + p22*dt[x2].i());
+	g[x1].i()  += g[y].i()*p1;
+	g[x2].i()  += g[y].i()*p2;
+	gt[x1].i() += t1;
+	gt[x2].i() += t2;
+}
+
+/* ====================================== Leaves =================================== */
+
+void Hessian::cst_fwd(int y) {
+	dt[y].clear();
+	g[y].clear();
+	gt[y].clear();
+}
+
+void Hessian::symbol_fwd(int y) {
+	// the tangent is the direction (see hessian_vector)
+	g[y].clear();
+	gt[y].clear();
+}
+
+/* ====================================== Binary operators =================================== */
+
+void Hessian::add_fwd(int x1, int x2, int y) {
+	dt[y].i()=dt[x1].i()+dt[x2].i();
+	g[y].i()=0;
+	gt[y].i()=0;
+}
+
+void Hessian::add_bwd(int x1, int x2, int y) {
+	g[x1].i()  += g[y].i();  g[x2].i()  += g[y].i();
+	gt[x1].i() += gt[y].i(); gt[x2].i() += gt[y].i();
+}
+
+void Hessian::sub_fwd(int x1, int x2, int y) {
+	dt[y].i()=dt[x1].i()-dt[x2].i();
+	g[y].i()=0;
+	gt[y].i()=0;
+}
+
+void Hessian::sub_bwd(int x1, int x2, int y) {
+	g[x1].i()  += g[y].i();  g[x2].i()  -= g[y].i();
+	gt[x1].i() += gt[y].i(); gt[x2].i() -= gt[y].i();
+}
+
+void Hessian::mul_fwd(int x1, int x2, int y) {
+	binary_fwd(x1,x2,y,d[x2].i(),d[x1].i());
+}
+
+void Hessian::mul_bwd(int x1, int x2, int y) {
+	binary_bwd(x1,x2,y,d[x2].i(),d[x1].i(),Interval::ZERO,Interval::ONE,Interval::ZERO);
+}
+
+void Hessian::div_fwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	binary_fwd(x1,x2,y,1.0/b,-a/sqr(b));
+}
+
+void Hessian::div_bwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	Interval b2=sqr(b);
+	binary_bwd(x1,x2,y,1.0/b,-a/b2,Interval::ZERO,-1.0/b2,2.0*a/(b2*b));
+}
+
+void Hessian::max_fwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		binary_fwd(x1,x2,y,Interval::ONE,Interval::ZERO);
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		binary_fwd(x1,x2,y,Interval::ZERO,Interval::ONE);
+	else
+		binary_fwd(x1,x2,y,Interval(0,1),Interval(0,1));
+}
+
+void Hessian::max_bwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		binary_bwd(x1,x2,y,Interval::ONE,Interval::ZERO,Interval::ZERO,Interval::ZERO,Interval::ZERO);
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		binary_bwd(x1,x2,y,Interval::ZERO,Interval::ONE,Interval::ZERO,Interval::ZERO,Interval::ZERO);
+	else
+		// non-differentiable
+		binary_bwd(x1,x2,y,Interval(0,1),Interval(0,1),Interval::ALL_REALS,Interval::ALL_REALS,Interval::ALL_REALS);
+}
+
+void Hessian::min_fwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		binary_fwd(x1,x2,y,Interval::ZERO,Interval::ONE);
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		binary_fwd(x1,x2,y,Interval::ONE,Interval::ZERO);
+	else
+		binary_fwd(x1,x2,y,Interval(0,1),Interval(0,1));
+}
+
+void Hessian::min_bwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		binary_bwd(x1,x2,y,Interval::ZERO,Interval::ONE,Interval::ZERO,Interval::ZERO,Interval::ZERO);
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		binary_bwd(x1,x2,y,Interval::ONE,Interval::ZERO,Interval::ZERO,Interval::ZERO,Interval::ZERO);
+	else
+		// non-differentiable
+		binary_bwd(x1,x2,y,Interval(0,1),Interval(0,1),Interval::ALL_REALS,Interval::ALL_REALS,Interval::ALL_REALS);
+}
+
+void Hessian::atan2_fwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	Interval r=sqr(a)+sqr(b);
+	binary_fwd(x1,x2,y,b/r,-a/r);
+}
+
+void Hessian::atan2_bwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	Interval r=sqr(a)+sqr(b);
+	Interval r2=sqr(r);
+	Interval ab2=2.0*a*b/r2;
+	binary_bwd(x1,x2,y,b/r,-a/r,-ab2,(sqr(a)-sqr(b))/r2,ab2);
+}
+
+/* ====================================== Unary operators =================================== */
+
+void Hessian::minus_fwd(int x, int y) { unary_fwd(x,y,Interval(-1)); }
+void Hessian::minus_bwd(int x, int y) { unary_bwd(x,y,Interval(-1),Interval::ZERO); }
+
+void Hessian::sign_fwd(int x, int y) {
+	unary_fwd(x,y,d[x].i().contains(0) ? Interval::POS_REALS : Interval::ZERO);
+}
+
+void Hessian::sign_bwd(int x, int y) {
+	if (d[x].i().contains(0)) unary_bwd(x,y,Interval::POS_REALS,Interval::ALL_REALS);
+	else ; // nothing to do: derivatives are zero
+}
+
+void Hessian::abs_fwd(int x, int y) {
+	if (d[x].i().lb()>=0) unary_fwd(x,y,Interval::ONE);
+	else if (d[x].i().ub()<=0) unary_fwd(x,y,Interval(-1));
+	else unary_fwd(x,y,Interval(-1,1));
+}
+
+void Hessian::abs_bwd(int x, int y) {
+	if (d[x].i().lb()>=0) unary_bwd(x,y,Interval::ONE,Interval::ZERO);
+	else if (d[x].i().ub()<=0) unary_bwd(x,y,Interval(-1),Interval::ZERO);
+	else unary_bwd(x,y,Interval(-1,1),Interval::ALL_REALS);
+}
+
+void Hessian::power_fwd(int x, int y, int p) {
+	unary_fwd(x,y,p==0 ? Interval::ZERO : p*pow(d[x].i(),p-1));
+}
+
+void Hessian::power_bwd(int x, int y, int p) {
+	unary_bwd(x,y,p==0 ? Interval::ZERO : p*pow(d[x].i(),p-1),
+			p==0 || p==1 ? Interval::ZERO : p*(p-1)*pow(d[x].i(),p-2));
+}
+
+void Hessian::sqr_fwd(int x, int y) { unary_fwd(x,y,2.0*d[x].i()); }
+void Hessian::sqr_bwd(int x, int y) { unary_bwd(x,y,2.0*d[x].i(),Interval(2.0)); }
+
+void Hessian::sqrt_fwd(int x, int y) { unary_fwd(x,y,0.5/sqrt(d[x].i())); }
+void Hessian::sqrt_bwd(int x, int y) {
+	Interval s=sqrt(d[x].i());
+	unary_bwd(x,y,0.5/s,-0.25/(d[x].i()*s));
+}
+
+void Hessian::exp_fwd(int x, int y) { unary_fwd(x,y,exp(d[x].i())); }
+void Hessian::exp_bwd(int x, int y) {
+	Interval e=exp(d[x].i());
+	unary_bwd(x,y,e,e);
+}
+
+void Hessian::log_fwd(int x, int y) { unary_fwd(x,y,1.0/d[x].i()); }
+void Hessian::log_bwd(int x, int y) { unary_bwd(x,y,1.0/d[x].i(),-1.0/sqr(d[x].i())); }
+
+void Hessian::cos_fwd(int x, int y) { unary_fwd(x,y,-sin(d[x].i())); }
+void Hessian::cos_bwd(int x, int y) { unary_bwd(x,y,-sin(d[x].i()),-cos(d[x].i())); }
+
+void Hessian::sin_fwd(int x, int y) { unary_fwd(x,y,cos(d[x].i())); }
+void Hessian::sin_bwd(int x, int y) { unary_bwd(x,y,cos(d[x].i()),-sin(d[x].i())); }
+
+void Hessian::tan_fwd(int x, int y) { unary_fwd(x,y,1.0+sqr(tan(d[x].i()))); }
+void Hessian::tan_bwd(int x, int y) {
+	Interval t=tan(d[x].i());
+	Interval u1=1.0+sqr(t);
+	unary_bwd(x,y,u1,2.0*t*u1);
+}
+
+void Hessian::cosh_fwd(int x, int y) { unary_fwd(x,y,sinh(d[x].i())); }
+void Hessian::cosh_bwd(int x, int y) { unary_bwd(x,y,sinh(d[x].i()),cosh(d[x].i())); }
+
+void Hessian::sinh_fwd(int x, int y) { unary_fwd(x,y,cosh(d[x].i())); }
+void Hessian::sinh_bwd(int x, int y) { unary_bwd(x,y,cosh(d[x].i()),sinh(d[x].i())); }
+
+void Hessian::tanh_fwd(int x, int y) { unary_fwd(x,y,1.0-sqr(tanh(d[x].i()))); }
+void Hessian::tanh_bwd(int x, int y) {
+	Interval t=tanh(d[x].i());
+	Interval u1=1.0-sqr(t);
+	unary_bwd(x,y,u1,-2.0*t*u1);
+}
+
+void Hessian::acos_fwd(int x, int y) { unary_fwd(x,y,-1.0/sqrt(1.0-sqr(d[x].i()))); }
+void Hessian::acos_bwd(int x, int y) {
+	Interval r=1.0-sqr(d[x].i());
+	Interval s=sqrt(r);
+	unary_bwd(x,y,-1.0/s,-d[x].i()/(r*s));
+}
+
+void Hessian::asin_fwd(int x, int y) { unary_fwd(x,y,1.0/sqrt(1.0-sqr(d[x].i()))); }
+void Hessian::asin_bwd(int x, int y) {
+	Interval r=1.0-sqr(d[x].i());
+	Interval s=sqrt(r);
+	unary_bwd(x,y,1.0/s,d[x].i()/(r*s));
+}
+
+void Hessian::atan_fwd(int x, int y) { unary_fwd(x,y,1.0/(1.0+sqr(d[x].i()))); }
+void Hessian::atan_bwd(int x, int y) {
+	Interval r=1.0+sqr(d[x].i());
+	unary_bwd(x,y,1.0/r,-2.0*d[x].i()/sqr(r));
+}
+
+void Hessian::acosh_fwd(int x, int y) { unary_fwd(x,y,1.0/sqrt(sqr(d[x].i())-1.0)); }
+void Hessian::acosh_bwd(int x, int y) {
+	Interval r=sqr(d[x].i())-1.0;
+	Interval s=sqrt(r);
+	unary_bwd(x,y,1.0/s,-d[x].i()/(r*s));
+}
+
+void Hessian::asinh_fwd(int x, int y) { unary_fwd(x,y,1.0/sqrt(1.0+sqr(d[x].i()))); }
+void Hessian::asinh_bwd(int x, int y) {
+	Interval r=1.0+sqr(d[x].i());
+	Interval s=sqrt(r);
+	unary_bwd(x,y,1.0/s,-d[x].i()/(r*s));
+}
+
+void Hessian::atanh_fwd(int x, int y) { unary_fwd(x,y,1.0/(1.0-sqr(d[x].i()))); }
+void Hessian::atanh_bwd(int x, int y) {
+	Interval r=1.0-sqr(d[x].i());
+	unary_bwd(x,y,1.0/r,2.0*d[x].i()/sqr(r));
+}
+
+/* ====================================== Not supported =================================== */
+
+void Hessian::vector_fwd(int*, int)           { assert(false); }
+void Hessian::apply_fwd(int*, int)            { assert(false); }
+void Hessian::chi_fwd(int, int, int, int)     { assert(false); }
+void Hessian::trans_V_fwd(int, int)           { assert(false); }
+void Hessian::trans_M_fwd(int, int)           { assert(false); }
+void Hessian::add_V_fwd(int, int, int)        { assert(false); }
+void Hessian::add_M_fwd(int, int, int)        { assert(false); }
+void Hessian::mul_SV_fwd(int, int, int)       { assert(false); }
+void Hessian::mul_SM_fwd(int, int, int)       { assert(false); }
+void Hessian::mul_VV_fwd(int, int, int)       { assert(false); }
+void Hessian::mul_MV_fwd(int, int, int)       { assert(false); }
+void Hessian::mul_VM_fwd(int, int, int)       { assert(false); }
+void Hessian::mul_MM_fwd(int, int, int)       { assert(false); }
+void Hessian::sub_V_fwd(int, int, int)        { assert(false); }
+void Hessian::sub_M_fwd(int, int, int)        { assert(false); }
+
+void Hessian::vector_bwd(int*, int)           { assert(false); }
+void Hessian::apply_bwd(int*, int)            { assert(false); }
+void Hessian::chi_bwd(int, int, int, int)     { assert(false); }
+void Hessian::trans_V_bwd(int, int)           { assert(false); }
+void Hessian::trans_M_bwd(int, int)           { assert(false); }
+void Hessian::add_V_bwd(int, int, int)        { assert(false); }
+void Hessian::add_M_bwd(int, int, int)        { assert(false); }
+void Hessian::mul_SV_bwd(int, int, int)       { assert(false); }
+void Hessian::mul_SM_bwd(int, int, int)       { assert(false); }
+void Hessian::mul_VV_bwd(int, int, int)       { assert(false); }
+void Hessian::mul_MV_bwd(int, int, int)       { assert(false); }
+void Hessian::mul_VM_bwd(int, int, int)       { assert(false); }
+void Hessian::mul_MM_bwd(int, int, int)       { assert(false); }
+void Hessian::sub_V_bwd(int, int, int)        { assert(false); }
+void Hessian::sub_M_bwd(int, int, int)        { assert(false); }
+
+} // namespace ibex
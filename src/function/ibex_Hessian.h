@@ -0,0 +1,200 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Hessian.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_HESSIAN_H__
+#define __IBEX_HESSIAN_H__
+
+#include "ibex_Eval.h"
+#include "ibex_BwdAlgorithm.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Calculates the Hessian matrix of a function (forward-over-reverse).
+ *
+ * The reverse pass of #ibex::Gradient is differentiated in the direction of a
+ * vector v: the forward pass calculates the directional derivative of each node
+ * and the backward pass calculates the adjoint of each node (the gradient) with
+ * its directional derivative. The latter gives, for the symbols, the product of
+ * the Hessian matrix by v. The cost of a product is proportional to the size of
+ * the DAG; the Hessian matrix is obtained with one product per used variable.
+ *
+ * Only real-valued functions with real operations are supported: the symbols
+ * can be vectors or matrices but only through their (real) components.
+ */
+class Hessian : public FwdAlgorithm, public BwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the Hessian algorithm.
+	 *
+	 * For memory saving, the algorithm is built from an
+	 * already existing Eval object (like #ibex::Gradient).
+	 *
+	 * \pre f must be supported (see #is_supported(const Function&)).
+	 */
+	Hessian(Eval& eval);
+
+	/**
+	 * \brief True if the Hessian of f can be calculated by this class.
+	 */
+	static bool is_supported(const Function& f);
+
+	/**
+	 * \brief Calculate the product of the Hessian matrix of f on \a box by \a v.
+	 *
+	 * \a hv is set to the empty vector if the box is outside the definition domain of f.
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector& v, IntervalVector& hv);
+
+	/**
+	 * \brief Calculate the Hessian matrix of f on \a box and store the result in \a H.
+	 *
+	 * The jth column is the product of the Hessian matrix by the jth unit vector.
+	 * The columns of the variables that are not used by f are zero.
+	 */
+	void hessian(const IntervalVector& box, IntervalMatrix& H);
+
+	/* ====================================== Forward =================================== */
+
+	inline void index_fwd(int , int ) { /* nothing to do */ }
+	       void vector_fwd(int* x, int y);
+	       void cst_fwd(int y);
+	       void symbol_fwd(int y);
+	       void apply_fwd(int* x, int y);
+	       void chi_fwd(int x1, int x2, int x3, int y);
+	       void add_fwd(int x1, int x2, int y);
+	       void mul_fwd(int x1, int x2, int y);
+	       void sub_fwd(int x1, int x2, int y);
+	       void div_fwd(int x1, int x2, int y);
+	       void max_fwd(int x1, int x2, int y);
+	       void min_fwd(int x1, int x2, int y);
+	       void atan2_fwd(int x1, int x2, int y);
+	       void minus_fwd(int x, int y);
+	       void trans_V_fwd(int x, int y);
+	       void trans_M_fwd(int x, int y);
+	       void sign_fwd(int x, int y);
+	       void abs_fwd(int x, int y);
+	       void power_fwd(int x, int y, int p);
+	       void sqr_fwd(int x, int y);
+	       void sqrt_fwd(int x, int y);
+	       void exp_fwd(int x, int y);
+	       void log_fwd(int x, int y);
+	       void cos_fwd(int x, int y);
+	       void sin_fwd(int x, int y);
+	       void tan_fwd(int x, int y);
+	       void cosh_fwd(int x, int y);
+	       void sinh_fwd(int x, int y);
+	       void tanh_fwd(int x, int y);
+	       void acos_fwd(int x, int y);
+	       void asin_fwd(int x, int y);
+	       void atan_fwd(int x, int y);
+	       void acosh_fwd(int x, int y);
+	       void asinh_fwd(int x, int y);
+	       void atanh_fwd(int x, int y);
+	       void add_V_fwd(int x1, int x2, int y);
+	       void add_M_fwd(int x1, int x2, int y);
+	       void mul_SV_fwd(int x1, int x2, int y);
+	       void mul_SM_fwd(int x1, int x2, int y);
+	       void mul_VV_fwd(int x1, int x2, int y);
+	       void mul_MV_fwd(int x1, int x2, int y);
+	       void mul_VM_fwd(int x1, int x2, int y);
+	       void mul_MM_fwd(int x1, int x2, int y);
+	       void sub_V_fwd(int x1, int x2, int y);
+	       void sub_M_fwd(int x1, int x2, int y);
+
+	/* ====================================== Backward =================================== */
+
+	inline void index_bwd  (int, int) { /* nothing to do: the domains are references */ }
+	       void vector_bwd (int* x, int y);
+	inline void symbol_bwd (int) { /* nothing to do */ }
+	inline void cst_bwd    (int) { /* nothing to do */ }
+	       void apply_bwd  (int* x, int y);
+	       void chi_bwd    (int x1, int x2, int x3, int y);
+	       void add_bwd    (int x1, int x2, int y);
+	       void mul_bwd    (int x1, int x2, int y);
+	       void sub_bwd    (int x1, int x2, int y);
+	       void div_bwd    (int x1, int x2, int y);
+	       void max_bwd    (int x1, int x2, int y);
+	       void min_bwd    (int x1, int x2, int y);
+	       void atan2_bwd  (int x1, int x2, int y);
+	       void minus_bwd  (int x, int y);
+	       void trans_V_bwd(int x, int y);
+	       void trans_M_bwd(int x, int y);
+	       void sign_bwd   (int x, int y);
+	       void abs_bwd    (int x, int y);
+	       void power_bwd  (int x, int y, int p);
+	       void sqr_bwd    (int x, int y);
+	       void sqrt_bwd   (int x, int y);
+	       void exp_bwd    (int x, int y);
+	       void log_bwd    (int x, int y);
+	       void cos_bwd    (int x, int y);
+	       void sin_bwd    (int x, int y);
+	       void tan_bwd    (int x, int y);
+	       void cosh_bwd   (int x, int y);
+	       void sinh_bwd   (int x, int y);
+	       void tanh_bwd   (int x, int y);
+	       void acos_bwd   (int x, int y);
+	       void asin_bwd   (int x, int y);
+	       void atan_bwd   (int x, int y);
+	       void acosh_bwd  (int x, int y);
+	       void asinh_bwd  (int x, int y);
+	       void atanh_bwd  (int x, int y);
+	       void add_V_bwd  (int x1, int x2, int y);
+	       void add_M_bwd  (int x1, int x2, int y);
+	       void mul_SV_bwd (int x1, int x2, int y);
+	       void mul_SM_bwd (int x1, int x2, int y);
+	       void mul_VV_bwd (int x1, int x2, int y);
+	       void mul_MV_bwd (int x1, int x2, int y);
+	       void mul_VM_bwd (int x1, int x2, int y);
+	       void mul_MM_bwd (int x1, int x2, int y);
+	       void sub_V_bwd  (int x1, int x2, int y);
+	       void sub_M_bwd  (int x1, int x2, int y);
+
+	Function& f;
+	Eval& _eval;
+	ExprDomain& d;
+
+	/** Directional derivatives (tangents) of the nodes. */
+	ExprDomain dt;
+
+	/** Adjoints of the nodes (the gradient). */
+	ExprDomain g;
+
+	/** Directional derivatives of the adjoints. */
+	ExprDomain gt;
+
+protected:
+	/*
+	 * Run the forward and backward passes in the direction v,
+	 * once the domains d have been evaluated.
+	 */
+	void hessian_vector(const IntervalVector& v, IntervalVector& hv);
+
+	/*
+	 * Tangent and adjoints of y=u(x) where u1 and u2 are the
+	 * first and second derivatives of u on d[x].
+	 */
+	void unary_fwd(int x, int y, const Interval& u1);
+	void unary_bwd(int x, int y, const Interval& u1, const Interval& u2);
+
+	/*
+	 * Tangent and adjoints of y=u(x1,x2) where (p1,p2) is the
+	 * gradient and (p11,p12,p22) the Hessian of u on (d[x1],d[x2]).
+	 */
+	void binary_fwd(int x1, int x2, int y, const Interval& p1, const Interval& p2);
+	void binary_bwd(int x1, int x2, int y, const Interval& p1, const Interval& p2,
+			const Interval& p11, const Interval& p12, const Interval& p22);
+};
+
+} // namespace ibex
+
+#endif // __IBEX_HESSIAN_H__
@@ -41,6 +41,8 @@ void InHC4Revise::iproj(const Domain& y, IntervalVector& x, const IntervalVector
 		return;
 	}
 
+	eval.domains_modified();
+
 	*d.top = y;
 
 	try {
@@ -66,6 +68,8 @@ void InHC4Revise::iproj(const Domain& y, Array<Domain>& x, const Array<Domain>&
 
 	assert(argP[0].is_empty() || !d.top->is_empty());
 
+	eval.domains_modified();
+
 	*d.top = y;
 
 	// may throw EmptyBoxException&) {
@@ -94,7 +98,8 @@ void InHC4Revise::apply_bwd(int* x, int y) {
 	// it will be caught by iproj(...,IntervalVector& x).
 	// (it is a protected function, not called outside of the class
 	// so there is no risk)
-	a.func.inhc4revise().iproj(d[y],d2,p2);
+	InHC4Revise& h = eval.apply_ctx ? eval.apply_ctx[y]->inhc4revise : a.func.inhc4revise();
+	h.iproj(d[y],d2,p2);
 }
 
 } // end namespace ibex
@@ -0,0 +1,591 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NativeFunction.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_NativeFunction.h"
+#include "ibex_Function.h"
+
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const char* NativeFunction::default_compiler="c++ -O2 -shared -fPIC -frounding-math `pkg-config --cflags ibex`";
+
+namespace {
+
+/*
+ * Code common to all the functions.
+ *
+ * The derivatives of the non-smooth operators are the same as in Gradient.
+ */
+const char* prologue=
+"#include \"ibex_Interval.h\"\n"
+"\n"
+"namespace ibex {\n"
+"\n"
+"static inline int native_empty(Interval* v) { v[0]=Interval::EMPTY_SET; return 0; }\n"
+"\n"
+"static inline void grad_chi(const Interval& gy, const Interval& a, const Interval& b, const Interval& c, Interval& ga, Interval& gb, Interval& gc) {\n"
+"\tif (a.ub()<0) { ga+=gy*Interval::ZERO; gb+=gy*Interval::ONE; gc+=gy*Interval::ZERO; }\n"
+"\telse if (a.lb()>0) { ga+=gy*Interval::ZERO; gb+=gy*Interval::ZERO; gc+=gy*Interval::ONE; }\n"
+"\telse {\n"
+"\t\tif (b.is_degenerated() && c.is_degenerated()) {\n"
+"\t\t\tif (b.ub()<c.ub()) ga+=gy*Interval::POS_REALS;\n"
+"\t\t\telse if (b.ub()>c.ub()) ga+=gy*Interval::NEG_REALS;\n"
+"\t\t\telse ga+=gy*Interval::ZERO;\n"
+"\t\t} else ga+=gy*Interval::ALL_REALS;\n"
+"\t\tgb+=gy*Interval(0,1);\n"
+"\t\tgc+=gy*Interval(0,1);\n"
+"\t}\n"
+"}\n"
+"\n"
+"static inline void grad_max(const Interval& gy, const Interval& x1, const Interval& x2, Interval& g1, Interval& g2) {\n"
+"\tif (x1.lb()>x2.ub()) { g1+=gy*Interval::ONE; g2+=gy*Interval::ZERO; }\n"
+"\telse if (x2.lb()>x1.ub()) { g1+=gy*Interval::ZERO; g2+=gy*Interval::ONE; }\n"
+"\telse { g1+=gy*Interval(0,1); g2+=gy*Interval(0,1); }\n"
+"}\n"
+"\n"
+"static inline void grad_sign(const Interval& gy, const Interval& x, Interval& gx) {\n"
+"\tif (x.contains(0)) gx+=gy*Interval::POS_REALS;\n"
+"}\n"
+"\n"
+"static inline void grad_abs(const Interval& gy, const Interval& x, Interval& gx) {\n"
+"\tif (x.lb()>=0) gx+=1.0*gy;\n"
+"\telse if (x.ub()<=0) gx+=-1.0*gy;\n"
+"\telse gx+=Interval(-1,1)*gy;\n"
+"}\n"
+"\n";
+
+/* Write a double such that it is read back exactly */
+void print_dbl(ostream& os, double x) {
+	if (x==POS_INFINITY) os << "POS_INFINITY";
+	else if (x==NEG_INFINITY) os << "NEG_INFINITY";
+	else os << setprecision(17) << x;
+}
+
+/*
+ * Base class of the generators: each operation of the compiled
+ * function is written as one line of C++ code.
+ *
+ * The domain (resp. derivative) of the ith node is v[i] (resp. g[i]).
+ */
+class CodeGen : public FwdAlgorithm, public BwdAlgorithm {
+public:
+	CodeGen(const Function& f, ostream& os) : f(f), os(os) { }
+
+	/* node y (as a string) */
+	string v(int y) { ostringstream s; s << "v[" << y << "]"; return s.str(); }
+	string g(int y) { ostringstream s; s << "g[" << y << "]"; return s.str(); }
+
+	/* index of the variable of a symbol */
+	int key(int y) { return ((const ExprSymbol&) f.node(y)).key; }
+
+	/* operations on vectors, matrices and function calls (excluded by is_supported) */
+	void unsupported() { assert(false); }
+
+	const Function& f;
+	ostream& os;
+};
+
+/* Forward evaluation */
+class FwdGen : public CodeGen {
+public:
+	FwdGen(const Function& f, ostream& os) : CodeGen(f,os) { }
+
+	void eval(int y, const char* op, int x) {
+		os << '\t' << v(y) << '=' << op << '(' << v(x) << ");\n";
+	}
+
+	void eval(int y, const char* op, int x1, int x2) {
+		os << '\t' << v(y) << '=' << op << '(' << v(x1) << ',' << v(x2) << ");\n";
+	}
+
+	void infix(int y, char op, int x1, int x2) {
+		os << '\t' << v(y) << '=' << v(x1) << op << v(x2) << ";\n";
+	}
+
+	/* an operator whose result can be empty on a non-empty argument */
+	void eval_check(int y, const char* op, int x) {
+		os << "\tif ((" << v(y) << '=' << op << '(' << v(x) << ")).is_empty()) return native_empty(v);\n";
+	}
+
+	void symbol_fwd(int y) { os << '\t' << v(y) << "=x[" << key(y) << "];\n"; }
+	void cst_fwd(int y) {
+		const Interval& c=((const ExprConstant&) f.node(y)).get_value();
+		os << '\t' << v(y) << '=';
+		if (c.is_empty())
+			os << "Interval::EMPTY_SET";
+		else {
+			os << "Interval(";
+			print_dbl(os,c.lb());
+			os << ',';
+			print_dbl(os,c.ub());
+			os << ')';
+		}
+		os << ";\n";
+	}
+	void chi_fwd(int a, int b, int c, int y) { os << '\t' << v(y) << "=chi(" << v(a) << ',' << v(b) << ',' << v(c) << ");\n"; }
+	void add_fwd(int x1, int x2, int y)   { infix(y,'+',x1,x2); }
+	void mul_fwd(int x1, int x2, int y)   { infix(y,'*',x1,x2); }
+	void sub_fwd(int x1, int x2, int y)   { infix(y,'-',x1,x2); }
+	void div_fwd(int x1, int x2, int y)   { infix(y,'/',x1,x2); }
+	void max_fwd(int x1, int x2, int y)   { eval(y,"max",x1,x2); }
+	void min_fwd(int x1, int x2, int y)   { eval(y,"min",x1,x2); }
+	void atan2_fwd(int x1, int x2, int y) { eval(y,"atan2",x1,x2); }
+	void minus_fwd(int x, int y)          { os << '\t' << v(y) << "=-" << v(x) << ";\n"; }
+	void sign_fwd(int x, int y)           { eval(y,"sign",x); }
+	void abs_fwd(int x, int y)            { eval(y,"abs",x); }
+	void power_fwd(int x, int y, int p)   { os << '\t' << v(y) << "=pow(" << v(x) << ',' << p << ");\n"; }
+	void sqr_fwd(int x, int y)            { eval(y,"sqr",x); }
+	void sqrt_fwd(int x, int y)           { eval_check(y,"sqrt",x); }
+	void exp_fwd(int x, int y)            { eval(y,"exp",x); }
+	void log_fwd(int x, int y)            { eval_check(y,"log",x); }
+	void cos_fwd(int x, int y)            { eval(y,"cos",x); }
+	void sin_fwd(int x, int y)            { eval(y,"sin",x); }
+	void tan_fwd(int x, int y)            { eval_check(y,"tan",x); }
+	void cosh_fwd(int x, int y)           { eval(y,"cosh",x); }
+	void sinh_fwd(int x, int y)           { eval(y,"sinh",x); }
+	void tanh_fwd(int x, int y)           { eval(y,"tanh",x); }
+	void acos_fwd(int x, int y)           { eval_check(y,"acos",x); }
+	void asin_fwd(int x, int y)           { eval_check(y,"asin",x); }
+	void atan_fwd(int x, int y)           { eval(y,"atan",x); }
+	void acosh_fwd(int x, int y)          { eval_check(y,"acosh",x); }
+	void asinh_fwd(int x, int y)          { eval(y,"asinh",x); }
+	void atanh_fwd(int x, int y)          { eval_check(y,"atanh",x); }
+
+	void index_fwd(int, int)              { unsupported(); }
+	void vector_fwd(int*, int)            { unsupported(); }
+	void apply_fwd(int*, int)             { unsupported(); }
+	void trans_V_fwd(int, int)            { unsupported(); }
+	void trans_M_fwd(int, int)            { unsupported(); }
+	void add_V_fwd(int, int, int)         { unsupported(); }
+	void add_M_fwd(int, int, int)         { unsupported(); }
+	void mul_SV_fwd(int, int, int)        { unsupported(); }
+	void mul_SM_fwd(int, int, int)        { unsupported(); }
+	void mul_VV_fwd(int, int, int)        { unsupported(); }
+	void mul_MV_fwd(int, int, int)        { unsupported(); }
+	void mul_VM_fwd(int, int, int)        { unsupported(); }
+	void mul_MM_fwd(int, int, int)        { unsupported(); }
+	void sub_V_fwd(int, int, int)         { unsupported(); }
+	void sub_M_fwd(int, int, int)         { unsupported(); }
+};
+
+/* Backward projection (same as HC4Revise) */
+class ProjGen : public CodeGen {
+public:
+	ProjGen(const Function& f, ostream& os) : CodeGen(f,os) { }
+
+	void proj(const char* op, int y, int x) {
+		os << "\tif (!bwd_" << op << '(' << v(y) << ',' << v(x) << ")) return 0;\n";
+	}
+
+	void proj(const char* op, int y, int x1, int x2) {
+		os << "\tif (!bwd_" << op << '(' << v(y) << ',' << v(x1) << ',' << v(x2) << ")) return 0;\n";
+	}
+
+	void symbol_bwd(int)                  { /* nothing to do */ }
+	void cst_bwd(int)                     { /* nothing to do */ }
+	void chi_bwd(int a, int b, int c, int y) { os << "\tif (!bwd_chi(" << v(y) << ',' << v(a) << ',' << v(b) << ',' << v(c) << ")) return 0;\n"; }
+	void add_bwd(int x1, int x2, int y)   { proj("add",y,x1,x2); }
+	void mul_bwd(int x1, int x2, int y)   { proj("mul",y,x1,x2); }
+	void sub_bwd(int x1, int x2, int y)   { proj("sub",y,x1,x2); }
+	void div_bwd(int x1, int x2, int y)   { proj("div",y,x1,x2); }
+	void max_bwd(int x1, int x2, int y)   { proj("max",y,x1,x2); }
+	void min_bwd(int x1, int x2, int y)   { proj("min",y,x1,x2); }
+	void atan2_bwd(int x1, int x2, int y) { proj("atan2",y,x1,x2); }
+	void minus_bwd(int x, int y)          { os << "\tif ((" << v(x) << "&=-" << v(y) << ").is_empty()) return 0;\n"; }
+	void sign_bwd(int x, int y)           { proj("sign",y,x); }
+	void abs_bwd(int x, int y)            { proj("abs",y,x); }
+	void power_bwd(int x, int y, int p)   { os << "\tif (!bwd_pow(" << v(y) << ',' << p << ',' << v(x) << ")) return 0;\n"; }
+	void sqr_bwd(int x, int y)            { proj("sqr",y,x); }
+	void sqrt_bwd(int x, int y)           { proj("sqrt",y,x); }
+	void exp_bwd(int x, int y)            { proj("exp",y,x); }
+	void log_bwd(int x, int y)            { proj("log",y,x); }
+	void cos_bwd(int x, int y)            { proj("cos",y,x); }
+	void sin_bwd(int x, int y)            { proj("sin",y,x); }
+	void tan_bwd(int x, int y)            { proj("tan",y,x); }
+	void cosh_bwd(int x, int y)           { proj("cosh",y,x); }
+	void sinh_bwd(int x, int y)           { proj("sinh",y,x); }
+	void tanh_bwd(int x, int y)           { proj("tanh",y,x); }
+	void acos_bwd(int x, int y)           { proj("acos",y,x); }
+	void asin_bwd(int x, int y)           { proj("asin",y,x); }
+	void atan_bwd(int x, int y)           { proj("atan",y,x); }
+	void acosh_bwd(int x, int y)          { proj("acosh",y,x); }
+	void asinh_bwd(int x, int y)          { proj("asinh",y,x); }
+	void atanh_bwd(int x, int y)          { proj("atanh",y,x); }
+
+	void index_bwd(int, int)              { unsupported(); }
+	void vector_bwd(int*, int)            { unsupported(); }
+	void apply_bwd(int*, int)             { unsupported(); }
+	void trans_V_bwd(int, int)            { unsupported(); }
+	void trans_M_bwd(int, int)            { unsupported(); }
+	void add_V_bwd(int, int, int)         { unsupported(); }
+	void add_M_bwd(int, int, int)         { unsupported(); }
+	void mul_SV_bwd(int, int, int)        { unsupported(); }
+	void mul_SM_bwd(int, int, int)        { unsupported(); }
+	void mul_VV_bwd(int, int, int)        { unsupported(); }
+	void mul_MV_bwd(int, int, int)        { unsupported(); }
+	void mul_VM_bwd(int, int, int)        { unsupported(); }
+	void mul_MM_bwd(int, int, int)        { unsupported(); }
+	void sub_V_bwd(int, int, int)         { unsupported(); }
+	void sub_M_bwd(int, int, int)         { unsupported(); }
+};
+
+/* Backward differentiation (same as Gradient) */
+class GradGen : public CodeGen {
+public:
+	GradGen(const Function& f, ostream& os) : CodeGen(f,os) { }
+
+	/* g[x] += <expr> */
+	void acc(int x, const string& expr) {
+		os << '\t' << g(x) << "+=" << expr << ";\n";
+	}
+
+	void symbol_bwd(int)                  { /* nothing to do */ }
+	void cst_bwd(int)                     { /* nothing to do */ }
+	void chi_bwd(int a, int b, int c, int y) {
+		os << "\tgrad_chi(" << g(y) << ',' << v(a) << ',' << v(b) << ',' << v(c) << ',' << g(a) << ',' << g(b) << ',' << g(c) << ");\n";
+	}
+	void add_bwd(int x1, int x2, int y)   { acc(x1,g(y)); acc(x2,g(y)); }
+	void mul_bwd(int x1, int x2, int y)   { acc(x1,g(y)+"*"+v(x2)); acc(x2,g(y)+"*"+v(x1)); }
+	void sub_bwd(int x1, int x2, int y)   { acc(x1,g(y)); acc(x2,"-"+g(y)); }
+	void div_bwd(int x1, int x2, int y)   { acc(x1,g(y)+"/"+v(x2)); acc(x2,g(y)+"*(-"+v(x1)+")/sqr("+v(x2)+")"); }
+	void max_bwd(int x1, int x2, int y)   { os << "\tgrad_max(" << g(y) << ',' << v(x1) << ',' << v(x2) << ',' << g(x1) << ',' << g(x2) << ");\n"; }
+	void min_bwd(int x1, int x2, int y)   { os << "\tgrad_max(" << g(y) << ',' << v(x1) << ',' << v(x2) << ',' << g(x2) << ',' << g(x1) << ");\n"; }
+	void atan2_bwd(int x1, int x2, int y) {
+		string den="(sqr("+v(x2)+")+sqr("+v(x1)+"))";
+		acc(x1,g(y)+"*"+v(x2)+"/"+den);
+		acc(x2,g(y)+"*-"+v(x1)+"/"+den);
+	}
+	void minus_bwd(int x, int y)          { acc(x,"-1.0*"+g(y)); }
+	void sign_bwd(int x, int y)           { os << "\tgrad_sign(" << g(y) << ',' << v(x) << ',' << g(x) << ");\n"; }
+	void abs_bwd(int x, int y)            { os << "\tgrad_abs(" << g(y) << ',' << v(x) << ',' << g(x) << ");\n"; }
+	void power_bwd(int x, int y, int p)   { ostringstream s; s << g(y) << '*' << p << "*pow(" << v(x) << ',' << p-1 << ')'; acc(x,s.str()); }
+	void sqr_bwd(int x, int y)            { acc(x,g(y)+"*2.0*"+v(x)); }
+	void sqrt_bwd(int x, int y)           { acc(x,g(y)+"*0.5/sqrt("+v(x)+")"); }
+	void exp_bwd(int x, int y)            { acc(x,g(y)+"*exp("+v(x)+")"); }
+	void log_bwd(int x, int y)            { acc(x,g(y)+"/"+v(x)); }
+	void cos_bwd(int x, int y)            { acc(x,g(y)+"*-sin("+v(x)+")"); }
+	void sin_bwd(int x, int y)            { acc(x,g(y)+"*cos("+v(x)+")"); }
+	void tan_bwd(int x, int y)            { acc(x,g(y)+"*(1.0+sqr(tan("+v(x)+")))"); }
+	void cosh_bwd(int x, int y)           { acc(x,g(y)+"*sinh("+v(x)+")"); }
+	void sinh_bwd(int x, int y)           { acc(x,g(y)+"*cosh("+v(x)+")"); }
+	void tanh_bwd(int x, int y)           { acc(x,g(y)+"*(1.0-sqr(tanh("+v(x)+")))"); }
+	void acos_bwd(int x, int y)           { acc(x,g(y)+"*-1.0/sqrt(1.0-sqr("+v(x)+"))"); }
+	void asin_bwd(int x, int y)           { acc(x,g(y)+"*1.0/sqrt(1.0-sqr("+v(x)+"))"); }
+	void atan_bwd(int x, int y)           { acc(x,g(y)+"*1.0/(1.0+sqr("+v(x)+"))"); }
+	void acosh_bwd(int x, int y)          { acc(x,g(y)+"*1.0/sqrt(sqr("+v(x)+")-1.0)"); }
+	void asinh_bwd(int x, int y)          { acc(x,g(y)+"*1.0/sqrt(1.0+sqr("+v(x)+"))"); }
+	void atanh_bwd(int x, int y)          { acc(x,g(y)+"*1.0/(1.0-sqr("+v(x)+"))"); }
+
+	void index_bwd(int, int)              { unsupported(); }
+	void vector_bwd(int*, int)            { unsupported(); }
+	void apply_bwd(int*, int)             { unsupported(); }
+	void trans_V_bwd(int, int)            { unsupported(); }
+	void trans_M_bwd(int, int)            { unsupported(); }
+	void add_V_bwd(int, int, int)         { unsupported(); }
+	void add_M_bwd(int, int, int)         { unsupported(); }
+	void mul_SV_bwd(int, int, int)        { unsupported(); }
+	void mul_SM_bwd(int, int, int)        { unsupported(); }
+	void mul_VV_bwd(int, int, int)        { unsupported(); }
+	void mul_MV_bwd(int, int, int)        { unsupported(); }
+	void mul_VM_bwd(int, int, int)        { unsupported(); }
+	void mul_MM_bwd(int, int, int)        { unsupported(); }
+	void sub_V_bwd(int, int, int)         { unsupported(); }
+	void sub_M_bwd(int, int, int)         { unsupported(); }
+};
+
+/* FNV-1a hash */
+uint64_t fnv_hash(const string& s) {
+	uint64_t h=14695981039346656037ULL;
+	for (size_t i=0; i<s.size(); i++) {
+		h^=(unsigned char) s[i];
+		h*=1099511628211ULL;
+	}
+	return h;
+}
+
+#ifndef _WIN32
+
+/*
+ * Default cache directory: $XDG_CACHE_HOME/ibex-native or $HOME/.cache/ibex-native
+ * (or a directory of the user in TMPDIR, if HOME is not set).
+ */
+string default_cache() {
+	const char* xdg=getenv("XDG_CACHE_HOME");
+	if (xdg && *xdg) {
+		mkdir(xdg,0700); // may already exist
+		return string(xdg)+"/ibex-native";
+	}
+
+	const char* home=getenv("HOME");
+	if (home && *home) {
+		string cache=string(home)+"/.cache";
+		mkdir(cache.c_str(),0700); // may already exist
+		return cache+"/ibex-native";
+	}
+
+	const char* tmp=getenv("TMPDIR");
+	ostringstream dir;
+	dir << (tmp? tmp : "/tmp") << "/ibex-native-" << getuid();
+	return dir.str();
+}
+
+/*
+ * Return true if dir is a real directory (not a symbolic link) owned by the
+ * user and not writable by the others. If strict is true, the directory must
+ * not be accessible at all by the others (mode 0700).
+ */
+bool private_dir(const string& dir, bool strict) {
+	struct stat st;
+	if (lstat(dir.c_str(),&st)!=0) return false;
+	if (!S_ISDIR(st.st_mode) || st.st_uid!=getuid()) return false;
+	return (st.st_mode & (strict? S_IRWXG | S_IRWXO : S_IWGRP | S_IWOTH))==0;
+}
+
+/*
+ * What the generated code depends on, apart from its text: the version of
+ * ibex and the interval arithmetic (layout of Interval).
+ */
+string build_key() {
+	ostringstream key;
+	key << _IBEX_RELEASE_ << ' ';
+#if defined(_IBEX_WITH_GAOL_)
+	key << "gaol";
+#elif defined(_IBEX_WITH_BIAS_)
+	key << "bias";
+#elif defined(_IBEX_WITH_FILIB_)
+	key << "filib";
+#elif defined(_IBEX_WITH_DIRECT_)
+	key << "direct";
+#elif defined(_IBEX_WITH_INLINE_)
+	key << "inline";
+#endif
+	key << ' ' << sizeof(Interval) << ' ' << sizeof(IntervalVector);
+	return key.str();
+}
+
+#endif
+
+} // end anonymous namespace
+
+bool NativeFunction::is_supported(const Function& f) {
+	if (!f.expr().dim.is_scalar() || !f.all_args_scalar()) return false;
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprNode& e=f.node(i);
+		if (!e.dim.is_scalar()
+				|| dynamic_cast<const ExprApply*>(&e)
+				|| dynamic_cast<const ExprVector*>(&e)
+				|| dynamic_cast<const ExprIndex*>(&e))
+			return false;
+	}
+	return true;
+}
+
+string NativeFunction::code(const Function& f) {
+	assert(is_supported(f));
+
+	ostringstream os;
+	os << prologue;
+
+	// symbols that appear in the expression (only their domain is updated by the projection)
+	ostringstream write_x, write_g;
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&f.node(i));
+		if (s) {
+			write_x << "\tx[" << s->key << "]=v[" << i << "];\n";
+			write_g << "\tgx[" << s->key << "]=g[" << i << "];\n";
+		}
+	}
+
+	os << "extern \"C\" int ibex_native_eval(const Interval* x, Interval* v) {\n";
+	FwdGen fwd(f,os);
+	f.forward<FwdGen>(fwd);
+	os << "\treturn !v[0].is_empty();\n";
+	os << "}\n\n";
+
+	os << "extern \"C\" int ibex_native_proj(const Interval& y, Interval* x, Interval* v) {\n";
+	os << "\tif (!ibex_native_eval(x,v)) return 0;\n";
+	os << "\tif (v[0].is_subset(y)) return 2;\n";
+	os << "\tif ((v[0]&=y).is_empty()) return 0;\n";
+	ProjGen proj(f,os);
+	f.backward<ProjGen>(proj);
+	os << write_x.str();
+	os << "\treturn 1;\n";
+	os << "}\n\n";
+
+	os << "extern \"C\" int ibex_native_grad(const Interval* x, Interval* v, Interval* g, Interval* gx) {\n";
+	os << "\tif (!ibex_native_eval(x,v)) return 0;\n";
+	os << "\tfor (int i=0; i<" << f.nb_nodes() << "; i++) g[i]=Interval::ZERO;\n";
+	os << "\tg[0]=Interval::ONE;\n";
+	GradGen grad(f,os);
+	f.backward<GradGen>(grad);
+	os << write_g.str();
+	os << "\treturn 1;\n";
+	os << "}\n\n";
+
+	os << "} // end namespace ibex\n";
+
+	return os.str();
+}
+
+#ifdef _WIN32
+
+NativeFunction::NativeFunction(const Function& f, const char*, const char*) : n(f.nb_var()), v(NULL), g(NULL), handle(NULL) {
+	throw NativeFunctionException("native code is not supported on this platform");
+}
+
+NativeFunction::~NativeFunction() { }
+
+#else
+
+NativeFunction::NativeFunction(const Function& f, const char* cache, const char* compiler) :
+		n(f.nb_var()), v(NULL), g(NULL), handle(NULL), _eval(NULL), _proj(NULL), _grad(NULL) {
+
+	if (!is_supported(f))
+		throw NativeFunctionException("only real-valued functions of real variables are supported");
+
+	string src=code(f);
+
+	if (!compiler) compiler=getenv("IBEX_NATIVE_CXX");
+	if (!compiler) compiler=default_compiler;
+
+	string dir;
+	if (cache) dir=cache;
+	else if (getenv("IBEX_NATIVE_CACHE")) dir=getenv("IBEX_NATIVE_CACHE");
+	else dir=default_cache();
+
+	// the shared objects of the cache are loaded (i.e., executed): the
+	// directory must not be writable by another user.
+	mkdir(dir.c_str(),0700); // may already exist
+	if (!private_dir(dir, !cache && !getenv("IBEX_NATIVE_CACHE")))
+		throw NativeFunctionException("the cache directory "+dir+" is not a private directory");
+
+	// the name of the shared object is a hash of the code, the compiler
+	// and the build of ibex (the code is compiled against its headers).
+	ostringstream key;
+	key << src << '\n' << compiler << '\n' << build_key();
+
+	ostringstream name;
+	name << dir << "/ibex_native_" << hex << setw(16) << setfill('0') << fnv_hash(key.str());
+	_path=name.str()+".so";
+
+	if (access(_path.c_str(),R_OK)!=0) {
+		// the source, the log and the shared object of this compilation
+		// have a unique name (reserved with mkstemp), so that several threads
+		// or processes can compile the same function at the same time.
+		// The shared object is renamed at the end, so that another
+		// process never loads a partial file.
+		string tmp=name.str()+".XXXXXX";
+		vector<char> buf(tmp.begin(),tmp.end());
+		buf.push_back('\0');
+		int fd=mkstemp(&buf[0]);
+		if (fd==-1) throw NativeFunctionException("cannot create a file in "+dir);
+		close(fd);
+		tmp=&buf[0];
+
+		string cpp=tmp+".cpp";
+		string log=tmp+".log";
+		string so=tmp+".so";
+
+		ofstream os(cpp.c_str());
+		os << src;
+		os.close();
+		if (!os) {
+			remove(cpp.c_str());
+			remove(tmp.c_str());
+			throw NativeFunctionException("cannot write "+cpp);
+		}
+
+		string cmd="("+string(compiler)+" -o '"+so+"' '"+cpp+"') > '"+log+"' 2>&1";
+
+		if (system(cmd.c_str())!=0) {
+			remove(so.c_str());
+			remove(tmp.c_str());
+			throw NativeFunctionException("compilation failed (see "+log+" and "+cpp+")");
+		}
+
+		// if the rename fails, the shared object may
+		// have been installed by another compilation
+		if (rename(so.c_str(),_path.c_str())!=0) {
+			remove(so.c_str());
+			if (access(_path.c_str(),R_OK)!=0) {
+				remove(tmp.c_str());
+				throw NativeFunctionException("cannot write "+_path);
+			}
+		}
+
+		remove(cpp.c_str());
+		remove(log.c_str());
+		remove(tmp.c_str());
+	}
+
+	handle=dlopen(_path.c_str(),RTLD_NOW | RTLD_LOCAL);
+	if (!handle) throw NativeFunctionException(dlerror());
+
+	// note: a data pointer cannot be directly converted to a function pointer in C++98
+	*(void**) &_eval=dlsym(handle,"ibex_native_eval");
+	*(void**) &_proj=dlsym(handle,"ibex_native_proj");
+	*(void**) &_grad=dlsym(handle,"ibex_native_grad");
+
+	if (!_eval || !_proj || !_grad) {
+		dlclose(handle);
+		throw NativeFunctionException(_path+" is not a valid shared object");
+	}
+
+	v=new Interval[f.nb_nodes()];
+	g=new Interval[f.nb_nodes()];
+}
+
+NativeFunction::~NativeFunction() {
+	if (handle) dlclose(handle);
+	delete[] v;
+	delete[] g;
+}
+
+#endif
+
+Interval NativeFunction::eval(const IntervalVector& box) const {
+	assert(box.size()==n);
+	_eval(&box[0],v);
+	return v[0];
+}
+
+bool NativeFunction::backward(const Interval& y, IntervalVector& x) const {
+	assert(x.size()==n);
+	switch (_proj(y,&x[0],v)) {
+	case 0:  x.set_empty(); return false;
+	case 2:  return true;
+	default: return false;
+	}
+}
+
+void NativeFunction::gradient(const IntervalVector& x, IntervalVector& gx) const {
+	assert(x.size()==n && gx.size()==n);
+	gx.clear();
+	// outside definition domain -> empty gradient
+	if (!_grad(&x[0],v,g,&gx[0])) gx.set_empty();
+}
+
+} // end namespace ibex
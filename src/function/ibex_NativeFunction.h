@@ -0,0 +1,160 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NativeFunction.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_NATIVE_FUNCTION_H__
+#define __IBEX_NATIVE_FUNCTION_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Exception.h"
+
+#include <string>
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ * \brief Thrown when native code cannot be generated or loaded.
+ */
+class NativeFunctionException : public Exception {
+public:
+	NativeFunctionException(const std::string& msg) : msg(msg) { }
+
+	/** \brief Reason of the failure. */
+	std::string msg;
+};
+
+/**
+ * \ingroup symbolic
+ * \brief Native code of a function.
+ *
+ * The forward evaluation, the backward projection (HC4Revise) and the gradient of a
+ * function are translated into straight-line C++ code. This code is compiled by the
+ * system compiler into a shared object which is loaded with dlopen. The result is the
+ * same as with the interpreted algorithms (#ibex::Eval, #ibex::HC4Revise,
+ * #ibex::Gradient), without the dispatch over the operations of the expression.
+ *
+ * Shared objects are cached in a directory and their name is a hash of the generated
+ * code (and of the compiler command, the version of IBEX and its interval arithmetic), so
+ * that the compiler is only called the first time a given function is met. Since the
+ * shared objects of the cache are loaded, the directory must be owned by the user and
+ * not be writable by the others.
+ *
+ * The generated code calls the functions of IBEX (interval arithmetic): these symbols are
+ * resolved in the running program, which must either be linked with the shared library of
+ * IBEX, or export its symbols (e.g., with -rdynamic) if IBEX is linked statically.
+ *
+ * Only real-valued functions with real arguments are supported, and without
+ * function calls (#ibex::ExprApply).
+ *
+ * \note Like #ibex::Function, this class is not thread-safe (temporary domains
+ * are stored in the object).
+ */
+class NativeFunction {
+public:
+	/**
+	 * \brief Generate, compile and load the native code of \a f.
+	 *
+	 * \param f        - the function.
+	 * \param cache    - the directory where shared objects are stored. By default (NULL),
+	 *                   the IBEX_NATIVE_CACHE environment variable, or "ibex-native" in the
+	 *                   cache directory of the user (XDG_CACHE_HOME, or HOME/.cache).
+	 * \param compiler - the command that compiles a C++ file into a shared object (the
+	 *                   options "-o <output> <source>" are appended). By default (NULL),
+	 *                   the IBEX_NATIVE_CXX environment variable, or #default_compiler.
+	 *
+	 * \throw NativeFunctionException if \a f is not supported, the cache directory is not
+	 * private, or the code cannot be compiled or loaded.
+	 */
+	explicit NativeFunction(const Function& f, const char* cache=NULL, const char* compiler=NULL);
+
+	/**
+	 * \brief Unload the code.
+	 */
+	~NativeFunction();
+
+	/**
+	 * \brief True if native code can be generated for \a f.
+	 */
+	static bool is_supported(const Function& f);
+
+	/**
+	 * \brief The generated C++ code of \a f.
+	 */
+	static std::string code(const Function& f);
+
+	/**
+	 * \brief Evaluate the function on \a box.
+	 *
+	 * Same as #ibex::Function::eval(const IntervalVector&) const.
+	 */
+	Interval eval(const IntervalVector& box) const;
+
+	/**
+	 * \brief Contract \a x w.r.t. f(x)=y.
+	 *
+	 * Same as #ibex::Function::backward(const Interval&, IntervalVector&) const:
+	 * return true if the image of \a x is included in \a y (\a x is not contracted),
+	 * and set \a x to the empty box if there is no solution.
+	 */
+	bool backward(const Interval& y, IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the gradient of the function on \a x.
+	 *
+	 * Same as #ibex::Function::gradient(const IntervalVector&, IntervalVector&) const.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g) const;
+
+	/**
+	 * \brief Path of the loaded shared object.
+	 */
+	const std::string& path() const;
+
+	/**
+	 * \brief The default compilation command.
+	 */
+	static const char* default_compiler;
+
+private:
+	NativeFunction(const NativeFunction&);            // forbidden
+	NativeFunction& operator=(const NativeFunction&); // forbidden
+
+	typedef int (*eval_func)(const Interval* x, Interval* v);
+	typedef int (*proj_func)(const Interval& y, Interval* x, Interval* v);
+	typedef int (*grad_func)(const Interval* x, Interval* v, Interval* g, Interval* gx);
+
+	/* number of variables */
+	int n;
+
+	/* domains and derivatives of the nodes */
+	Interval* v;
+	Interval* g;
+
+	std::string _path;
+
+	/* handle of the shared object */
+	void* handle;
+
+	eval_func _eval;
+	proj_func _proj;
+	grad_func _grad;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline const std::string& NativeFunction::path() const {
+	return _path;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_NATIVE_FUNCTION_H__
@@ -0,0 +1,63 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SparseJacobian.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_SparseJacobian.h"
+
+namespace ibex {
+
+SparseJacobian::SparseJacobian(const Function& f) : f(f), m(f.image_dim()), n(f.nb_var()), empty(false) {
+	start=new int[m+1];
+	start[0]=0;
+	for (int i=0; i<m; i++)
+		start[i+1]=start[i]+f[i].nb_used_vars();
+
+	_col=new int[start[m]];
+	val=new Interval[start[m]];
+
+	for (int i=0; i<m; i++) {
+		const Function& fi=f[i];
+		for (int k=0; k<fi.nb_used_vars(); k++) {
+			_col[start[i]+k]=fi.used_var(k);
+			val[start[i]+k]=Interval::ZERO;
+		}
+	}
+}
+
+SparseJacobian::~SparseJacobian() {
+	delete[] start;
+	delete[] _col;
+	delete[] val;
+}
+
+void SparseJacobian::get_row(int i, IntervalVector& row) const {
+	assert(row.size()==n);
+
+	if (empty) { row.set_empty(); return; }
+
+	row.clear();
+	for (int k=start[i]; k<start[i+1]; k++)
+		row[_col[k]]=val[k];
+}
+
+void SparseJacobian::to_dense(IntervalMatrix& J) const {
+	assert(J.nb_rows()==m && J.nb_cols()==n);
+
+	if (empty) { J.set_empty(); return; }
+
+	for (int i=0; i<m; i++)
+		get_row(i,J[i]);
+}
+
+void SparseJacobian::set_empty() {
+	empty=true;
+}
+
+} // namespace ibex
@@ -0,0 +1,196 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SparseJacobian.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SPARSE_JACOBIAN_H__
+#define __IBEX_SPARSE_JACOBIAN_H__
+
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ * \brief Sparse Jacobian matrix of a function.
+ *
+ * The matrix is stored row by row (compressed row storage). The nonzero
+ * entries of the ith row are the derivatives of the ith component of f
+ * w.r.t. the variables this component uses (see #ibex::Function::used_var(int) const),
+ * in increasing order. The sparsity pattern is therefore fixed
+ * once for all when the matrix is built.
+ *
+ * The matrix is filled by #ibex::Function::jacobian(const IntervalVector&, SparseJacobian&) const
+ * or #ibex::Function::hansen_matrix(const IntervalVector&, SparseJacobian&) const.
+ */
+class SparseJacobian {
+public:
+	/**
+	 * \brief Build the (zero) Jacobian matrix of f.
+	 */
+	explicit SparseJacobian(const Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~SparseJacobian();
+
+	/**
+	 * \brief Number of rows (the image dimension of f).
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns (the number of variables of f).
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Total number of nonzero entries.
+	 */
+	int nb_nonzeros() const;
+
+	/**
+	 * \brief Number of nonzero entries in the ith row.
+	 */
+	int row_size(int i) const;
+
+	/**
+	 * \brief Column of the kth nonzero entry of the ith row.
+	 */
+	int col(int i, int k) const;
+
+	/**
+	 * \brief The kth nonzero entry of the ith row.
+	 */
+	Interval& operator()(int i, int k);
+
+	/**
+	 * \brief The kth nonzero entry of the ith row (const version).
+	 */
+	const Interval& operator()(int i, int k) const;
+
+	/**
+	 * \brief The nonzero entries of the ith row.
+	 */
+	Interval* row(int i);
+
+	/**
+	 * \brief Set \a row to the ith row of this matrix (zeros included).
+	 *
+	 * \pre row.size()==nb_cols().
+	 */
+	void get_row(int i, IntervalVector& row) const;
+
+	/**
+	 * \brief Set J to the dense matrix.
+	 *
+	 * \pre J is nb_rows() x nb_cols().
+	 */
+	void to_dense(IntervalMatrix& J) const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix dense() const;
+
+	/**
+	 * \brief True if the matrix is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Set the matrix to the empty matrix.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+protected:
+	friend class Function;
+
+	/* number of rows and columns */
+	int m, n;
+
+	/* start[i] is the index of the first entry of
+	 * the ith row in "_col"/"val"; start[m]=nb_nonzeros(). */
+	int* start;
+
+	/* columns of the nonzero entries */
+	int* _col;
+
+	/* values of the nonzero entries */
+	Interval* val;
+
+	/* whether the matrix is empty */
+	bool empty;
+
+private:
+	SparseJacobian(const SparseJacobian&);            // forbidden
+	SparseJacobian& operator=(const SparseJacobian&); // forbidden
+};
+
+/* ============================================================================
+ 	 	 	 	 	 	 	 inline implementation
+  ============================================================================*/
+
+inline int SparseJacobian::nb_rows() const {
+	return m;
+}
+
+inline int SparseJacobian::nb_cols() const {
+	return n;
+}
+
+inline int SparseJacobian::nb_nonzeros() const {
+	return start[m];
+}
+
+inline int SparseJacobian::row_size(int i) const {
+	assert(i>=0 && i<m);
+	return start[i+1]-start[i];
+}
+
+inline int SparseJacobian::col(int i, int k) const {
+	assert(k>=0 && k<row_size(i));
+	return _col[start[i]+k];
+}
+
+inline Interval& SparseJacobian::operator()(int i, int k) {
+	assert(k>=0 && k<row_size(i));
+	return val[start[i]+k];
+}
+
+inline const Interval& SparseJacobian::operator()(int i, int k) const {
+	assert(k>=0 && k<row_size(i));
+	return val[start[i]+k];
+}
+
+inline Interval* SparseJacobian::row(int i) {
+	assert(i>=0 && i<m);
+	return &val[start[i]];
+}
+
+inline bool SparseJacobian::is_empty() const {
+	return empty;
+}
+
+inline IntervalMatrix SparseJacobian::dense() const {
+	IntervalMatrix J(m,n);
+	to_dense(J);
+	return J;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SPARSE_JACOBIAN_H__
@@ -49,14 +49,19 @@ bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, dou
 
 	IntervalVector& box = vars ? *new IntervalVector(vars->var_box(full_box)) : full_box;
 	IntervalVector& full_mid = vars ? *new IntervalVector(full_box) : mid;
+	// the Hansen matrix is calculated in sparse form
+	// (each component only depends on a few variables)
+	SparseJacobian* H = vars ? NULL : new SparseJacobian(f);
 
 	y1 = box.mid();
 
 	do {
 		if (vars)
 			f.hansen_matrix(full_box,J,*vars);
-		else
-			f.hansen_matrix(full_box,J);
+		else {
+			f.hansen_matrix(full_box,*H);
+			H->to_dense(J);
+		}
 		//		f.jacobian(box,J);
 
 		if (J.is_empty()) break;
@@ -115,6 +120,8 @@ bool newton(const Function& f, const VarSet* vars, IntervalVector& full_box, dou
 		delete &box;
 		delete &full_mid;
 	}
+	else
+		delete H;
 
 	return reducted;
 }
@@ -144,6 +151,9 @@ bool inflating_newton(const Function& f, const VarSet* vars, IntervalVector& ful
 
 	IntervalVector& box = vars ? *new IntervalVector(vars->var_box(full_box)) : full_box;
 	IntervalVector& full_mid = vars ? *new IntervalVector(full_box) : mid;
+	// the Hansen matrix is calculated in sparse form
+	// (each component only depends on a few variables)
+	SparseJacobian* H = vars ? NULL : new SparseJacobian(f);
 
 	y1 = box.mid();
 
@@ -151,8 +161,10 @@ bool inflating_newton(const Function& f, const VarSet* vars, IntervalVector& ful
 
 		if (vars)
 			f.hansen_matrix(full_box, J, *vars);
-		else
-			f.hansen_matrix(full_box, J);
+		else {
+			f.hansen_matrix(full_box, *H);
+			H->to_dense(J);
+		}
 
 		if (J.is_empty()) break;
 
@@ -197,6 +209,8 @@ bool inflating_newton(const Function& f, const VarSet* vars, IntervalVector& ful
 		delete &box;
 		delete &full_mid;
 	}
+	else
+		delete H;
 
 	return success;
 }
@@ -17,11 +17,11 @@ namespace {
 
 }
 
-PdcFwdBwd::PdcFwdBwd(Function& f, CmpOp op) : PdcCleared(*new CtcFwdBwd(f,!op)){
+PdcFwdBwd::PdcFwdBwd(Function& f, CmpOp op, Function::eval_mode mode) : PdcCleared(*new CtcFwdBwd(f,!op,mode)){
 
 }
 
-PdcFwdBwd::PdcFwdBwd(const NumConstraint& ctr) : PdcCleared(*new CtcFwdBwd(ctr.f,!ctr.op)) {
+PdcFwdBwd::PdcFwdBwd(const NumConstraint& ctr, Function::eval_mode mode) : PdcCleared(*new CtcFwdBwd(ctr.f,!ctr.op,mode)) {
 
 }
 
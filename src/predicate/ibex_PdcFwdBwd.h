@@ -28,14 +28,15 @@ public:
 	 * \brief Basic inner test wrt f(x)<=0.
 	 *
 	 * Based on HC4Revise.
-	 * \param op - either LT, LEQ, GT or GEQ (<b>not</b> EQ).
+	 * \param op   - either LT, LEQ, GT or GEQ (<b>not</b> EQ).
+	 * \param mode - evaluation mode of f (see #ibex::CtcFwdBwd::mode).
 	 */
-	PdcFwdBwd(Function& f, CmpOp op);
+	PdcFwdBwd(Function& f, CmpOp op, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \remark ctr is not kept by reference.
 	 */
-	PdcFwdBwd(const NumConstraint& ctr);
+	PdcFwdBwd(const NumConstraint& ctr, Function::eval_mode mode=Function::NATURAL);
 
 	/**
 	 * \brief Delete *this.
@@ -9,7 +9,16 @@
 //============================================================================
 
 #include "ibex_Backtrackable.h"
+#include "ibex_CellPool.h"
 
 namespace ibex {
 
+void* Backtrackable::operator new(size_t size) {
+	return CellPool::alloc(size);
+}
+
+void Backtrackable::operator delete(void* p) {
+	CellPool::free(p);
+}
+
 } // end namespace ibex
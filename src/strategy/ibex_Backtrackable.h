@@ -12,6 +12,8 @@
 #define __IBEX_BACKTRACKABLE_H__
 
 #include <utility>
+#include <cstddef>
+#include <iosfwd>
 
 namespace ibex {
 
@@ -49,6 +51,36 @@ public:
 	 * \brief Delete *this.
 	 */
 	virtual ~Backtrackable() { }
+
+	/**
+	 * \brief Write the state of this data (binary format).
+	 *
+	 * Called when a search is saved (see #ibex::Checkpoint) or a cell is written
+	 * into a file (see #ibex::CellHybridBuffer). Data that only depends on the root
+	 * cell can be omitted (by default, nothing is written).
+	 */
+	virtual void save(std::ostream& os) const { }
+
+	/**
+	 * \brief Read the state written by #save(std::ostream&) const.
+	 *
+	 * Called on data inherited from a root cell (see #ibex::Cell::load()),
+	 * i.e., data that is in the same state as after a call to #down().
+	 */
+	virtual void load(std::istream& is) { }
+
+	/**
+	 * \brief Allocate data.
+	 *
+	 * Data created by #ibex::Cell::add() or by #down() belong
+	 * to the pool of the cell, if any (see #ibex::CellPool).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Free the memory of data (system allocator or pool).
+	 */
+	static void operator delete(void* p);
 };
 
 } // end namespace ibex
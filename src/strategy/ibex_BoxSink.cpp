@@ -0,0 +1,116 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BoxSink.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include <cstring>
+
+#include "ibex_BoxSink.h"
+#include "ibex_UnknownFileException.h"
+
+using namespace std;
+
+namespace ibex {
+
+BoxSink::~BoxSink() {
+
+}
+
+void BoxSink::add(const IntervalVector& before, const IntervalVector& after) {
+	IntervalVector* boxes;
+	int n=before.diff(after,boxes);
+	for (int i=0; i<n; i++)
+		add(boxes[i]);
+	delete[] boxes;
+}
+
+CountSink::CountSink() : nb_boxes(0) {
+
+}
+
+void CountSink::add(const IntervalVector&) {
+	nb_boxes++;
+}
+
+VectorSink::VectorSink(vector<IntervalVector>& boxes) : boxes(boxes) {
+
+}
+
+void VectorSink::add(const IntervalVector& box) {
+	boxes.push_back(box);
+}
+
+RingSink::RingSink(int capacity) : capacity(capacity), nb_boxes(0), first(0) {
+	assert(capacity>0);
+	boxes.reserve(capacity);
+}
+
+void RingSink::add(const IntervalVector& box) {
+	if (size()<capacity)
+		boxes.push_back(box);
+	else {
+		boxes[first]=box; // note: the box is resized if necessary
+		first=(first+1)%capacity;
+	}
+	nb_boxes++;
+}
+
+FileSink::FileSink(const char* filename) {
+	os.open(filename, ios::out | ios::binary | ios::trunc);
+	if (!os.is_open()) throw UnknownFileException(filename);
+}
+
+FileSink::~FileSink() {
+	os.close();
+}
+
+void FileSink::add(const IntervalVector& box) {
+	// note: the size of an empty box is written with a negative sign
+	int n=box.is_empty()? -box.size() : box.size();
+	os.write((char*) &n, sizeof(int));
+	if (n<0) return;
+	for (int i=0; i<n; i++) {
+		double lb=box[i].lb();
+		double ub=box[i].ub();
+		os.write((char*) &lb, sizeof(double));
+		os.write((char*) &ub, sizeof(double));
+	}
+}
+
+void FileSink::flush() {
+	os.flush();
+}
+
+unsigned long FileSink::read(const char* filename, BoxSink& sink) {
+	ifstream is;
+	is.open(filename, ios::in | ios::binary);
+	if (!is.is_open()) throw UnknownFileException(filename);
+
+	unsigned long nb=0;
+	int n;
+	while (is.read((char*) &n, sizeof(int))) {
+		if (n==0) break; // not a valid file
+		if (n<0) {
+			sink.add(IntervalVector::empty(-n));
+		} else {
+			IntervalVector box(n);
+			for (int i=0; i<n; i++) {
+				double lb,ub;
+				is.read((char*) &lb, sizeof(double));
+				is.read((char*) &ub, sizeof(double));
+				box[i]=Interval(lb,ub);
+			}
+			if (!is) break; // truncated file
+			sink.add(box);
+		}
+		nb++;
+	}
+	return nb;
+}
+
+} // end namespace ibex
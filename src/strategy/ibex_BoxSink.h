@@ -0,0 +1,208 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BoxSink.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BOX_SINK_H__
+#define __IBEX_BOX_SINK_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+#include <fstream>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Receiver of the boxes produced by a strategy.
+ *
+ * A sink receives each box as soon as it is produced: the solutions of
+ * a #ibex::Solver or the boxes removed by the contractors of a #ibex::Paver.
+ * The strategy does not keep the boxes, so the memory used only depends
+ * on the sink.
+ */
+class BoxSink {
+public:
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~BoxSink();
+
+	/**
+	 * \brief Receive a box.
+	 */
+	virtual void add(const IntervalVector& box)=0;
+
+	/**
+	 * \brief Receive the trace of a contraction.
+	 *
+	 * The box \a before has been contracted to \a after.
+	 * By default, the boxes of \a before \\ \a after are added one by one (see
+	 * #ibex::IntervalVector::diff(const IntervalVector&, IntervalVector*&) const).
+	 */
+	virtual void add(const IntervalVector& before, const IntervalVector& after);
+};
+
+/** \ingroup strategy
+ *
+ * \brief Sink that only counts the boxes.
+ */
+class CountSink : public BoxSink {
+public:
+	/**
+	 * \brief Create a counter (set to 0).
+	 */
+	CountSink();
+
+	/**
+	 * \brief Count the box.
+	 */
+	void add(const IntervalVector& box);
+
+	using BoxSink::add;
+
+	/**
+	 * \brief Number of boxes received.
+	 */
+	unsigned long nb_boxes;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Sink that stores the boxes into a vector.
+ */
+class VectorSink : public BoxSink {
+public:
+	/**
+	 * \brief Store the boxes into \a boxes (passed by reference).
+	 */
+	VectorSink(std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Push the box back into the vector.
+	 */
+	void add(const IntervalVector& box);
+
+	using BoxSink::add;
+
+	/**
+	 * \brief The vector.
+	 */
+	std::vector<IntervalVector>& boxes;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Sink that keeps the last boxes (bounded ring buffer).
+ *
+ * Once the buffer is full, each new box replaces the oldest one.
+ */
+class RingSink : public BoxSink {
+public:
+	/**
+	 * \brief Create a buffer that keeps at most \a capacity boxes.
+	 */
+	explicit RingSink(int capacity);
+
+	/**
+	 * \brief Keep the box (the oldest box is removed if the buffer is full).
+	 */
+	void add(const IntervalVector& box);
+
+	using BoxSink::add;
+
+	/**
+	 * \brief Number of boxes kept (the capacity, once the buffer is full).
+	 */
+	int size() const;
+
+	/**
+	 * \brief The ith box kept.
+	 *
+	 * The boxes are sorted from the oldest (i=0) to the latest (i=size()-1).
+	 */
+	const IntervalVector& operator[](int i) const;
+
+	/**
+	 * \brief Maximal number of boxes kept.
+	 */
+	const int capacity;
+
+	/**
+	 * \brief Number of boxes received (including the ones that have been removed).
+	 */
+	unsigned long nb_boxes;
+
+private:
+	std::vector<IntervalVector> boxes;
+
+	/* index of the oldest box */
+	int first;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Sink that writes the boxes into a binary file.
+ *
+ * Each box is written with its size followed by its bounds (the native
+ * representation of numbers is used). The file can be read back by #read().
+ */
+class FileSink : public BoxSink {
+public:
+	/**
+	 * \brief Create the file (overwritten if it already exists).
+	 *
+	 * \throw UnknownFileException if the file cannot be created.
+	 */
+	explicit FileSink(const char* filename);
+
+	/**
+	 * \brief Close the file.
+	 */
+	~FileSink();
+
+	/**
+	 * \brief Write the box.
+	 */
+	void add(const IntervalVector& box);
+
+	using BoxSink::add;
+
+	/**
+	 * \brief Write the buffered boxes into the file.
+	 */
+	void flush();
+
+	/**
+	 * \brief Read a file written by a FileSink.
+	 *
+	 * The boxes are given one by one to \a sink.
+	 * \return the number of boxes read.
+	 * \throw UnknownFileException if the file cannot be opened.
+	 */
+	static unsigned long read(const char* filename, BoxSink& sink);
+
+private:
+	std::ofstream os;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int RingSink::size() const {
+	return boxes.size();
+}
+
+inline const IntervalVector& RingSink::operator[](int i) const {
+	assert(i>=0 && i<size());
+	return boxes[(first+i)%size()];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_BOX_SINK_H__
@@ -9,33 +9,171 @@
 //============================================================================
 
 #include "ibex_Cell.h"
+#include "ibex_SymbolMap.h"
+#include "ibex_Thread.h"
 #include <limits.h>
+#include <iostream>
+
+using namespace std;
 
 namespace ibex {
 
 namespace {
 
-int id_count=0;
+// atomically incremented (cells may be created by parallel strategies)
+volatile unsigned long id_count=0;
+
+// slots of the classes of backtrackable data
+SymbolMap<int>& slots() {
+	static SymbolMap<int> _slots;
+	return _slots;
+}
+
+// class names of the slots
+vector<const char*>& slot_names() {
+	static vector<const char*> _names;
+	return _names;
+}
+
+Mutex& slots_mutex() {
+	static Mutex m;
+	return m;
 }
 
- Cell::Cell(const IntervalVector& box) : box(box), id(id_count++) {
+}
+
+int Cell::new_slot(const char* classname) {
+	// note: a class may be given a slot several times if
+	// it is used in different libraries (hence the map).
+	Lock l(slots_mutex());
+	if (!slots().used(classname))
+		slot_names().push_back(slots().insert_new(classname,slots().size()));
+	return slots()[classname];
+}
+
+const char* Cell::slot_name(int s) {
+	Lock l(slots_mutex());
+	assert(s>=0 && s<(int) slot_names().size());
+	return slot_names()[s];
+}
+
+int Cell::slot(const char* classname) {
+	Lock l(slots_mutex());
+	return slots().used(classname) ? slots()[classname] : -1;
+}
+
+void Cell::resize_data(int n) {
+	assert(n>nb_data);
+	Backtrackable** new_data=(Backtrackable**) CellPool::alloc(arena,n*sizeof(Backtrackable*));
+	int i=0;
+	for (; i<nb_data; i++) new_data[i]=data[i];
+	for (; i<n; i++) new_data[i]=NULL;
+	CellPool::free(data);
+	data=new_data;
+	nb_data=n;
+}
+
+ Cell::Cell(const IntervalVector& box) : box(box), data(NULL), nb_data(0), id(atomic_add(id_count,1UL)-1), arena(NULL) {
 	 assert(id_count<ULONG_MAX);
 }
 
+Cell::Cell(const IntervalVector& box, CellPool::Arena* arena) : data(NULL), nb_data(0), id(atomic_add(id_count,1UL)-1), arena(arena) {
+	assert(id_count<ULONG_MAX);
+	int n=box.size();
+	if (n<=IntervalVector::SMALL_SIZE)
+		this->box=box; // stored inline: the arena is useless
+	else {
+		this->box.vec=CellPool::alloc_box(arena,n);
+		this->box.n=n;
+		this->box.own=false;
+		for (int i=0; i<n; i++) this->box.vec[i]=box[i];
+	}
+}
+
+void* Cell::operator new(size_t size) {
+	return CellPool::alloc(NULL,size);
+}
+
+void* Cell::operator new(size_t size, CellPool::Arena* arena) {
+	return CellPool::alloc(arena,size);
+}
+
+void Cell::operator delete(void* p) {
+	CellPool::free(p);
+}
+
+void Cell::operator delete(void* p, CellPool::Arena*) {
+	CellPool::free(p);
+}
+
 std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVector& right) {
-	Cell* cleft = new Cell(left);
-	Cell* cright = new Cell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
+	Cell* cleft = arena? CellPool::new_cell(arena,left) : new Cell(left);
+	Cell* cright = arena? CellPool::new_cell(arena,right) : new Cell(right);
+	if (nb_data>0) {
+		cleft->resize_data(nb_data);
+		cright->resize_data(nb_data);
+	}
+	// the data of the subcells are created in the same arena
+	CellPool::Scope scope(arena);
+	for (int i=0; i<nb_data; i++) {
+		if (!data[i]) continue;
+		std::pair<Backtrackable*,Backtrackable*> child_data=data[i]->down();
+		cleft->data[i]=child_data.first;
+		cright->data[i]=child_data.second;
 	}
 	return std::pair<Cell*,Cell*>(cleft,cright);
 }
 
+void Cell::save(ostream& os) const {
+	for (int i=0; i<box.size(); i++) {
+		double lb=box[i].lb();
+		double ub=box[i].ub();
+		os.write((char*) &lb, sizeof(double));
+		os.write((char*) &ub, sizeof(double));
+	}
+	for (int i=0; i<nb_data; i++)
+		if (data[i]) data[i]->save(os);
+}
+
+Cell* Cell::load(istream& is, const vector<int>& slots) {
+	int n=box.size();
+	IntervalVector b(n);
+	for (int i=0; i<n; i++) {
+		double lb,ub;
+		is.read((char*) &lb, sizeof(double));
+		is.read((char*) &ub, sizeof(double));
+		b[i]=Interval(lb,ub);
+	}
+
+	Cell* c = arena? CellPool::new_cell(arena,b) : new Cell(b);
+	if (nb_data>0) c->resize_data(nb_data);
+
+	CellPool::Scope scope(arena);
+	for (int i=0; i<nb_data; i++) {
+		if (!data[i]) continue;
+		std::pair<Backtrackable*,Backtrackable*> child_data=data[i]->down();
+		c->data[i]=child_data.first;
+		delete child_data.second;
+	}
+
+	for (vector<int>::const_iterator it=slots.begin(); it!=slots.end(); it++) {
+		assert(*it>=0 && *it<nb_data && c->data[*it]!=NULL);
+		c->data[*it]->load(is);
+	}
+	return c;
+}
+
 Cell::~Cell() {
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++)
-		delete it->second;
+	for (int i=0; i<nb_data; i++)
+		delete data[i]; // note: may be NULL
+	CellPool::free(data);
+
+	if (arena && !box.is_small()) {
+		// give the box back to the arena
+		CellPool::free_box(arena,box.vec,box.n);
+		box.vec=NULL;
+		box.n=0;
+	}
 }
 
 
@@ -13,8 +13,10 @@
 
 #include "ibex_IntervalVector.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_SymbolMap.h"
+#include "ibex_CellPool.h"
 #include <typeinfo>
+#include <cassert>
+#include <vector>
 
 namespace ibex {
 
@@ -44,6 +46,8 @@ public:
 	 * \brief Create the root cell.
 	 *
 	 * \param box - Box (passed by copy).
+	 *
+	 * \see #ibex::CellPool::new_cell(const IntervalVector&) for creating a cell in a pool.
 	 */
 	Cell(const IntervalVector& box);
 
@@ -58,6 +62,9 @@ public:
 	 * This function is called by the bisector. Note that the actual
 	 * bisector class can simply bisect a box into two subboxes, the
 	 * cell bisection has a default implementation in #ibex::Bsc.
+	 *
+	 * <p>
+	 * If this cell belongs to a pool, the subcells belong to the same pool.
 	 */
 	std::pair<Cell*,Cell*> bisect(const IntervalVector& left, const IntervalVector& right);
 
@@ -74,45 +81,130 @@ public:
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 * \pre The data has been added to the root cell.
 	 */
 	template<typename T>
 	T& get() {
-		return (T&) *data[typeid(T).name()];
+		int s=slot<T>();
+		assert(s<nb_data && data[s]!=NULL);
+		return (T&) *data[s];
 	}
 
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 * \pre The data has been added to the root cell.
 	 */
 	template<typename T>
 	const T& get() const {
-		return (T&) *data[typeid(T).name()];
+		int s=slot<T>();
+		assert(s<nb_data && data[s]!=NULL);
+		return (const T&) *data[s];
+	}
+
+	/**
+	 * \brief True if this cell contains backtrackable data of class T.
+	 *
+	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 */
+	template<typename T>
+	bool has() const {
+		int s=slot<T>();
+		return s<nb_data && data[s]!=NULL;
 	}
 
 	/**
 	 * \brief Add backtrackable data into this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	void add() {
-		const char* id=typeid(T).name();
-		if (!data.used(id)) data.insert_new(id,new T());
+		int s=slot<T>();
+		if (s>=nb_data) resize_data(s+1);
+		if (!data[s]) {
+			CellPool::Scope scope(arena);
+			data[s]=new T();
+		}
+	}
+
+	/**
+	 * \brief Slot of the backtrackable data of class T.
+	 *
+	 * A different slot is given to each class of backtrackable data,
+	 * the first time it is used. Slots are numbered from 0.
+	 */
+	template<typename T>
+	static int slot() {
+		static const int s=new_slot(typeid(T).name());
+		return s;
 	}
 
+	/**
+	 * \brief Class name of the data of a slot.
+	 *
+	 * \pre The slot has been given (see #slot()).
+	 */
+	static const char* slot_name(int s);
+
+	/**
+	 * \brief Slot of the data of a class, given its name (see #slot_name(int)).
+	 *
+	 * \return -1 if no slot has been given to this class in this process.
+	 */
+	static int slot(const char* classname);
+
+	/**
+	 * \brief Write the box and the data of this cell (binary format).
+	 *
+	 * The data are written in the order of the slots
+	 * (see #ibex::Backtrackable::save(std::ostream&) const).
+	 */
+	void save(std::ostream& os) const;
+
+	/**
+	 * \brief Read a cell written by #save(std::ostream&) const.
+	 *
+	 * The new cell is created as a subcell of this cell (typically, a root cell),
+	 * in the same pool: each data is first inherited from this cell via
+	 * \link #ibex::Backtrackable::down() down \endlink and then read from the stream.
+	 *
+	 * \param slots - slots[i] is the slot (in this process) of the ith data
+	 *                written in the stream.
+	 * \pre This cell has data in all these slots.
+	 */
+	Cell* load(std::istream& is, const std::vector<int>& slots);
+
+	/**
+	 * \brief Allocate a cell (with the system allocator).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Free the memory of a cell (system allocator or pool).
+	 */
+	static void operator delete(void* p);
+
 	/**
 	 * \brief The box
 	 */
 	IntervalVector box;
 	/**
 	 * \brief Other data.
+	 *
+	 * data[i] is the data of the ith slot (NULL if this slot is not used).
+	 */
+	Backtrackable** data;
+
+	/**
+	 * \brief Size of the #data array.
 	 */
-	SymbolMap<Backtrackable*> data;
+	int nb_data;
 
 	/**
 	 * Cell unique identifier
@@ -120,6 +212,30 @@ public:
 	unsigned long id;
 
 private:
+	friend class CellPool;
+
+	Cell(const Cell&);            // forbidden
+	Cell& operator=(const Cell&); // forbidden
+
+	/* Create a cell in an arena (the box is allocated by the arena,
+	 * unless it is small enough to be stored inline) */
+	Cell(const IntervalVector& box, CellPool::Arena* arena);
+
+	/* Allocate a cell in an arena */
+	static void* operator new(size_t size, CellPool::Arena* arena);
+
+	/* Called only if the constructor throws an exception */
+	static void operator delete(void* p, CellPool::Arena* arena);
+
+	/* Give a slot to a new class of data (or return the slot of this class) */
+	static int new_slot(const char* classname);
+
+	/* Increase the size of the data array */
+	void resize_data(int n);
+
+	/* The arena of this cell (NULL if the cell does not belong to a pool) */
+	CellPool::Arena* arena;
+
 	/* A constant to be used when no variable has been split yet (root cell). */
 	//static const int ROOT_CELL;
 };
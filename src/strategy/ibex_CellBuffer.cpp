@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_CellBuffer.h"
+#include "ibex_Checkpoint.h"
 
 using namespace std;
 
@@ -18,6 +19,16 @@ CellBuffer::CellBuffer() : capacity(-1), screen(1) { }
 
 CellBuffer::~CellBuffer() { }
 
+CellVisitor::~CellVisitor() { }
+
+void CellBuffer::visit(CellVisitor&) const {
+	throw CheckpointException();
+}
+
+void CellBuffer::hold(bool) {
+
+}
+
 std::ostream& CellBuffer::print(std::ostream& os) const{
 	os << "==============================================================================\n";
 	os << "[" << screen++ << "] buffer size=" << size() << " . Cell on the top :\n\n ";
@@ -23,6 +23,21 @@ class CellBufferOverflow : Exception {
 
 };
 
+/** \ingroup strategy
+ *
+ * \brief Read-only visitor of the cells of a buffer.
+ *
+ * \see #ibex::CellBuffer::visit(CellVisitor&) const.
+ */
+class CellVisitor {
+public:
+	/** Delete *this. */
+	virtual ~CellVisitor();
+
+	/** Visit a cell (which is not modified). */
+	virtual void visit(const Cell& cell)=0;
+};
+
 /** \ingroup strategy
  *
  * \brief Cell Buffer
@@ -73,6 +88,30 @@ class CellBuffer {
 	/** Return the next box (but does not pop it).*/
 	virtual Cell* top() const=0;
 
+	/**
+	 * \brief Visit all the cells, without modifying the buffer.
+	 *
+	 * The cells are visited in an order such that pushing them, in the same
+	 * order, into an empty buffer of the same kind gives back the same buffer
+	 * (e.g., from the bottom to the top of a stack).
+	 *
+	 * By default, this function is not implemented: a #ibex::CheckpointException
+	 * is raised (the checkpoint of this buffer fails).
+	 */
+	virtual void visit(CellVisitor& v) const;
+
+	/**
+	 * \brief Keep the cells stored in files unchanged (or stop keeping them).
+	 *
+	 * A buffer is held while a checkpoint is written by a child process (see
+	 * #ibex::BackgroundCheckpoint). This process visits a copy of the memory,
+	 * but the files are shared: the space of the cells removed from a file
+	 * must not be reused nor given back until the buffer is released.
+	 *
+	 * By default, does nothing (the cells are in memory).
+	 */
+	virtual void hold(bool h);
+
 	/** Count the number of cells pushed since
 	 * the object is created. */
 	//unsigned int nb_cells;
@@ -0,0 +1,367 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellHybridBuffer.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CellHybridBuffer.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Minimal size of the mapping of the spill file */
+const size_t MIN_MAP_SIZE=1<<20;
+
+/* An input stream buffer reading a record of the spill file */
+class RecordBuf : public streambuf {
+public:
+	RecordBuf(char* p, size_t n) {
+		setg(p,p,p+n);
+	}
+};
+
+/* Remove a hole from the index by size */
+void erase_hole(multimap<size_t,size_t>& holes_by_size, size_t offset, size_t size) {
+	pair<multimap<size_t,size_t>::iterator,multimap<size_t,size_t>::iterator> r=holes_by_size.equal_range(size);
+	for (multimap<size_t,size_t>::iterator it=r.first; it!=r.second; it++)
+		if (it->second==offset) {
+			holes_by_size.erase(it);
+			return;
+		}
+}
+
+}
+
+CellHybridBuffer::CellHybridBuffer(CostFunc<Cell>& cost, size_t memory_limit, const char* filename) :
+		cost(cost), memory_limit(memory_limit), nb_pushed(0), max_cells(0), proto(NULL), fd(-1), map(NULL), map_size(0), end(0), held(false) {
+
+	if (filename) {
+		fd=open(filename, O_RDWR | O_CREAT | O_TRUNC, 0600);
+		if (fd!=-1) unlink(filename);
+	} else {
+		const char* dir=getenv("TMPDIR");
+		string tmp=string(dir? dir : "/tmp")+"/ibex_cells_XXXXXX";
+		fd=mkstemp(&tmp[0]);
+		if (fd!=-1) unlink(tmp.c_str());
+	}
+	// note: if the file cannot be created, cells are
+	// kept in memory and an overflow occurs when spilling
+}
+
+CellHybridBuffer::~CellHybridBuffer() {
+	flush();
+	// if the buffer is held, the file is not truncated: it is
+	// removed when the other process has closed it (see the constructor)
+	if (map) munmap(map,map_size);
+	if (proto) delete proto;
+	if (fd!=-1) close(fd);
+}
+
+void CellHybridBuffer::flush() {
+	for (multimap<Key,Cell*>::iterator it=mem.begin(); it!=mem.end(); it++)
+		delete it->second;
+	mem.clear();
+	// the space of the records is reused when the buffer is released
+	if (held)
+		for (multimap<Key,Record>::iterator it=disk.begin(); it!=disk.end(); it++)
+			free_record(it->second);
+	disk.clear();
+	reset_file();
+	nb_pushed=0;
+}
+
+unsigned int CellHybridBuffer::size() const {
+	return mem.size()+disk.size();
+}
+
+bool CellHybridBuffer::empty() const {
+	return mem.empty() && disk.empty();
+}
+
+unsigned int CellHybridBuffer::nb_in_memory() const {
+	return mem.size();
+}
+
+unsigned int CellHybridBuffer::nb_spilled() const {
+	return disk.size();
+}
+
+size_t CellHybridBuffer::file_size() const {
+	return end;
+}
+
+void CellHybridBuffer::push(Cell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+
+	if (max_cells==0) init_limit(*cell);
+
+	// the last pushed cell comes first among cells of the same cost
+	mem.insert(make_pair(Key(cost.cost(*cell),-nb_pushed),cell));
+	nb_pushed++;
+
+	if (mem.size()>max_cells) spill();
+}
+
+Cell* CellHybridBuffer::pop() {
+	Cell* c=top();
+	mem.erase(mem.begin());
+	return c;
+}
+
+Cell* CellHybridBuffer::top() const {
+	assert(!empty());
+
+	if (!disk.empty() && (mem.empty() || disk.begin()->first < mem.begin()->first))
+		page_in();
+
+	return mem.begin()->second;
+}
+
+void CellHybridBuffer::visit(CellVisitor& v) const {
+	vector<int> slots;
+	if (proto)
+		for (int i=0; i<proto->nb_data; i++)
+			if (proto->data[i]) slots.push_back(i);
+
+	// merge the cells in memory and in the file, by decreasing key
+	multimap<Key,Cell*>::const_reverse_iterator it1=mem.rbegin();
+	multimap<Key,Record>::const_reverse_iterator it2=disk.rbegin();
+
+	while (it1!=mem.rend() || it2!=disk.rend()) {
+		if (it2==disk.rend() || (it1!=mem.rend() && it2->first < it1->first)) {
+			v.visit(*it1->second);
+			it1++;
+		} else {
+			RecordBuf buf(map+it2->second.first, it2->second.second);
+			istream is(&buf);
+			Cell* c=proto->load(is,slots);
+			v.visit(*c);
+			delete c;
+			it2++;
+		}
+	}
+}
+
+double CellHybridBuffer::minimum() const {
+	assert(!empty());
+	if (mem.empty()) return disk.begin()->first.first;
+	if (disk.empty()) return mem.begin()->first.first;
+	return std::min(mem.begin()->first.first, disk.begin()->first.first);
+}
+
+void CellHybridBuffer::contract(double max_cost) {
+	// the first key with a greater cost
+	Key k(max_cost,numeric_limits<long>::max());
+
+	multimap<Key,Cell*>::iterator it=mem.upper_bound(k);
+	for (multimap<Key,Cell*>::iterator it2=it; it2!=mem.end(); it2++)
+		delete it2->second;
+	mem.erase(it,mem.end());
+
+	multimap<Key,Record>::iterator it3=disk.upper_bound(k);
+	for (multimap<Key,Record>::iterator it4=it3; it4!=disk.end(); it4++)
+		free_record(it4->second);
+	disk.erase(it3,disk.end());
+	if (disk.empty()) reset_file();
+}
+
+void CellHybridBuffer::hold(bool h) {
+	if (h==held) return;
+	held=h;
+	if (held) return;
+
+	for (vector<Record>::iterator it=held_records.begin(); it!=held_records.end(); it++)
+		free_record(*it);
+	held_records.clear();
+
+	if (disk.empty()) reset_file();
+}
+
+size_t CellHybridBuffer::memory(const Cell& c) {
+	// the serialized data gives an idea of the size of the data
+	ostringstream os;
+	c.save(os);
+	int n=c.box.size();
+	size_t data=os.str().size()-2*n*sizeof(double);
+
+	return sizeof(Cell)+n*sizeof(Interval)
+			+c.nb_data*(sizeof(Backtrackable*)+sizeof(Backtrackable))+data;
+}
+
+void CellHybridBuffer::init_limit(const Cell& c) {
+	size_t bytes=memory(c)+sizeof(pair<const Key,Cell*>)+4*sizeof(void*); // node of the map
+
+	max_cells=memory_limit/bytes;
+	if (max_cells<2) max_cells=2;
+}
+
+void CellHybridBuffer::spill() const {
+	// a quarter of the cells is spilled at once
+	unsigned int target=max_cells-max_cells/4;
+
+	while (mem.size()>target) {
+		multimap<Key,Cell*>::iterator it=mem.end();
+		it--; // the cell with the highest cost
+
+		ostringstream os;
+		it->second->save(os);
+		const string& s=os.str();
+
+		size_t offset=alloc_record(s.size());
+		memcpy(map+offset, s.data(), s.size());
+		disk.insert(make_pair(it->first,Record(offset,s.size())));
+
+		// the first spilled cell is kept for reading the others
+		if (!proto) proto=it->second;
+		else delete it->second;
+
+		mem.erase(it);
+	}
+}
+
+void CellHybridBuffer::page_in() const {
+	assert(proto);
+
+	vector<int> slots;
+	for (int i=0; i<proto->nb_data; i++)
+		if (proto->data[i]) slots.push_back(i);
+
+	// read a quarter of the memory at once, best cells first
+	unsigned int batch=max_cells/4>0? max_cells/4 : 1;
+
+	do {
+		multimap<Key,Record>::iterator it=disk.begin();
+		RecordBuf buf(map+it->second.first, it->second.second);
+		istream is(&buf);
+		mem.insert(make_pair(it->first,proto->load(is,slots)));
+		free_record(it->second);
+		disk.erase(it);
+	} while (!disk.empty() && --batch>0 && mem.size()<max_cells);
+
+	if (disk.empty()) reset_file();
+
+	if (mem.size()>max_cells) spill();
+}
+
+void CellHybridBuffer::reset_file() const {
+	assert(disk.empty());
+	// done when the buffer is released
+	if (held) return;
+	if (map) {
+		munmap(map,map_size);
+		map=NULL;
+		map_size=0;
+		// give the disk space back
+		if (ftruncate(fd,0)!=0) { }
+	}
+	end=0;
+	holes.clear();
+	holes_by_size.clear();
+	if (proto) {
+		delete proto;
+		proto=NULL;
+	}
+}
+
+size_t CellHybridBuffer::alloc_record(size_t n) const {
+	// the smallest hole that is large enough
+	multimap<size_t,size_t>::iterator it=holes_by_size.lower_bound(n);
+
+	if (it==holes_by_size.end()) {
+		grow_file(end+n);
+		size_t offset=end;
+		end+=n;
+		return offset;
+	}
+
+	size_t size=it->first;
+	size_t offset=it->second;
+	holes_by_size.erase(it);
+	holes.erase(offset);
+
+	// the rest of the hole remains free
+	if (size>n) {
+		holes.insert(make_pair(offset+n,size-n));
+		holes_by_size.insert(make_pair(size-n,offset+n));
+	}
+	return offset;
+}
+
+void CellHybridBuffer::free_record(const Record& r) const {
+	// reused when the buffer is released
+	if (held) {
+		held_records.push_back(r);
+		return;
+	}
+
+	size_t offset=r.first;
+	size_t size=r.second;
+
+	// merge with the next hole
+	std::map<size_t,size_t>::iterator next=holes.find(offset+size);
+	if (next!=holes.end()) {
+		erase_hole(holes_by_size,next->first,next->second);
+		size+=next->second;
+		holes.erase(next);
+	}
+
+	// merge with the previous hole
+	std::map<size_t,size_t>::iterator prev=holes.lower_bound(offset);
+	if (prev!=holes.begin()) {
+		prev--;
+		if (prev->first+prev->second==offset) {
+			erase_hole(holes_by_size,prev->first,prev->second);
+			offset=prev->first;
+			size+=prev->second;
+			holes.erase(prev);
+		}
+	}
+
+	if (offset+size==end)
+		end=offset; // the file shrinks
+	else {
+		holes.insert(make_pair(offset,size));
+		holes_by_size.insert(make_pair(size,offset));
+	}
+}
+
+void CellHybridBuffer::grow_file(size_t n) const {
+	if (n<=map_size) return;
+
+	if (fd==-1) throw CellBufferOverflow();
+
+	size_t new_size=map_size>0? 2*map_size : MIN_MAP_SIZE;
+	while (new_size<n) new_size*=2;
+
+	if (ftruncate(fd,new_size)!=0) throw CellBufferOverflow();
+
+	if (map) munmap(map,map_size);
+	void* p=mmap(NULL,new_size,PROT_READ | PROT_WRITE,MAP_SHARED,fd,0);
+	if (p==MAP_FAILED) {
+		map=NULL;
+		map_size=0;
+		throw CellBufferOverflow();
+	}
+	map=(char*) p;
+	map_size=new_size;
+}
+
+} // end namespace ibex
@@ -0,0 +1,208 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellHybridBuffer.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_HYBRID_BUFFER_H__
+#define __IBEX_CELL_HYBRID_BUFFER_H__
+
+#include "ibex_CellBuffer.h"
+#include "ibex_Heap.h"
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Best-first buffer with a memory limit.
+ *
+ * The cell with the lowest cost is returned first (best-first search). Among
+ * cells with the same cost, the last pushed cell is returned first (depth-first
+ * search), so that a constant cost gives the same order as #ibex::CellStack.
+ *
+ * The cells kept in memory do not exceed a given amount of memory. When this
+ * limit is reached, the cells with the highest cost are written (spilled) into a
+ * memory-mapped file and deleted. They are read back, best cells first, as soon
+ * as they become the best cells of the buffer.
+ *
+ * The data of the cells is written with #ibex::Backtrackable::save(std::ostream&) const.
+ * A spilled cell is read back as a subcell of the first spilled cell, which is
+ * kept by the buffer for that purpose (see #ibex::Cell::load()): data that is not
+ * saved is inherited from this cell, which is an unrelated cell in general.
+ * So a data type must implement #ibex::Backtrackable::save(std::ostream&) const
+ * and #ibex::Backtrackable::load(std::istream&) unless its value only depends on
+ * the root cell or is a mere hint, valid for any cell. In IBEX:
+ * <ul>
+ * <li> #ibex::BisectedVar, #ibex::EntailedCtr, #ibex::OptimData and #ibex::Multipliers are saved;
+ * <li> #ibex::KrawczykPrecond is not (any preconditioner is valid).
+ * </ul>
+ *
+ * \note The memory used by a cell is estimated once, with the first pushed cell.
+ */
+class CellHybridBuffer : public CellBuffer {
+public:
+	/**
+	 * \brief Create a buffer.
+	 *
+	 * \param cost         - the cost of a cell (the lower, the better).
+	 * \param memory_limit - maximal number of bytes used by the cells in memory.
+	 * \param filename     - the spill file. By default (NULL), an anonymous
+	 *                       temporary file is created in the directory given by the
+	 *                       TMPDIR environment variable (or /tmp).
+	 */
+	CellHybridBuffer(CostFunc<Cell>& cost, size_t memory_limit, const char* filename=NULL);
+
+	/** \brief Delete *this (the remaining cells are deleted). */
+	~CellHybridBuffer();
+
+	/** \brief Flush the buffer.
+	 * All the remaining cells will be *deleted* */
+	void flush();
+
+	/** \brief Return the size of the buffer (cells in memory and in the file). */
+	unsigned int size() const;
+
+	/** \brief Return true if the buffer is empty. */
+	bool empty() const;
+
+	/** \brief Push a new cell. */
+	void push(Cell* cell);
+
+	/** \brief Pop the cell with the lowest cost and return it.*/
+	Cell* pop();
+
+	/** \brief Return the cell with the lowest cost (but does not pop it).*/
+	Cell* top() const;
+
+	/**
+	 * \brief Visit the cells, from the highest to the lowest cost.
+	 *
+	 * The spilled cells are read back (temporarily) from the file.
+	 */
+	void visit(CellVisitor& v) const;
+
+	/**
+	 * \brief Keep the records of the spill file unchanged (or stop keeping them).
+	 *
+	 * While the buffer is held, the space of the cells read back (or removed)
+	 * is not reused and the file is not truncated.
+	 */
+	void hold(bool h);
+
+	/** \brief Return the lowest cost of the cells (the buffer must not be empty). */
+	double minimum() const;
+
+	/**
+	 * \brief Contract the buffer
+	 *
+	 * Removes (and deletes) all the cells with a cost greater than \a max_cost
+	 * (the cost calculated when the cell was pushed).
+	 */
+	void contract(double max_cost);
+
+	/**
+	 * \brief Estimate of the memory used by a cell, in bytes.
+	 *
+	 * Calculated from the size of the box and the data written by #ibex::Cell::save().
+	 */
+	static size_t memory(const Cell& c);
+
+	/** \brief Number of cells in memory. */
+	unsigned int nb_in_memory() const;
+
+	/** \brief Number of cells in the spill file. */
+	unsigned int nb_spilled() const;
+
+	/**
+	 * \brief Number of bytes of the spill file in use (including holes).
+	 *
+	 * The space of the cells read back (or removed by #contract(double))
+	 * is reused by the next spilled cells.
+	 */
+	size_t file_size() const;
+
+	/** \brief The cost function. */
+	CostFunc<Cell>& cost;
+
+	/** \brief Maximal number of bytes used by the cells in memory. */
+	const size_t memory_limit;
+
+private:
+	CellHybridBuffer(const CellHybridBuffer&);            // forbidden
+	CellHybridBuffer& operator=(const CellHybridBuffer&); // forbidden
+
+	/* Cells are sorted by cost, then by decreasing push number */
+	typedef std::pair<double,long> Key;
+
+	/* Location of a cell in the spill file */
+	typedef std::pair<size_t,size_t> Record;
+
+	/* Write the cells with the highest cost into the file. */
+	void spill() const;
+
+	/* Read the best cells of the file. */
+	void page_in() const;
+
+	/* Give the pages of the spill file back (the file must contain no cell). */
+	void reset_file() const;
+
+	/* Return the offset of n free bytes in the file (a hole, or the end). */
+	size_t alloc_record(size_t n) const;
+
+	/* Make the bytes of a record free */
+	void free_record(const Record& r) const;
+
+	/* Make the mapping of the file contain at least n bytes. */
+	void grow_file(size_t n) const;
+
+	/* Estimate the memory used by the cells (from the first cell) */
+	void init_limit(const Cell& c);
+
+	/* Cells in memory */
+	mutable std::multimap<Key,Cell*> mem;
+
+	/* Cells in the spill file */
+	mutable std::multimap<Key,Record> disk;
+
+	/* Number of cells pushed so far */
+	long nb_pushed;
+
+	/* Maximal number of cells in memory (0 if not initialized yet) */
+	unsigned int max_cells;
+
+	/* The cell from which the spilled cells are read back (see Cell::load) */
+	mutable Cell* proto;
+
+	/* Descriptor, mapping and size of the file */
+	mutable int fd;
+	mutable char* map;
+	mutable size_t map_size;
+
+	/* End of the last record in the file */
+	mutable size_t end;
+
+	/* Free space before end: offset -> size (adjacent holes are merged) */
+	mutable std::map<size_t,size_t> holes;
+
+	/* The same holes: size -> offset */
+	mutable std::multimap<size_t,size_t> holes_by_size;
+
+	/* True if the records must not be modified (see hold) */
+	bool held;
+
+	/* Records freed while the buffer is held */
+	mutable std::vector<Record> held_records;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CELL_HYBRID_BUFFER_H__
@@ -0,0 +1,290 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellPool.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CellPool.h"
+#include "ibex_Cell.h"
+
+#include <vector>
+#include <new>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Each block starts with a header that gives the arena
+ * of the block (NULL if allocated by the system) and its size class.
+ * The header size preserves the alignment of the block.
+ */
+struct Header {
+	CellPool::Arena* arena;
+	int size_class;
+};
+
+const size_t HEADER_SIZE=16;
+
+/* Blocks have a size multiple of 16 bytes (the header excluded) */
+const size_t GRANULARITY=16;
+
+/* Number of size classes (bigger blocks are allocated by the system) */
+const int NB_SIZE_CLASSES=16;
+
+inline Header* header(void* p) {
+	return (Header*) (((char*) p) - HEADER_SIZE);
+}
+
+inline void* block(Header* h) {
+	return ((char*) h) + HEADER_SIZE;
+}
+
+}
+
+const int CellPool::default_slab_size=1024;
+
+class CellPool::Arena {
+public:
+	Arena(int slab_size);
+
+	~Arena();
+
+	/* Return a free block of the given size class */
+	Header* alloc(int size_class);
+
+	/* Put a block in the free list */
+	void free(Header* h);
+
+	/* Return a free box */
+	Interval* alloc_box(int n);
+
+	/* Put a box in the free list */
+	void free_box(Interval* vec);
+
+	/* Give the slabs back to the system (all blocks must be free) */
+	void release();
+
+	/* Number of objects per slab */
+	const int slab_size;
+
+	/* Dimension of the boxes (0 if no box allocated yet). */
+	int box_size;
+
+	/* Number of blocks and boxes in use */
+	long nb_used;
+
+	/* Number of blocks and boxes obtained without system allocation */
+	unsigned long nb_avoided;
+
+	/* True if the pool of this arena has been deleted. */
+	bool orphan;
+
+private:
+	/* Free lists of blocks (one for each size class) */
+	Header* free_blocks[NB_SIZE_CLASSES];
+
+	/* Free boxes */
+	vector<Interval*> free_boxes;
+
+	/* Slabs of blocks */
+	vector<char*> slabs;
+
+	/* Slabs of boxes */
+	vector<Interval*> box_slabs;
+};
+
+CellPool::Arena::Arena(int slab_size) : slab_size(slab_size), box_size(0), nb_used(0), nb_avoided(0), orphan(false) {
+	assert(slab_size>0);
+	for (int i=0; i<NB_SIZE_CLASSES; i++)
+		free_blocks[i]=NULL;
+}
+
+CellPool::Arena::~Arena() {
+	release();
+}
+
+Header* CellPool::Arena::alloc(int size_class) {
+	Header* h=free_blocks[size_class];
+
+	if (h) {
+		nb_avoided++;
+	} else {
+		// allocate a new slab and chain all its blocks
+		size_t size=HEADER_SIZE+(size_class+1)*GRANULARITY;
+		char* slab=(char*) ::operator new(slab_size*size);
+		slabs.push_back(slab);
+		for (int i=slab_size-1; i>=0; i--) {
+			Header* b=(Header*) (slab+i*size);
+			b->arena=this;
+			b->size_class=size_class;
+			*((Header**) block(b))=free_blocks[size_class];
+			free_blocks[size_class]=b;
+		}
+		h=free_blocks[size_class];
+		// the other blocks of the slab will be obtained without system allocation
+	}
+
+	free_blocks[size_class]=*((Header**) block(h));
+	nb_used++;
+	return h;
+}
+
+void CellPool::Arena::free(Header* h) {
+	*((Header**) block(h))=free_blocks[h->size_class];
+	free_blocks[h->size_class]=h;
+	nb_used--;
+}
+
+Interval* CellPool::Arena::alloc_box(int n) {
+	assert(n==box_size);
+
+	if (free_boxes.empty()) {
+		Interval* slab=new Interval[slab_size*n];
+		box_slabs.push_back(slab);
+		for (int i=slab_size-1; i>=0; i--)
+			free_boxes.push_back(slab+i*n);
+	} else
+		nb_avoided++;
+
+	Interval* vec=free_boxes.back();
+	free_boxes.pop_back();
+	nb_used++;
+	return vec;
+}
+
+void CellPool::Arena::free_box(Interval* vec) {
+	free_boxes.push_back(vec);
+	nb_used--;
+}
+
+void CellPool::Arena::release() {
+	assert(nb_used==0);
+
+	for (vector<char*>::iterator it=slabs.begin(); it!=slabs.end(); it++)
+		::operator delete(*it);
+	slabs.clear();
+
+	for (vector<Interval*>::iterator it=box_slabs.begin(); it!=box_slabs.end(); it++)
+		delete[] *it;
+	box_slabs.clear();
+
+	for (int i=0; i<NB_SIZE_CLASSES; i++)
+		free_blocks[i]=NULL;
+	free_boxes.clear();
+
+	box_size=0;
+}
+
+namespace {
+
+// arena of the backtrackable data currently created (one for each thread)
+__thread CellPool::Arena* current_arena=NULL;
+
+}
+
+CellPool::Scope::Scope(Arena* arena) : saved(current_arena) {
+	current_arena=arena;
+}
+
+CellPool::Scope::~Scope() {
+	current_arena=saved;
+}
+
+CellPool::CellPool(int slab_size) : enabled(true), arena(new Arena(slab_size)) {
+
+}
+
+CellPool::~CellPool() {
+	if (arena->nb_used==0)
+		delete arena;
+	else
+		// the arena will be deleted with its last object
+		arena->orphan=true;
+}
+
+Cell* CellPool::new_cell(const IntervalVector& box) {
+	if (enabled)
+		return new_cell(arena,box);
+	else
+		return new Cell(box);
+}
+
+bool CellPool::release() {
+	if (arena->nb_used>0) return false;
+	arena->release();
+	return true;
+}
+
+unsigned long CellPool::nb_avoided() const {
+	return arena->nb_avoided;
+}
+
+Cell* CellPool::new_cell(Arena* arena, const IntervalVector& box) {
+	return new (arena) Cell(box, arena);
+}
+
+void* CellPool::alloc(Arena* arena, size_t size) {
+	Header* h;
+	int size_class=size==0? 0 : (size-1)/GRANULARITY;
+
+	if (arena && size_class<NB_SIZE_CLASSES)
+		h=arena->alloc(size_class);
+	else {
+		h=(Header*) ::operator new(HEADER_SIZE+size);
+		h->arena=NULL;
+		h->size_class=-1;
+	}
+	return block(h);
+}
+
+void* CellPool::alloc(size_t size) {
+	return alloc(current_arena, size);
+}
+
+void CellPool::free(void* p) {
+	if (!p) return;
+
+	Header* h=header(p);
+	Arena* arena=h->arena;
+
+	if (!arena)
+		::operator delete(h);
+	else {
+		arena->free(h);
+		if (arena->orphan && arena->nb_used==0)
+			delete arena;
+	}
+}
+
+Interval* CellPool::alloc_box(Arena* arena, int n) {
+	if (arena->box_size==0)
+		arena->box_size=n;
+
+	if (n==arena->box_size)
+		return arena->alloc_box(n);
+	else {
+		arena->nb_used++;
+		return new Interval[n];
+	}
+}
+
+void CellPool::free_box(Arena* arena, Interval* vec, int n) {
+	if (n==arena->box_size)
+		arena->free_box(vec);
+	else {
+		arena->nb_used--;
+		delete[] vec;
+	}
+	// note: the arena cannot be orphan and
+	// unused here (the cell is not deleted yet).
+}
+
+} // end namespace ibex
@@ -0,0 +1,142 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellPool.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_POOL_H__
+#define __IBEX_CELL_POOL_H__
+
+#include <cstddef>
+
+namespace ibex {
+
+class Cell;
+class IntervalVector;
+class Interval;
+
+/** \ingroup strategy
+ *
+ * \brief Memory pool for cells.
+ *
+ * A strategy (#ibex::Solver, #ibex::Paver, #ibex::Optimizer) creates and deletes
+ * two cells at each bisection, each with its own box and its own backtrackable data.
+ * A pool recycles the memory of these objects: it is allocated by slabs and the memory
+ * of a deleted cell (resp. box, data) is reused for the next cell (resp. box, data).
+ *
+ * The root cell is created with #new_cell(const IntervalVector&). All the descendants
+ * of this cell (see #ibex::Cell::bisect()) are created in the same pool, as well as
+ * all the backtrackable data created by #ibex::Cell::add() and #ibex::Backtrackable::down().
+ * Cells of a pool are deleted with the usual "delete" operator.
+ *
+ * The slabs are given back to the system by #release(), when all the cells are deleted.
+ * If the pool is destroyed while some cells are still alive, the slabs are given back
+ * when the last cell is deleted.
+ *
+ * \warning A pool is not thread-safe (it must not be used by parallel strategies).
+ * \warning The box of a cell created by a pool must not be resized.
+ */
+class CellPool {
+public:
+	/**
+	 * \brief Create a pool.
+	 *
+	 * \param slab_size - number of objects (cells, boxes or data)
+	 *                    allocated at once by the pool.
+	 */
+	explicit CellPool(int slab_size=default_slab_size);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CellPool();
+
+	/**
+	 * \brief Create a root cell in the pool.
+	 *
+	 * If the pool is not #enabled, the cell is created by the system allocator.
+	 */
+	Cell* new_cell(const IntervalVector& box);
+
+	/**
+	 * \brief Give the slabs back to the system.
+	 *
+	 * Nothing is done if some objects are still in use.
+	 * \return true if the slabs have been given back.
+	 */
+	bool release();
+
+	/**
+	 * \brief Number of allocations avoided.
+	 *
+	 * Number of objects (cells, boxes and data) created by the pool without
+	 * calling the system allocator (since the pool was created).
+	 */
+	unsigned long nb_avoided() const;
+
+	/**
+	 * \brief True if the pool is enabled (by default).
+	 *
+	 * If false, cells are created by the system allocator.
+	 */
+	bool enabled;
+
+	/** Default number of objects in a slab (1024). */
+	static const int default_slab_size;
+
+	/*
+	 * \brief The slabs and the free lists (internal).
+	 *
+	 * The slabs are shared by the pool and its objects.
+	 */
+	class Arena;
+
+	/*
+	 * \brief Make all the backtrackable data created during the
+	 * lifetime of this object belong to an arena (internal).
+	 *
+	 * The previous arena is restored when this object is destroyed.
+	 */
+	class Scope {
+	public:
+		Scope(Arena* arena);
+		~Scope();
+	private:
+		Arena* saved;
+	};
+
+private:
+	friend class Cell;
+	friend class Backtrackable;
+
+	CellPool(const CellPool&);            // forbidden
+	CellPool& operator=(const CellPool&); // forbidden
+
+	/* Create a cell in an arena */
+	static Cell* new_cell(Arena* arena, const IntervalVector& box);
+
+	/* Allocate a block (an arena of NULL means the system allocator) */
+	static void* alloc(Arena* arena, size_t size);
+
+	/* Allocate a block in the current arena (see Scope) */
+	static void* alloc(size_t size);
+
+	/* Free a block allocated by alloc(...) */
+	static void free(void* p);
+
+	/* Allocate a box of size n */
+	static Interval* alloc_box(Arena* arena, int n);
+
+	/* Free a box allocated by alloc_box(...) */
+	static void free_box(Arena* arena, Interval* vec, int n);
+
+	Arena* arena;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CELL_POOL_H__
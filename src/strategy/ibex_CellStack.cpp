@@ -14,8 +14,8 @@ namespace ibex {
 
 void CellStack::flush() {
 	while (!cstack.empty()) {
-		delete cstack.top();
-		cstack.pop();
+		delete cstack.back();
+		cstack.pop_back();
 	}
 }
 
@@ -29,17 +29,22 @@ bool CellStack::empty() const {
 
 void CellStack::push(Cell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
-	cstack.push(cell);
+	cstack.push_back(cell);
 }
 
 Cell* CellStack::pop() {
-	Cell* c = cstack.top();
-	cstack.pop();
+	Cell* c = cstack.back();
+	cstack.pop_back();
 	return c;
 }
 
 Cell* CellStack::top() const {
-	return cstack.top();
+	return cstack.back();
+}
+
+void CellStack::visit(CellVisitor& v) const {
+	for (std::vector<Cell*>::const_iterator it=cstack.begin(); it!=cstack.end(); it++)
+		v.visit(**it);
 }
 
 } // end namespace ibex
@@ -12,7 +12,7 @@
 #define __IBEX_CELL_STACK_H__
 
 #include "ibex_CellBuffer.h"
-#include <stack>
+#include <vector>
 
 namespace ibex {
 
@@ -43,9 +43,12 @@ class CellStack : public CellBuffer {
   /** Return the next box (but does not pop it).*/
   Cell* top() const;
 
+  /** Visit the cells, from the bottom to the top. */
+  void visit(CellVisitor& v) const;
+
  private:
-  /* Stack of cells */
-  std::stack<Cell*> cstack;
+  /* Stack of cells (the top is the last one) */
+  std::vector<Cell*> cstack;
 };
 
 } // end namespace ibex
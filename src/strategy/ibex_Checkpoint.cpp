@@ -0,0 +1,357 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Checkpoint.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Checkpoint.h"
+#include "ibex_Thread.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <cerrno>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char MAGIC[4]={'I','B','E','X'};
+
+// to be incremented each time the format changes
+const int VERSION=2;
+
+// maximal length of the name of a data class
+const int MAX_NAME_LENGTH=1024;
+
+// maximal dimension of an empty box (its bounds are not written,
+// so its size cannot be checked against the size of the file)
+const int MAX_DIM=1<<24;
+
+}
+
+CheckpointWriter::CheckpointWriter(const char* filename, int tag) : filename(filename), tmp_filename(string(filename)+".tmp"), closed(false) {
+	os.open(tmp_filename.c_str(), ios::out | ios::binary | ios::trunc);
+	if (!os.is_open()) throw CheckpointException();
+
+	os.write(MAGIC, sizeof(MAGIC));
+	write(VERSION);
+	write(tag);
+}
+
+CheckpointWriter::~CheckpointWriter() {
+	if (!closed) {
+		os.close();
+		remove(tmp_filename.c_str());
+	}
+}
+
+void CheckpointWriter::write(int x) {
+	os.write((char*) &x, sizeof(int));
+}
+
+void CheckpointWriter::write(double x) {
+	os.write((char*) &x, sizeof(double));
+}
+
+void CheckpointWriter::write(const Vector& x) {
+	write(x.size());
+	for (int i=0; i<x.size(); i++)
+		write(x[i]);
+}
+
+void CheckpointWriter::write(const IntervalVector& box) {
+	// note: the size of an empty box is saved with a negative sign
+	if (box.is_empty()) {
+		write(-box.size());
+		return;
+	}
+	write(box.size());
+	for (int i=0; i<box.size(); i++) {
+		write(box[i].lb());
+		write(box[i].ub());
+	}
+}
+
+void CheckpointWriter::write(const vector<IntervalVector>& boxes) {
+	write((int) boxes.size());
+	for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); it++)
+		write(*it);
+}
+
+void CheckpointWriter::write(const CellBuffer& buffer) {
+	if (buffer.empty()) {
+		write(0); // number of slots
+		write(0); // dimension
+		write(0); // number of cells
+	} else {
+		CellWriter w(*this, buffer.size());
+		buffer.visit(w);
+	}
+}
+
+void CheckpointWriter::write_slots(const Cell& c) {
+	// the class names of the data
+	int nb_slots=0;
+	for (int i=0; i<c.nb_data; i++)
+		if (c.data[i]) nb_slots++;
+	write(nb_slots);
+	for (int i=0; i<c.nb_data; i++) {
+		if (!c.data[i]) continue;
+		const char* name=Cell::slot_name(i);
+		int len=strlen(name);
+		if (len>MAX_NAME_LENGTH) throw CheckpointException();
+		write(len);
+		os.write(name, len);
+	}
+	write(c.box.size());
+}
+
+CheckpointWriter::CellWriter::CellWriter(CheckpointWriter& w, int nb_cells) : w(w), nb_cells(nb_cells), first(true) {
+
+}
+
+void CheckpointWriter::CellWriter::visit(const Cell& c) {
+	// the header is written with the first cell
+	if (first) {
+		w.write_slots(c);
+		w.write(nb_cells);
+		first=false;
+	}
+	c.save(w.os);
+}
+
+void CheckpointWriter::close() {
+	assert(!closed);
+	os.close();
+	if (os.fail() || rename(tmp_filename.c_str(), filename.c_str())!=0) {
+		remove(tmp_filename.c_str());
+		closed=true;
+		throw CheckpointException();
+	}
+	closed=true;
+}
+
+CheckpointReader::CheckpointReader(const char* filename, int tag) {
+	is.open(filename, ios::in | ios::binary);
+	if (!is.is_open()) throw CheckpointException();
+
+	is.seekg(0, ios::end);
+	file_size=is.tellg();
+	is.seekg(0, ios::beg);
+	if (file_size<0 || is.fail()) throw CheckpointException();
+
+	char magic[sizeof(MAGIC)];
+	read(magic, sizeof(MAGIC));
+	if (memcmp(magic, MAGIC, sizeof(MAGIC))!=0) throw CheckpointException();
+	if (read_int()!=VERSION) throw CheckpointException();
+	if (read_int()!=tag) throw CheckpointException();
+}
+
+void CheckpointReader::read(char* x, size_t n) {
+	is.read(x, n);
+	if (is.fail()) throw CheckpointException();
+}
+
+void CheckpointReader::check_size(int n, size_t size) {
+	// note: a corrupted file may give any size
+	streamoff pos=is.tellg();
+	if (n<0 || pos<0 || (streamoff) n > (file_size-pos)/(streamoff) size) throw CheckpointException();
+}
+
+int CheckpointReader::read_int() {
+	int x;
+	read((char*) &x, sizeof(int));
+	return x;
+}
+
+double CheckpointReader::read_double() {
+	double x;
+	read((char*) &x, sizeof(double));
+	return x;
+}
+
+Vector CheckpointReader::read_vector() {
+	int n=read_int();
+	if (n<=0) throw CheckpointException();
+	check_size(n, sizeof(double));
+	Vector x(n);
+	for (int i=0; i<n; i++)
+		x[i]=read_double();
+	return x;
+}
+
+IntervalVector CheckpointReader::read_box() {
+	int n=read_int();
+	if (n==0) throw CheckpointException();
+	if (n<0) {
+		// an empty box is not followed by its bounds
+		if (n<-MAX_DIM) throw CheckpointException();
+		return IntervalVector::empty(-n);
+	}
+	check_size(n, 2*sizeof(double));
+	IntervalVector box(n);
+	for (int i=0; i<n; i++) {
+		double lb=read_double();
+		double ub=read_double();
+		box[i]=Interval(lb,ub);
+	}
+	return box;
+}
+
+void CheckpointReader::read(vector<IntervalVector>& boxes) {
+	int nb=read_int();
+	if (nb<0) throw CheckpointException();
+	for (int i=0; i<nb; i++)
+		boxes.push_back(read_box());
+}
+
+void CheckpointReader::read(CellBuffer& buffer, Cell& root) {
+	// map the slots of the file to the slots of this process
+	int nb_slots=read_int();
+	if (nb_slots<0 || nb_slots>root.nb_data) throw CheckpointException();
+	vector<int> slots;
+	for (int i=0; i<nb_slots; i++) {
+		int len=read_int();
+		if (len<=0 || len>MAX_NAME_LENGTH) throw CheckpointException();
+		string name(len,' ');
+		read(&name[0], len);
+		int s=Cell::slot(name.c_str());
+		if (s==-1 || s>=root.nb_data || !root.data[s]) throw CheckpointException();
+		slots.push_back(s);
+	}
+
+	int n=read_int();
+	int nb_cells=read_int();
+	if (nb_cells<0 || (nb_cells>0 && n!=root.box.size())) throw CheckpointException();
+
+	vector<Cell*> cells;
+	try {
+		for (int i=0; i<nb_cells; i++) {
+			cells.push_back(root.load(is, slots));
+			if (is.fail()) throw CheckpointException();
+		}
+	} catch (CheckpointException&) {
+		for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+			delete *it;
+		throw;
+	}
+
+	// the cells are pushed in the order they were written
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		buffer.push(*it);
+}
+
+BackgroundCheckpoint::BackgroundCheckpoint() : pid(-1), child(false), buffer(NULL) {
+
+}
+
+BackgroundCheckpoint::~BackgroundCheckpoint() {
+	try {
+		wait();
+	} catch (CheckpointException&) { }
+}
+
+#ifdef _WIN32
+
+bool BackgroundCheckpoint::begin(CellBuffer&) {
+	return true;
+}
+
+void BackgroundCheckpoint::end(bool) {
+
+}
+
+bool BackgroundCheckpoint::busy() {
+	return false;
+}
+
+void BackgroundCheckpoint::wait() {
+
+}
+
+#else
+
+bool BackgroundCheckpoint::begin(CellBuffer& buffer) {
+	assert(!child);
+
+	wait();
+
+	// the threads are not duplicated by fork
+	if (Thread::nb_running()>0) return true;
+
+	buffer.hold(true);
+
+	pid_t p=fork();
+
+	if (p==-1) {
+		// the checkpoint is written by this process
+		buffer.hold(false);
+		return true;
+	}
+
+	if (p==0) {
+		child=true;
+		pid=-1;
+		this->buffer=NULL;
+		return true;
+	}
+
+	pid=p;
+	this->buffer=&buffer;
+	return false;
+}
+
+void BackgroundCheckpoint::end(bool ok) {
+	// note: the child does not run the destructors nor flush
+	// the streams of the parent (e.g., the content of cout)
+	if (child) _exit(ok? 0 : 1);
+}
+
+bool BackgroundCheckpoint::busy() {
+	if (pid==-1) return false;
+
+	int status;
+	pid_t p=waitpid((pid_t) pid, &status, WNOHANG);
+	if (p==0) return true; // still running
+
+	terminated(p==-1? -1 : status);
+	return false;
+}
+
+void BackgroundCheckpoint::wait() {
+	if (pid==-1) return;
+
+	int status;
+	pid_t p;
+	do {
+		p=waitpid((pid_t) pid, &status, 0);
+	} while (p==-1 && errno==EINTR);
+
+	terminated(p==-1? -1 : status);
+}
+
+void BackgroundCheckpoint::terminated(int status) {
+	pid=-1;
+	buffer->hold(false);
+	buffer=NULL;
+
+	if (status==-1 || !WIFEXITED(status) || WEXITSTATUS(status)!=0)
+		throw CheckpointException();
+}
+
+#endif
+
+} // end namespace ibex
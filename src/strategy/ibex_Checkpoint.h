@@ -0,0 +1,283 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Checkpoint.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CHECKPOINT_H__
+#define __IBEX_CHECKPOINT_H__
+
+#include "ibex_CellBuffer.h"
+#include "ibex_Exception.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Thrown when a checkpoint file cannot be read (or written).
+ */
+class CheckpointException : public Exception { };
+
+/** \ingroup strategy
+ *
+ * \brief Save the state of a search into a file (checkpoint).
+ *
+ * The file is a compact binary file (the native representation of numbers
+ * is used, so it can only be read on the same kind of machine). It starts
+ * with a header that contains a tag identifying the strategy, followed by
+ * the fields written by the strategy, in the order of the calls.
+ *
+ * The data is first written into a temporary file ("<filename>.tmp") that
+ * replaces the file only when #close() is called: if the process is killed
+ * while writing, the previous checkpoint is still valid.
+ *
+ * \see #ibex::CheckpointReader.
+ */
+class CheckpointWriter {
+public:
+	/**
+	 * \brief Start writing a checkpoint.
+	 *
+	 * \param filename - the file
+	 * \param tag      - a number that identifies the strategy
+	 * \throw CheckpointException if the temporary file cannot be created.
+	 */
+	CheckpointWriter(const char* filename, int tag);
+
+	/**
+	 * \brief Delete *this.
+	 *
+	 * If #close() has not been called, the temporary
+	 * file is removed (the checkpoint is cancelled).
+	 */
+	~CheckpointWriter();
+
+	/** \brief Write an integer. */
+	void write(int x);
+
+	/** \brief Write a double. */
+	void write(double x);
+
+	/** \brief Write a vector. */
+	void write(const Vector& x);
+
+	/** \brief Write a box. */
+	void write(const IntervalVector& box);
+
+	/** \brief Write a list of boxes (e.g., the solutions). */
+	void write(const std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Write all the cells of a buffer.
+	 *
+	 * The buffer is not modified: the cells are written in the order
+	 * they are visited (see #ibex::CellBuffer::visit(CellVisitor&) const),
+	 * so that #ibex::CheckpointReader::read(CellBuffer&, Cell&) gives back
+	 * the same buffer. The data of the cells are written (see
+	 * #ibex::Backtrackable::save(std::ostream&) const) with the class name
+	 * of each slot.
+	 *
+	 * \pre All the cells have the same data (they descend from the same root cell).
+	 * \throw CheckpointException if the cells of the buffer cannot be visited.
+	 */
+	void write(const CellBuffer& buffer);
+
+	/**
+	 * \brief Finish the checkpoint.
+	 *
+	 * The temporary file replaces the checkpoint file.
+	 * \throw CheckpointException if an error occurred while writing.
+	 */
+	void close();
+
+private:
+	/* Write the cells of a buffer (the header with the first cell) */
+	class CellWriter : public CellVisitor {
+	public:
+		CellWriter(CheckpointWriter& w, int nb_cells);
+		void visit(const Cell& c);
+		CheckpointWriter& w;
+		int nb_cells;
+		bool first;
+	};
+
+	/* Write the class names of the data of a cell and the dimension */
+	void write_slots(const Cell& c);
+
+	std::string filename;
+	std::string tmp_filename;
+	std::ofstream os;
+	bool closed;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Read a file written by a #ibex::CheckpointWriter.
+ *
+ * The fields must be read in the order they were written.
+ * All the functions throw a #ibex::CheckpointException if the file is
+ * truncated or does not match the expected format.
+ */
+class CheckpointReader {
+public:
+	/**
+	 * \brief Start reading a checkpoint.
+	 *
+	 * \param filename - the file
+	 * \param tag      - the number that identifies the strategy (must be the
+	 *                   same as the one given to the writer).
+	 * \throw CheckpointException if the file cannot be opened or has not the right tag.
+	 */
+	CheckpointReader(const char* filename, int tag);
+
+	/** \brief Read an integer. */
+	int read_int();
+
+	/** \brief Read a double. */
+	double read_double();
+
+	/** \brief Read a vector. */
+	Vector read_vector();
+
+	/** \brief Read a box. */
+	IntervalVector read_box();
+
+	/** \brief Read a list of boxes (appended to \a boxes). */
+	void read(std::vector<IntervalVector>& boxes);
+
+	/**
+	 * \brief Read cells and push them into a buffer.
+	 *
+	 * Each cell is created as a subcell of \a root (see #ibex::Cell::load()).
+	 * The cells are pushed in the order they were written.
+	 * The root cell must have the same data as the cells that were saved,
+	 * typically, it is built as the root cell of a new search.
+	 */
+	void read(CellBuffer& buffer, Cell& root);
+
+private:
+	/* Read n bytes (throw an exception if the file is truncated) */
+	void read(char* x, size_t n);
+
+	/* Throw an exception if n items of the given size cannot
+	 * be read (before allocating them) */
+	void check_size(int n, size_t size);
+
+	std::ifstream is;
+
+	/* Size of the file */
+	std::streamoff file_size;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Write the checkpoints of a search in the background.
+ *
+ * A checkpoint is written by a child process (fork), which sees a copy-on-write
+ * image of the memory at the time of the fork. So the search is only paused for
+ * the fork, not for writing all the pending cells. The buffer of the search is
+ * held (see #ibex::CellBuffer::hold(bool)) until the child process terminates.
+ *
+ * Only one checkpoint is written at a time. If the process cannot be forked
+ * (or on Windows), the checkpoint is written by the calling process.
+ *
+ * Only the calling thread runs in the child process: a mutex held by another
+ * thread at the time of the fork would remain locked in the child. So the
+ * checkpoint is also written by the calling process while threads of
+ * #ibex::Thread are running (e.g., a #ibex::ParallelSolver or a parallel
+ * optimizer). Threads created by other means are not detected: do not use
+ * a checkpoint file with them.
+ *
+ * The child process must never leave the code that writes the checkpoint
+ * (it would go on with the search). Typical use (in a strategy):
+ * <pre>
+ *   if (background.begin(buffer)) {
+ *       try {
+ *           save(filename);
+ *       } catch (...) {
+ *           background.end(false); // does not return in the child process
+ *           throw;
+ *       }
+ *       background.end(true);
+ *   }
+ * </pre>
+ */
+class BackgroundCheckpoint {
+public:
+	/**
+	 * \brief No checkpoint in progress.
+	 */
+	BackgroundCheckpoint();
+
+	/**
+	 * \brief Delete *this.
+	 *
+	 * Wait for the current checkpoint (a failure is ignored).
+	 */
+	~BackgroundCheckpoint();
+
+	/**
+	 * \brief Start a checkpoint.
+	 *
+	 * Wait for the previous checkpoint, then fork (unless threads are running).
+	 * The buffer is held until the child process terminates.
+	 *
+	 * \return true in the process that must write the checkpoint and then
+	 *         call #end(bool): the child process, or the calling process if it
+	 *         cannot fork. Return false in the parent process.
+	 * \throw CheckpointException if the previous checkpoint has failed.
+	 */
+	bool begin(CellBuffer& buffer);
+
+	/**
+	 * \brief End the writing of a checkpoint.
+	 *
+	 * In the child process, terminate the process (never returns).
+	 * In the calling process, does nothing.
+	 *
+	 * \param ok - true if the checkpoint has been written.
+	 */
+	void end(bool ok);
+
+	/**
+	 * \brief True if a checkpoint is being written (does not wait).
+	 *
+	 * \throw CheckpointException if the checkpoint has failed.
+	 */
+	bool busy();
+
+	/**
+	 * \brief Wait for the current checkpoint (if any).
+	 *
+	 * \throw CheckpointException if the checkpoint has failed.
+	 */
+	void wait();
+
+private:
+	BackgroundCheckpoint(const BackgroundCheckpoint&);            // forbidden
+	BackgroundCheckpoint& operator=(const BackgroundCheckpoint&); // forbidden
+
+	/* The child process has terminated with this status */
+	void terminated(int status);
+
+	/* The child process (-1 if none) */
+	long pid;
+
+	/* True in the child process */
+	bool child;
+
+	/* The buffer held during the checkpoint */
+	CellBuffer* buffer;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CHECKPOINT_H__
@@ -10,6 +10,7 @@
 
 #include "ibex_EntailedCtr.h"
 #include <stdlib.h>
+#include <iostream>
 
 namespace ibex {
 
@@ -48,6 +49,15 @@ std::pair<Backtrackable*,Backtrackable*> EntailedCtr::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new EntailedCtr(*this),new EntailedCtr(*this));
 }
 
+void EntailedCtr::save(std::ostream& os) const {
+	os.write((char*) orig_entailed, orig_sys->nb_ctr*sizeof(bool));
+	os.write((char*) norm_entailed, norm_sys->nb_ctr*sizeof(bool));
+}
+
+void EntailedCtr::load(std::istream& is) {
+	is.read((char*) orig_entailed, orig_sys->nb_ctr*sizeof(bool));
+	is.read((char*) norm_entailed, norm_sys->nb_ctr*sizeof(bool));
+}
 
 void EntailedCtr::set_normalized_entailed(int i) {
 	norm_entailed[i] = true;
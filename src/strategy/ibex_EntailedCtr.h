@@ -82,6 +82,18 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write the entailment flags (binary format).
+	 */
+	void save(std::ostream& os) const;
+
+	/**
+	 * \brief Read the entailment flags.
+	 *
+	 * \pre The structure is initialized (inherited from the root).
+	 */
+	void load(std::istream& is);
+
 	/** number of constraints (normalized system) */
 	//const int n;
 
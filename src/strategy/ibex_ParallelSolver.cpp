@@ -0,0 +1,288 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_NoBisectableVariableException.h"
+#include "ibex_Timer.h"
+
+#include <deque>
+#include <cassert>
+#include <unistd.h>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * A worker: a thread with its own contractor, bisector and deque of cells.
+ *
+ * The owner pushes and pops cells at the back of the deque (depth-first search).
+ * Thieves take cells at the front (the oldest, i.e., largest, boxes).
+ */
+class ParallelSolver::Worker : public Thread {
+public:
+	Worker(ParallelSolver& solver, int num, unsigned long seed);
+
+	~Worker();
+
+	/* Push a cell at the back of the deque */
+	void push(Cell* c);
+
+	/* Pop a cell at the back of the deque (NULL if empty) */
+	Cell* pop();
+
+	/* Pop a cell at the front of the deque (NULL if empty) */
+	Cell* steal();
+
+	/* Delete all the cells in the deque */
+	void flush();
+
+	/* Solutions found by this worker */
+	vector<IntervalVector> sols;
+
+protected:
+	void run();
+
+	/* Contract, then bisect or store the cell as a solution. */
+	void process(Cell* c);
+
+	ParallelSolver& solver;
+	const int num;
+	Ctc& ctc;
+	Bsc& bsc;
+	deque<Cell*> cells;
+	Mutex mutex;
+	BitSet impact;
+};
+
+ParallelSolver::Worker::Worker(ParallelSolver& solver, int num, unsigned long seed) :
+		Thread(seed+num), solver(solver), num(num), ctc(solver.ctc[num]), bsc(solver.bsc[num]),
+		impact(BitSet::empty(solver.ctc[num].nb_var)) {
+
+}
+
+ParallelSolver::Worker::~Worker() {
+	flush();
+}
+
+void ParallelSolver::Worker::push(Cell* c) {
+	Lock l(mutex);
+	cells.push_back(c);
+}
+
+Cell* ParallelSolver::Worker::pop() {
+	Lock l(mutex);
+	if (cells.empty()) return NULL;
+	Cell* c=cells.back();
+	cells.pop_back();
+	return c;
+}
+
+Cell* ParallelSolver::Worker::steal() {
+	Lock l(mutex);
+	if (cells.empty()) return NULL;
+	Cell* c=cells.front();
+	cells.pop_front();
+	return c;
+}
+
+void ParallelSolver::Worker::flush() {
+	Lock l(mutex);
+	while (!cells.empty()) {
+		delete cells.back();
+		cells.pop_back();
+	}
+}
+
+void ParallelSolver::Worker::run() {
+	// the rounding mode is a per-thread setting
+	RoundUpScope round_up;
+
+	try {
+		while (!atomic_load(solver.stopped)) {
+
+			Cell* c=pop();
+
+			if (!c) {
+				c=solver.steal(num);
+				if (!c) {
+					if (atomic_load(solver.pending)==0) return; // the search is over
+					Thread::yield();
+					continue;
+				}
+			}
+
+			process(c);
+		}
+	} catch (...) {
+		// the exception is rethrown by solve(), once all the workers are stopped
+		solver.error.capture();
+		atomic_store(solver.stopped,true);
+	}
+}
+
+void ParallelSolver::Worker::process(Cell* c) {
+
+	int v=c->get<BisectedVar>().var;      // last bisected var.
+
+	if (v!=-1)                            // no root node :  impact set to 1 for last bisected var only
+		impact.add(v);
+	else                                  // root node : impact set to 1 for all variables
+		impact.fill(0,ctc.nb_var-1);
+
+	try {
+		ctc.contract(*c,impact);
+	} catch (...) {
+		impact.clear();
+		delete c;
+		throw;
+	}
+
+	if (v!=-1)
+		impact.remove(v);
+	else
+		impact.clear();
+
+	if (c->box.is_empty()) {
+		delete c;
+		atomic_add(solver.pending,-1L);
+		return;
+	}
+
+	try {
+		pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+		pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+		delete c;
+		c=NULL;
+
+		// the counter must be increased before the new cells are
+		// visible to thieves (otherwise it could transiently reach 0).
+		atomic_add(solver.pending,1L);
+		push(new_cells.first);
+		push(new_cells.second);
+
+		int n=atomic_add(solver.nb_cells,2);
+		if (solver.cell_limit >=0 && n>=solver.cell_limit) atomic_store(solver.stopped,true);
+	}
+	catch (NoBisectableVariableException&) {
+		sols.push_back(c->box);
+		if (solver.trace >=1) {
+			Lock l(solver.trace_mutex);
+			cout.precision(12);
+			cout << " sol (worker " << num << ") nb_cells " << solver.nb_cells << " " << c->box << endl;
+		}
+		delete c;
+		atomic_add(solver.pending,-1L);
+	}
+	catch (...) {
+		delete c;
+		throw;
+	}
+}
+
+ParallelSolver::ParallelSolver(const Array<Ctc>& ctc, const Array<Bsc>& bsc, unsigned long seed) :
+		ctc(ctc), bsc(bsc), nb_threads(ctc.size()), time_limit(-1), cell_limit(-1), trace(0),
+		nb_cells(0), nb_steals(0), time(0), pending(0), stopped(false) {
+
+	assert(ctc.size()>0);
+	assert(bsc.size()==ctc.size());
+
+	workers = new Worker*[nb_threads];
+	for (int i=0; i<nb_threads; i++)
+		workers[i] = new Worker(*this,i,seed);
+}
+
+ParallelSolver::~ParallelSolver() {
+	for (int i=0; i<nb_threads; i++)
+		delete workers[i];
+	delete[] workers;
+}
+
+Cell* ParallelSolver::steal(int thief) {
+	for (int i=1; i<nb_threads; i++) {
+		Cell* c=workers[(thief+i)%nb_threads]->steal();
+		if (c) {
+			atomic_add(nb_steals,1);
+			return c;
+		}
+	}
+	return NULL;
+}
+
+vector<IntervalVector> ParallelSolver::solve(const IntervalVector& init_box) {
+	// the rounding mode assumed by the interval arithmetic
+	RoundUpScope round_up;
+
+	assert(init_box.size()==ctc[0].nb_var);
+
+	nb_cells=0;
+	nb_steals=0;
+	atomic_store(stopped,false);
+
+	for (int i=0; i<nb_threads; i++) {
+		workers[i]->flush();
+		workers[i]->sols.clear();
+	}
+
+	Cell* root=new Cell(init_box);
+
+	// add data required by this solver
+	root->add<BisectedVar>();
+
+	// add data required by the contractors
+	ctc[0].add_backtrackable(*root);
+
+	// add data required by the bisectors
+	bsc[0].add_backtrackable(*root);
+
+	atomic_store(pending,1L);
+	workers[0]->push(root);
+
+	Timer timer(Timer::__REAL);
+	timer.start();
+
+	for (int i=0; i<nb_threads; i++)
+		workers[i]->start();
+
+	// The main thread acts as a watchdog for the time limit.
+	while (!atomic_load(stopped) && atomic_load(pending)>0) {
+		usleep(1000);
+		if (time_limit>0) {
+			if (timer.get_time()>=time_limit) {
+				atomic_store(stopped,true);
+				cout << "time limit " << time_limit << "s. reached " << endl;
+			}
+		}
+	}
+
+	for (int i=0; i<nb_threads; i++)
+		workers[i]->join();
+
+	timer.stop();
+	time+=timer.get_time();
+
+	if (cell_limit>=0 && nb_cells>=cell_limit)
+		cout << "cell limit " << cell_limit << " reached " << endl;
+
+	// in case the search was interrupted
+	for (int i=0; i<nb_threads; i++)
+		workers[i]->flush();
+
+	// an exception raised by a worker
+	error.rethrow();
+
+	vector<IntervalVector> sols;
+	for (int i=0; i<nb_threads; i++)
+		sols.insert(sols.end(), workers[i]->sols.begin(), workers[i]->sols.end());
+
+	return sols;
+}
+
+} // end namespace ibex
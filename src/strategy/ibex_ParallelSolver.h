@@ -0,0 +1,141 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SOLVER_H__
+#define __IBEX_PARALLEL_SOLVER_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Bsc.h"
+#include "ibex_Array.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded solver.
+ *
+ * This class implements the same branch and prune algorithm as #ibex::Solver but
+ * the search tree is explored by several threads (workers).
+ *
+ * Each worker owns a private deque of cells that it explores in depth-first order
+ * (like a #ibex::CellStack). When its deque gets empty, a worker steals a cell from
+ * the opposite end of the deque of another worker, i.e., one of the largest pending
+ * boxes (work stealing).
+ *
+ * Each worker also owns its contractor and its bisector. Since contractors and bisectors
+ * usually hold mutable data (for instance, the evaluators of a #ibex::Function), the objects
+ * given to different workers must not share any mutable data. Typically, one builds
+ * a copy of the system for each worker and the contractor/bisector of the worker on
+ * top of this copy.
+ *
+ * The set of solutions is the same as the one obtained with #ibex::Solver (with a
+ * depth-first buffer), provided that the contractors do not depend on the history of
+ * the search. The order in which solutions are returned is not specified.
+ */
+class ParallelSolver {
+public:
+	/**
+	 * \brief Build a parallel solver.
+	 *
+	 * \param ctc - the contractors: ctc[i] is the contractor of the ith worker.
+	 * \param bsc - the bisectors: bsc[i] is the bisector of the ith worker.
+	 *
+	 * \param seed - the random number generator of the ith worker is seeded with seed+i
+	 *                (see #ibex::Thread).
+	 *
+	 * The number of workers (threads) is the size of the arrays.
+	 * All the contractors (resp. bisectors) must require the same backtrackable data
+	 * (see #ibex::Ctc::add_backtrackable(Cell&) and #ibex::Bsc::add_backtrackable(Cell&)).
+	 */
+	ParallelSolver(const Array<Ctc>& ctc, const Array<Bsc>& bsc, unsigned long seed=1);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ParallelSolver();
+
+	/**
+	 * \brief Solve the system.
+	 *
+	 * \param init_box - the initial box (the search space)
+	 *
+	 * Return: the vector of solutions (small boxes with the required precision) found by the solver.
+	 */
+	std::vector<IntervalVector> solve(const IntervalVector& init_box);
+
+	/** Contractors (one for each worker). */
+	Array<Ctc> ctc;
+
+	/** Bisectors (one for each worker). */
+	Array<Bsc> bsc;
+
+	/** Number of workers (threads). */
+	const int nb_threads;
+
+	/** Maximum (wall-clock) time used by the solver.
+	 * The value can be fixed by the user. By default, it is -1 (no limit). */
+	double time_limit;
+
+	/** Maximal number of cells created by the solver.
+	 * The value can be fixed by the user. By default, it is -1 (no limit). */
+	long cell_limit;
+
+	/**
+	 * \brief Trace level
+	 *
+	 *  0  : no trace  (default value)
+	 *  1  : the solutions are printed each time a new solution is found
+	 */
+	int trace;
+
+	/** Number of nodes in the search tree (for the last exploration). */
+	int nb_cells;
+
+	/** Number of cells stolen by workers (for the last exploration). */
+	int nb_steals;
+
+	/** Running time of the last exploration (wall-clock) */
+	double time;
+
+protected:
+	class Worker;
+	friend class Worker;
+
+	/**
+	 * \brief Steal a cell from a worker other than \a thief.
+	 *
+	 * Return NULL if all the deques are empty.
+	 */
+	Cell* steal(int thief);
+
+	/* The workers */
+	Worker** workers;
+
+	/* Number of cells either stored in a deque or being processed
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile long pending;
+
+	/* Set to true to stop all the workers
+	 * (only accessed with atomic operations, see ibex_Thread.h) */
+	volatile bool stopped;
+
+	/* The first exception raised by a worker */
+	ThreadError error;
+
+	/* For printing traces */
+	Mutex trace_mutex;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_SOLVER_H__
@@ -16,12 +16,12 @@ using namespace std;
 namespace ibex {
 
 Paver::Paver(const Array<Ctc>& c, Bsc& b, CellBuffer& buffer) :
-		capacity(-1), ctc_loop(true), ctc(c), bsc(b), buffer(buffer) {
+		capacity(-1), timeout(1e08), ctc_loop(true), trace(false), ctc(c), bsc(b), buffer(buffer), nb_boxes(0) {
 
 	assert(ctc.size()>0);
 }
 
-void Paver::contract(Cell& cell, SubPaving* paving) {
+void Paver::contract(Cell& cell, Array<BoxSink>& sinks) {
 	int i=0; // contractor number
 
 	int n=ctc.size(); // number of contractors
@@ -46,18 +46,20 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 		if (trace)  cout << "    ctc " << i;
 		tmpbox=cell.box;
 
-		ctc[i].contract(cell.box);
+		ctc[i].contract(cell);
 
 		if (cell.box.is_empty()) {
 			if (trace) cout << " -> empty set" << endl;
-			paving[i].add(tmpbox);
+			sinks[i].add(tmpbox);
+			nb_boxes++;
 			return;
 		}
 
 		if (tmpbox.rel_distance(cell.box)>0) {
 			fix_count=0;
 
-			paving[i].add(tmpbox,cell.box);
+			sinks[i].add(tmpbox,cell.box);
+			nb_boxes++;
 
 			if (trace) cout << " -> contracts" << endl;
 
@@ -85,44 +87,65 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 
 	SubPaving* paving=new SubPaving[ctc.size()];
 
+	Array<BoxSink> sinks(ctc.size());
+	for (int i=0; i<ctc.size(); i++)
+		sinks.set_ref(i,paving[i]);
+
+	pave(init_box, sinks);
+
+	return paving;
+}
+
+void Paver::pave(const IntervalVector& init_box, Array<BoxSink>& sinks) {
+
+	assert(sinks.size()==ctc.size());
+
+	// the rounding mode assumed by the interval arithmetic
+	RoundUpScope round_up;
+
+	nb_boxes=0;
+
 	buffer.flush();
 
-	Cell* root=new Cell(init_box);
+	// give the memory of the previous paving back
+	pool.release();
+
+	Cell* root=pool.new_cell(init_box);
 
 	// add data required by the contractors
-//	for (int i=0; i<ctc.size(); i++) {
-//		ctc[i].init_root(*root);
-//	}
+	for (int i=0; i<ctc.size(); i++) {
+		ctc[i].add_backtrackable(*root);
+	}
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
 	buffer.push(root);
 
+	Timer timer;
+	timer.start();
+
 	while (!buffer.empty()) {
 		Cell* c=buffer.top();
 
 		if (trace) cout << buffer << endl;
 
-		contract(*c, paving);
+		contract(*c, sinks);
 
-		Timer::check(timeout);
-		check_capacity(paving);
+		timer.check(timeout);
+		check_capacity();
 
 		if (c->box.is_empty()) delete buffer.pop();
 		else bisect(*c);
 	}
 
-	return paving;
+	pool.release();
 }
 
 
-void Paver::check_capacity(SubPaving* paving) {
+void Paver::check_capacity() {
 	if (capacity==-1) return;
 
-	int size=0;
-	for (int i=0; i<ctc.size(); i++) size+=paving[i].size();
-
-	if (size>capacity) throw CapacityException();
+	if (nb_boxes>capacity) throw CapacityException();
 }
 
 } // end namespace ibex
@@ -15,7 +15,9 @@
 #include "ibex_Ctc.h"
 #include "ibex_Bsc.h"
 #include "ibex_CellBuffer.h"
+#include "ibex_CellPool.h"
 #include "ibex_SubPaving.h"
+#include "ibex_BoxSink.h"
 
 namespace ibex {
 
@@ -51,6 +53,18 @@ public:
 	 */
 	SubPaving* pave(const IntervalVector& init_box);
 
+	/**
+	 * \brief Run the paver (streaming mode).
+	 *
+	 * The trace of each contraction made by the ith contractor is given
+	 * to sinks[i] (see #ibex::BoxSink::add(const IntervalVector&, const IntervalVector&))
+	 * as soon as the contraction is made. A box entirely removed by the ith
+	 * contractor is given to sinks[i] with #ibex::BoxSink::add(const IntervalVector&).
+	 *
+	 * \pre sinks.size() is the number of contractors.
+	 */
+	void pave(const IntervalVector& init_box, Array<BoxSink>& sinks);
+
 	/*----------------------------------------------------------------------------------*/
 	/*                                        PARAMETERS                                */
 	/*----------------------------------------------------------------------------------*/
@@ -70,7 +84,7 @@ public:
 	 *
 	 * Maximum cpu time used by the strategy.
 	 * This parameter allows to bound time complexity.
-	 * The value can be fixed by the user.
+	 * The value can be fixed by the user. By default: 1e08.
 	 */
 	double timeout;
 
@@ -100,28 +114,32 @@ public:
 	/** Cell buffer. */
 	CellBuffer& buffer;
 
+	/** Memory pool of the cells. */
+	CellPool pool;
+
 protected:
 
 	/**
 	 * \brief Calls all the contractors until the fix-point is reached.
 	 *
-	 * Contracted parts are put into the paving in argument.
-	 *
-	 * \return the contractor number that entirely emptied the box, if any.
-	 * Otherwise, return -1 (the box is non empty and the fixpoint is reached).
+	 * Contracted parts are given to the sinks in argument.
 	 */
-	void contract(Cell& c, SubPaving*);
+	void contract(Cell& c, Array<BoxSink>& sinks);
 
 	/**
-	 * \brief Check the number of boxes stored in the paving.
+	 * \brief Check the number of boxes given to the sinks.
 	 */
-	void check_capacity(SubPaving*);
+	void check_capacity();
 
 	/**
 	 * \brief Bisect the cell and push the two subcells into the buffer.
 	 */
 	void bisect(Cell& c);
 
+	/**
+	 * \brief Number of boxes (or traces) given to the sinks.
+	 */
+	long nb_boxes;
 };
 
 
@@ -10,43 +10,96 @@
 
 #include "ibex_Solver.h"
 #include "ibex_NoBisectableVariableException.h"
+#include "ibex_CtcProfile.h"
 #include <cassert>
 
 using namespace std;
 
 namespace ibex {
 
-Solver::Solver(Ctc& ctc, Bsc& bsc, CellBuffer& buffer) :
-		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), time(0), impact(BitSet::all(ctc.nb_var)) {
+namespace {
 
-	nb_cells=0;
+// identifies the solver in a checkpoint file
+const int CHECKPOINT_TAG=1;
+
+/* Times a scope: the time elapsed until the scope is left,
+ * whatever the way, is added to "total". */
+class TimerScope {
+public:
+	TimerScope(Timer& timer, double& total) : timer(timer), total(total) {
+		timer.start();
+	}
+
+	~TimerScope() {
+		timer.stop();
+		total+=timer.get_time();
+	}
+
+private:
+	TimerScope(const TimerScope&); // forbidden
+	Timer& timer;
+	double& total;
+};
 
 }
 
-void Solver::start(const IntervalVector& init_box) {
-	buffer.flush();
+Solver::Solver(Ctc& ctc, Bsc& bsc, CellBuffer& buffer) :
+		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0),
+		  checkpoint_file(NULL), checkpoint_period(600), profile_file(NULL), time(0), impact(BitSet::all(ctc.nb_var)) {
 
-	assert(init_box.size()==ctc.nb_var);
+	nb_cells=0;
+	nb_sols=0;
+	last_checkpoint=0;
 
-	Cell* root=new Cell(init_box);
+}
+
+Cell* Solver::root_cell(const IntervalVector& box) {
+	Cell* root=pool.new_cell(box);
 
 	// add data required by this solver
 	root->add<BisectedVar>();
 
+	// add data required by the contractor
+	ctc.add_backtrackable(*root);
+
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
-	buffer.push(root);
+	return root;
+}
+
+void Solver::start(const IntervalVector& init_box) {
+	// the rounding mode assumed by the interval arithmetic
+	RoundUpScope round_up;
+
+	buffer.flush();
 
-	int nb_var=init_box.size();
+	// give the memory of the previous search back
+	pool.release();
 
-	IntervalVector tmpbox(ctc.nb_var);
+	assert(init_box.size()==ctc.nb_var);
 
-	Timer::start();
+	buffer.push(root_cell(init_box));
 
+	nb_sols=0;
+	last_checkpoint=time;
 }
 
 bool Solver::next(std::vector<IntervalVector>& sols) {
+	VectorSink sink(sols);
+	return next(sink, sols);
+}
+
+bool Solver::next(BoxSink& sink) {
+	return next(sink, vector<IntervalVector>());
+}
+
+bool Solver::next(BoxSink& sink, const vector<IntervalVector>& sols) {
+	RoundUpScope round_up;
+
+	// the time of this call is added to "time" on every return
+	TimerScope timing(timer, time);
+
 	try  {
 		while (!buffer.empty()) {
 
@@ -61,7 +114,7 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 			else                                // root node : impact set to 1 for all variables
 				impact.fill(0,ctc.nb_var-1);
 
-			ctc.contract(c->box,impact);
+			ctc.contract(*c,impact);
 
 			if (c->box.is_empty()) {
 				delete buffer.pop();
@@ -87,8 +140,9 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 				if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
 
 			catch (NoBisectableVariableException&) {
-				new_sol(sols, c->box);
+				new_sol(sink, c->box);
 				delete buffer.pop();
+				if (buffer.empty()) background.wait();
 				return !buffer.empty();
 				// note that we skip time_limit_check() here.
 				// In the case where "next" is called by "solve",
@@ -99,42 +153,122 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 				// an error case).
 			}
 			time_limit_check();
+			checkpoint(sols);
 		}
 	}
 	catch (TimeOutException&) {
-		cout << "time limit " << time_limit << "s. reached " << endl; return false;
+		if (trace>=0) cout << "time limit " << time_limit << "s. reached " << endl;
+		background.wait();
+		return false;
 	}
 	catch (CellLimitException&) {
-		cout << "cell limit " << cell_limit << " reached " << endl;
+		if (trace>=0) cout << "cell limit " << cell_limit << " reached " << endl;
 	}
 
-	Timer::stop();
-	time+= Timer::VIRTUAL_TIMELAPSE();
+	background.wait();
+
+	if (buffer.empty()) pool.release();
 
 	return false;
 
 }
 
 vector<IntervalVector> Solver::solve(const IntervalVector& init_box) {
+	// the rounding mode is set once for the whole search
+	RoundUpScope round_up;
 	vector<IntervalVector> sols;
 	start(init_box);
 	while (next(sols)) { }
+	if (profile_file) CtcProfile::report(profile_file);
 	return sols;
 }
 
+void Solver::solve(const IntervalVector& init_box, BoxSink& sink) {
+	// the rounding mode is set once for the whole search
+	RoundUpScope round_up;
+	start(init_box);
+	while (next(sink)) { }
+	if (profile_file) CtcProfile::report(profile_file);
+}
+
 void Solver::time_limit_check () {
-	Timer::stop();
-	time += Timer::VIRTUAL_TIMELAPSE();
-	if (time_limit >0 &&  time >=time_limit) throw TimeOutException();
-	Timer::start();
+	// note: the clock is also read for the checkpoints
+	timer.check(time_limit>0? time_limit-time : POS_INFINITY);
+}
+
+
+void Solver::checkpoint(const vector<IntervalVector>& sols) {
+	if (!checkpoint_file) return;
+
+	// the next checkpoint is delayed until the previous one is written
+	if (!background.busy() && time+timer.last_time()>=last_checkpoint+checkpoint_period) {
+		// add the time elapsed so far
+		timer.stop();
+		time+=timer.get_time();
+		timer.start();
+		if (background.begin(buffer)) {
+			try {
+				save(checkpoint_file, sols);
+			} catch (...) {
+				// the child process exits here
+				background.end(false);
+				throw;
+			}
+			background.end(true);
+		}
+		last_checkpoint=time;
+	}
 }
 
+void Solver::save(const char* filename, const vector<IntervalVector>& sols) {
+	// the background checkpoint writes the same temporary file
+	background.wait();
+
+	CheckpointWriter ck(filename, CHECKPOINT_TAG);
+	ck.write(ctc.nb_var);
+	ck.write(nb_cells);
+	ck.write(time);
+	ck.write(sols);
+	ck.write(buffer);
+	ck.close();
+}
+
+void Solver::resume(const char* filename, vector<IntervalVector>& sols) {
+	CheckpointReader ck(filename, CHECKPOINT_TAG);
+	if (ck.read_int()!=ctc.nb_var) throw CheckpointException();
+	int nb_cells=ck.read_int();
+	double time=ck.read_double();
+	vector<IntervalVector> saved_sols;
+	ck.read(saved_sols);
+
+	buffer.flush();
+
+	// give the memory of the previous search back
+	pool.release();
+
+	Cell* root=root_cell(IntervalVector(ctc.nb_var));
+	try {
+		ck.read(buffer, *root);
+	} catch (CheckpointException&) {
+		delete root;
+		buffer.flush();
+		throw;
+	}
+	delete root;
+
+	sols.insert(sols.end(), saved_sols.begin(), saved_sols.end());
+	nb_sols=saved_sols.size();
+	this->nb_cells=nb_cells;
+	this->time=time;
+	last_checkpoint=time;
+}
 
-void Solver::new_sol (vector<IntervalVector> & sols, IntervalVector & box) {
-	sols.push_back(box);
+void Solver::new_sol (BoxSink& sink, IntervalVector & box) {
+	sink.add(box);
+	nb_sols++;
 	cout.precision(12);
 	if (trace >=1)
-		cout << " sol " << sols.size() << " nb_cells " <<  nb_cells << " "  << sols[sols.size()-1] <<   endl;
+		cout << " sol " << nb_sols << " nb_cells " <<  nb_cells << " "  << box <<   endl;
 }
 
 } // end namespace ibex
@@ -15,6 +15,9 @@
 #include "ibex_Pdc.h"
 #include "ibex_Bsc.h"
 #include "ibex_CellBuffer.h"
+#include "ibex_CellPool.h"
+#include "ibex_Checkpoint.h"
+#include "ibex_BoxSink.h"
 #include "ibex_SubPaving.h"
 #include "ibex_Timer.h"
 #include "ibex_Exception.h"
@@ -54,6 +57,15 @@ public:
 	 */
 	std::vector<IntervalVector> solve(const IntervalVector& init_box);
 
+	/**
+	 * \brief Solve the system (non-interactive mode).
+	 *
+	 * \param init_box - the initial box (the search space)
+	 * \param sink     - receives each solution as soon as it is found
+	 *                   (see #ibex::BoxSink). The solutions are not stored by the solver.
+	 */
+	void solve(const IntervalVector& init_box, BoxSink& sink);
+
 	/**
 	 * \brief Start solving (interactive mode).
 	 *
@@ -69,6 +81,39 @@ public:
 	 */
 	bool next(std::vector<IntervalVector>& sols);
 
+	/**
+	 * \brief Continue solving (interactive mode).
+	 *
+	 * Look for the next solution and give it to the sink.
+	 * \return false if the search is over (true otherwise).
+	 *
+	 * \note The solutions given to the sink are not saved in
+	 * the checkpoints (see #checkpoint_file).
+	 */
+	bool next(BoxSink& sink);
+
+	/**
+	 * \brief Save the current state of the search (interactive mode).
+	 *
+	 * The cells of the buffer (with their data), the solutions \a sols
+	 * found so far, #nb_cells and #time are written into a file (see #ibex::CheckpointWriter).
+	 *
+	 * \throw CheckpointException if the file cannot be written.
+	 */
+	void save(const char* filename, const std::vector<IntervalVector>& sols);
+
+	/**
+	 * \brief Resume a search saved by #save(const char*, const std::vector<IntervalVector>&).
+	 *
+	 * Replaces #start(const IntervalVector&): the solutions found before the checkpoint
+	 * are pushed into \a sols and the search can be continued with #next(std::vector<IntervalVector>&).
+	 * The solver must be built with the same contractor, bisector and kind of buffer as the
+	 * one that saved the search.
+	 *
+	 * \throw CheckpointException if the file cannot be read.
+	 */
+	void resume(const char* filename, std::vector<IntervalVector>& sols);
+
 
 	/**
 	 * \brief  The contractor 
@@ -101,12 +146,44 @@ public:
 	 * \brief Trace level
 	 *
 	 *  the trace level. 
+	 *  -1 : nothing is printed, not even when the time or cell limit is reached
 	 *  0  : no trace  (default value)
 	 *  1   the solutions are printed each time a new solution is found
 	 *  2   the solutions are printed each time a new solution is found and the current box is printed at each node of the branch and prune algorithm 
 	 */
 	int trace;
 
+	/**
+	 * \brief Checkpoint file.
+	 *
+	 * If not NULL, the search is periodically saved into this file
+	 * (see #save(const char*, const std::vector<IntervalVector>&)). By default, it is NULL.
+	 *
+	 * The file is written in the background by a child process (see #ibex::BackgroundCheckpoint):
+	 * the search is only paused for the fork. It is written synchronously (the search
+	 * is stopped during the whole dump) on Windows, if the process cannot be forked or
+	 * while threads are running (fork is not safe then). The search waits for the last checkpoint before it ends.
+	 */
+	const char* checkpoint_file;
+
+	/**
+	 * \brief Cpu time between two checkpoints.
+	 *
+	 * A checkpoint is not started before the previous one is written.
+	 *
+	 * By default: 600s.
+	 */
+	double checkpoint_period;
+
+	/**
+	 * \brief Profiling file.
+	 *
+	 * If not NULL, the statistics of the profiled contractors (see #ibex::CtcProfile)
+	 * are written into this file at the end of #solve(const IntervalVector&).
+	 * By default, it is NULL.
+	 */
+	const char* profile_file;
+
 	/** Number of nodes  in the search tree */
 	int nb_cells;
 
@@ -114,11 +191,40 @@ public:
 	/** Remember running time of the last exploration */
 	double time;
 
+	/**
+	 * \brief Memory pool of the cells.
+	 *
+	 * The number of allocations avoided is given by pool.nb_avoided().
+	 */
+	CellPool pool;
+
 protected :
 
 	void time_limit_check();
 
-	void new_sol(std::vector<IntervalVector> & sols, IntervalVector & box);
+	/* Create the root cell with all the required data */
+	Cell* root_cell(const IntervalVector& box);
+
+	/* Save the search into the checkpoint file, if the period has elapsed */
+	void checkpoint(const std::vector<IntervalVector>& sols);
+
+	/* Time of the last checkpoint */
+	double last_checkpoint;
+
+	/* Writes the checkpoints */
+	BackgroundCheckpoint background;
+
+	/* Time of the current call to next() */
+	Timer timer;
+
+	/* Look for the next solution. The solutions found so far
+	 * (written in the checkpoints) are in sols. */
+	bool next(BoxSink& sink, const std::vector<IntervalVector>& sols);
+
+	void new_sol(BoxSink& sink, IntervalVector & box);
+
+	/* Number of solutions found so far */
+	int nb_sols;
 
 	BitSet impact;
 
@@ -15,14 +15,17 @@
 #include <vector>
 
 #include "ibex_IntervalVector.h"
+#include "ibex_BoxSink.h"
 
 namespace ibex {
 
 /** \ingroup strategy
  *
  * \brief Subpaving
+ *
+ * A sink that stores all the traces in memory.
  */
-class SubPaving {
+class SubPaving : public BoxSink {
 public:
 	/**
 	 * \brief Add the trace of a contraction into *this.
@@ -10,6 +10,7 @@
 
 #include "ibex_ExprDiff.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprHashCons.h"
 #include "ibex_ExprSubNodes.h"
 #include "ibex_Expr.h"
 
@@ -200,15 +201,17 @@ const ExprNode& ExprDiff::gradient(const Array<const ExprSymbol>& old_x, const A
 	const ExprNode& df=dX.size()==1? dX[0] : ExprVector::new_(dX,true);
 
 	// Note: it is better to proceed in this way: (1) differentiate
-	// and (2) copy the expression for two reasons
+	// and (2) copy the expression for three reasons
 	// 1-we can eliminate the constant expressions such as (1*1)
 	//   generated by the differentiation
 	// 2-the "dead" branches corresponding to the partial derivative
 	//   w.r.t. ExprConstant leaves will be deleted properly (if
 	//   we had proceeded in the other way around, there would be
 	//   memory leaks).
+	// 3-the subexpressions that appear in several partial derivatives
+	//   are shared (see ExprHashCons).
 
-	const ExprNode& result=ExprCopy().copy(old_x,new_x,df,true);
+	const ExprNode& result=ExprHashCons().copy(old_x,new_x,df,true);
 
 	// ------------------------- CLEANUP -------------------------
 	// cleanup(df,true); // don't! some nodes are shared with y
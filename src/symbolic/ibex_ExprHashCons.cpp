@@ -0,0 +1,433 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprHashCons.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ExprHashCons.h"
+#include "ibex_Function.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+template<class T>
+const ExprNode& build_unary(const ExprNode&, const Array<const ExprNode>& args) {
+	return T::new_(args[0]);
+}
+
+template<class T>
+const ExprNode& build_binary(const ExprNode&, const Array<const ExprNode>& args) {
+	return T::new_(args[0],args[1]);
+}
+
+const ExprNode& build_index(const ExprNode& model, const Array<const ExprNode>& args) {
+	return args[0][((const ExprIndex&) model).index];
+}
+
+const ExprNode& build_vector(const ExprNode& model, const Array<const ExprNode>& args) {
+	return ExprVector::new_(args,((const ExprVector&) model).row_vector());
+}
+
+const ExprNode& build_apply(const ExprNode& model, const Array<const ExprNode>& args) {
+	return ExprApply::new_(((const ExprApply&) model).func,args);
+}
+
+const ExprNode& build_chi(const ExprNode&, const Array<const ExprNode>& args) {
+	return ExprChi::new_(args);
+}
+
+const ExprNode& build_power(const ExprNode& model, const Array<const ExprNode>& args) {
+	return ExprPower::new_(args[0],((const ExprPower&) model).expon);
+}
+
+}
+
+bool ExprHashCons::Key::operator<(const Key& k) const {
+	if (type!=k.type) return type->before(*k.type);
+	if (func!=k.func) return std::less<const void*>()(func,k.func);
+	if (extra!=k.extra) return extra<k.extra;
+	return args<k.args;
+}
+
+const ExprNode& ExprHashCons::copy(const Array<const ExprSymbol>& old_x, const Array<const ExprNode>& new_x, const ExprNode& y, bool absorb_zero) {
+
+	assert(new_x.size()>=old_x.size());
+
+	this->absorb_zero=absorb_zero;
+
+	for (int i=0; i<old_x.size(); i++) {
+		term.insert(old_x[i],leaf(new_x[i]));
+	}
+
+	visit(y);
+
+	// build the nodes of the terms the result depends on
+	nodes.assign(terms.size(),(const ExprNode*) NULL);
+	const ExprNode& result=node(term[y]);
+
+	for (vector<Term>::iterator it=terms.begin(); it!=terms.end(); it++)
+		if (it->value) delete it->value;
+
+	terms.clear();
+	term.clean();
+	table.clear();
+	scalars.clear();
+	nodes.clear();
+
+	return result;
+}
+
+int ExprHashCons::leaf(const ExprNode& x) {
+	Term t;
+	t.leaf=&x;
+	t.value=NULL;
+	t.model=NULL;
+	t.build=NULL;
+	terms.push_back(t);
+	return terms.size()-1;
+}
+
+int ExprHashCons::cst(const Domain& d) {
+	bool scalar=d.dim.is_scalar() && !d.i().is_empty();
+
+	if (scalar) {
+		map<pair<double,double>,int>::const_iterator it=scalars.find(make_pair(d.i().lb(),d.i().ub()));
+		if (it!=scalars.end()) return it->second;
+	}
+
+	Term t;
+	t.leaf=NULL;
+	t.value=new Domain(d);
+	t.model=NULL;
+	t.build=NULL;
+	terms.push_back(t);
+
+	if (scalar) scalars.insert(make_pair(make_pair(d.i().lb(),d.i().ub()),(int) terms.size()-1));
+
+	return terms.size()-1;
+}
+
+int ExprHashCons::op(const ExprNode& model, Builder build, const vector<int>& args, int extra, const void* func) {
+	Key k;
+	k.type=&typeid(model);
+	k.func=func;
+	k.extra=extra;
+	k.args=args;
+
+	map<Key,int>::const_iterator it=table.find(k);
+	if (it!=table.end()) return it->second;
+
+	Term t;
+	t.leaf=NULL;
+	t.value=NULL;
+	t.model=&model;
+	t.build=build;
+	t.args=args;
+	terms.push_back(t);
+
+	table.insert(make_pair(k,(int) terms.size()-1));
+	return terms.size()-1;
+}
+
+bool ExprHashCons::is_zero(int t) const {
+	const Domain* d=terms[t].value;
+	if (!d) return false;
+	switch(d->dim.type()) {
+	case Dim::SCALAR:     return d->i()==Interval::ZERO;
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: return d->v().is_zero();
+	case Dim::MATRIX:     return d->m().is_zero();
+	default:              return false;
+	}
+}
+
+bool ExprHashCons::is_leaf(int t) const {
+	return terms[t].value || dynamic_cast<const ExprLeaf*>(terms[t].leaf);
+}
+
+bool ExprHashCons::is_one(int t) const {
+	const Domain* d=terms[t].value;
+	return d && d->dim.is_scalar() && d->i()==Interval::ONE;
+}
+
+const ExprNode& ExprHashCons::node(int t) {
+	if (nodes[t]) return *nodes[t];
+
+	const Term& x=terms[t];
+
+	if (x.leaf)
+		nodes[t]=x.leaf;
+	else if (x.value)
+		nodes[t]=&ExprConstant::new_(*x.value);
+	else {
+		Array<const ExprNode> args(x.args.size());
+		for (unsigned int i=0; i<x.args.size(); i++)
+			args.set_ref(i,node(x.args[i]));
+		nodes[t]=&x.build(*x.model,args);
+	}
+	return *nodes[t];
+}
+
+void ExprHashCons::visit(const ExprNode& e) {
+	if (!term.found(e)) {
+		e.acceptVisitor(*this);
+	}
+}
+
+void ExprHashCons::visit(const ExprIndex& e) {
+	visit(e.expr);
+	int a=term[e.expr];
+
+	if (is_cst(a)) {
+		term.insert(e,cst((*terms[a].value)[e.index]));
+		return;
+	}
+
+	// (x_1,...,x_n)[i] -> x_i (unless the vector is a concatenation
+	// or the other components may be undefined, see #copy())
+	const ExprVector* vec=dynamic_cast<const ExprVector*>(terms[a].model);
+	if (vec) {
+		int i=0;
+		for (; i<vec->nb_args; i++) {
+			if (vec->arg(i).dim!=e.dim) break;
+			if (!absorb_zero && i!=e.index && !is_leaf(terms[a].args[i])) break;
+		}
+		if (i==vec->nb_args) {
+			term.insert(e,terms[a].args[e.index]);
+			return;
+		}
+	}
+
+	term.insert(e,op(e,build_index,vector<int>(1,a),e.index));
+}
+
+void ExprHashCons::visit(const ExprSymbol& x) {
+	// a symbol that does not belong to "old_x" is kept
+	term.insert(x,leaf(x));
+}
+
+void ExprHashCons::visit(const ExprConstant& c) {
+	term.insert(c,cst(c.get()));
+}
+
+// (useless so far)
+void ExprHashCons::visit(const ExprNAryOp& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprHashCons::visit(const ExprLeaf& e) {
+	e.acceptVisitor(*this);
+}
+
+// (useless so far)
+void ExprHashCons::visit(const ExprBinaryOp& b) {
+	b.acceptVisitor(*this);
+}
+
+// (useless so far)
+void ExprHashCons::visit(const ExprUnaryOp& u) {
+	u.acceptVisitor(*this);
+}
+
+#define VALUE(i) (*terms[args[i]].value)
+
+void ExprHashCons::visit(const ExprVector& e) {
+	vector<int> args(e.nb_args);
+	bool cst_args=true;
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		args[i]=term[e.arg(i)];
+		cst_args &= is_cst(args[i]);
+	}
+
+	if (cst_args) {
+		if (e.dim.is_vector()) {
+			IntervalVector v(e.dim.vec_size());
+			int k=0;
+			for (int i=0; i<e.nb_args; i++) {
+				if (VALUE(i).dim.is_scalar())
+					v[k++]=VALUE(i).i();
+				else {
+					v.put(k,VALUE(i).v());
+					k+=VALUE(i).dim.vec_size();
+				}
+			}
+			term.insert(e,cst(Domain(v,e.row_vector())));
+			return;
+		} else if (e.dim.type()==Dim::MATRIX && e.nb_args==e.dim.dim2 && e.arg(0).dim.type()==Dim::ROW_VECTOR) {
+			// (the rows of the matrix)
+			IntervalMatrix m(e.dim.dim2,e.dim.dim3);
+			for (int i=0; i<e.nb_args; i++) {
+				m.set_row(i,VALUE(i).v());
+			}
+			term.insert(e,cst(Domain(m)));
+			return;
+		}
+		// otherwise: not folded
+	}
+
+	term.insert(e,op(e,build_vector,args,e.row_vector()));
+}
+
+void ExprHashCons::visit(const ExprApply& e) {
+	vector<int> args(e.nb_args);
+	bool cst_args=true;
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		args[i]=term[e.arg(i)];
+		cst_args &= is_cst(args[i]);
+	}
+
+	if (cst_args) {
+		Array<const Domain> d(e.nb_args);
+		for (int i=0; i<e.nb_args; i++) {
+			d.set_ref(i,VALUE(i));
+		}
+		term.insert(e,cst(e.func.basic_evaluator().eval(d)));
+		return;
+	}
+
+	term.insert(e,op(e,build_apply,args,0,&e.func));
+}
+
+void ExprHashCons::visit(const ExprChi& e) {
+	vector<int> args(e.nb_args);
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		args[i]=term[e.arg(i)];
+	}
+	term.insert(e,op(e,build_chi,args));
+}
+
+#undef VALUE
+
+int ExprHashCons::simplify(const ExprBinaryOp& e, int a, int b) {
+
+	if (dynamic_cast<const ExprAdd*>(&e)) {
+		if (is_zero(a) && e.dim==e.right.dim) return b;
+		if (is_zero(b) && e.dim==e.left.dim) return a;
+	}
+	else if (dynamic_cast<const ExprSub*>(&e)) {
+		if (is_zero(b) && e.dim==e.left.dim) return a;
+	}
+	else if (dynamic_cast<const ExprMul*>(&e)) {
+		if (absorb_zero && (is_zero(a) || is_zero(b))) {
+			Domain zero(e.dim);
+			zero.clear();
+			return cst(zero);
+		}
+		if (is_one(a) && e.dim==e.right.dim) return b;
+		if (is_one(b) && e.dim==e.left.dim) return a;
+	}
+	else if (dynamic_cast<const ExprDiv*>(&e)) {
+		if (is_one(b) && e.dim==e.left.dim) return a;
+	}
+	return -1;
+}
+
+template<class T>
+void ExprHashCons::visit_binary(const T& e, Domain (*fcst)(const Domain&, const Domain&)) {
+	visit(e.left);
+	visit(e.right);
+	int a=term[e.left];
+	int b=term[e.right];
+
+	if (is_cst(a) && is_cst(b)) {
+		/* evaluate the constant expression on-the-fly */
+		term.insert(e,cst(fcst(*terms[a].value,*terms[b].value)));
+		return;
+	}
+
+	int t=simplify(e,a,b);
+
+	if (t==-1) {
+		vector<int> args(2);
+		args[0]=a;
+		args[1]=b;
+		t=op(e,build_binary<T>,args);
+	}
+
+	term.insert(e,t);
+}
+
+template<class T>
+void ExprHashCons::visit_unary(const T& e, Domain (*fcst)(const Domain&)) {
+	visit(e.expr);
+	int a=term[e.expr];
+
+	if (is_cst(a)) {
+		/* evaluate the constant expression on-the-fly */
+		term.insert(e,cst(fcst(*terms[a].value)));
+		return;
+	}
+
+	term.insert(e,op(e,build_unary<T>,vector<int>(1,a)));
+}
+
+void ExprHashCons::visit(const ExprAdd& e)   { visit_binary(e,operator+); }
+void ExprHashCons::visit(const ExprMul& e)   { visit_binary(e,operator*); }
+void ExprHashCons::visit(const ExprSub& e)   { visit_binary(e,operator-); }
+void ExprHashCons::visit(const ExprDiv& e)   { visit_binary(e,operator/); }
+void ExprHashCons::visit(const ExprMax& e)   { visit_binary(e,max); }
+void ExprHashCons::visit(const ExprMin& e)   { visit_binary(e,min); }
+void ExprHashCons::visit(const ExprAtan2& e) { visit_binary(e,atan2); }
+
+void ExprHashCons::visit(const ExprMinus& e) {
+	visit(e.expr);
+	int a=term[e.expr];
+
+	// -(-x) -> x
+	if (dynamic_cast<const ExprMinus*>(terms[a].model)) {
+		term.insert(e,terms[a].args[0]);
+		return;
+	}
+
+	visit_unary(e,operator-);
+}
+
+void ExprHashCons::visit(const ExprPower& e) {
+	visit(e.expr);
+	int a=term[e.expr];
+
+	if (is_cst(a)) {
+		/* evaluate the constant expression on-the-fly */
+		term.insert(e,cst(pow(*terms[a].value,e.expon)));
+		return;
+	}
+
+	if (e.expon==1) {
+		term.insert(e,a);
+		return;
+	}
+
+	term.insert(e,op(e,build_power,vector<int>(1,a),e.expon));
+}
+
+void ExprHashCons::visit(const ExprTrans& e) { visit_unary(e,transpose); }
+void ExprHashCons::visit(const ExprSign& e)  { visit_unary(e,sign); }
+void ExprHashCons::visit(const ExprAbs& e)   { visit_unary(e,abs); }
+void ExprHashCons::visit(const ExprSqr& e)   { visit_unary(e,sqr); }
+void ExprHashCons::visit(const ExprSqrt& e)  { visit_unary(e,sqrt); }
+void ExprHashCons::visit(const ExprExp& e)   { visit_unary(e,exp); }
+void ExprHashCons::visit(const ExprLog& e)   { visit_unary(e,log); }
+void ExprHashCons::visit(const ExprCos& e)   { visit_unary(e,cos); }
+void ExprHashCons::visit(const ExprSin& e)   { visit_unary(e,sin); }
+void ExprHashCons::visit(const ExprTan& e)   { visit_unary(e,tan); }
+void ExprHashCons::visit(const ExprCosh& e)  { visit_unary(e,cosh); }
+void ExprHashCons::visit(const ExprSinh& e)  { visit_unary(e,sinh); }
+void ExprHashCons::visit(const ExprTanh& e)  { visit_unary(e,tanh); }
+void ExprHashCons::visit(const ExprAcos& e)  { visit_unary(e,acos); }
+void ExprHashCons::visit(const ExprAsin& e)  { visit_unary(e,asin); }
+void ExprHashCons::visit(const ExprAtan& e)  { visit_unary(e,atan); }
+void ExprHashCons::visit(const ExprAcosh& e) { visit_unary(e,acosh); }
+void ExprHashCons::visit(const ExprAsinh& e) { visit_unary(e,asinh); }
+void ExprHashCons::visit(const ExprAtanh& e) { visit_unary(e,atanh); }
+
+} // namespace ibex
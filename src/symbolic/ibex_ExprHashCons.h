@@ -0,0 +1,196 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprHashCons.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_HASH_CONS_H__
+#define __IBEX_EXPR_HASH_CONS_H__
+
+#include "ibex_ExprVisitor.h"
+#include "ibex_NodeMap.h"
+#include "ibex_Domain.h"
+
+#include <vector>
+#include <map>
+#include <typeinfo>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Duplicate an expression into a DAG without common subexpressions
+ *
+ * The nodes of the copy are "hash-consed": a node that is structurally identical
+ * to an already built one (same operator, same arguments) is not built twice, so
+ * that the copy is a DAG of minimal size (compare with #ibex::Expr2DAG, where
+ * the nodes are compared with each other after the copy).
+ *
+ * In addition, the constant subexpressions are folded and the following
+ * simplifications are applied:
+ * <ul>
+ * <li> x+0, 0+x, x-0, 1*x, x*1, x/1, x^1 and -(-x) are replaced by x
+ * <li> (x_1,...,x_n)[i] is replaced by x_i, only if the other components are symbols
+ *      or constants or if \a absorb_zero is set
+ * <li> 0*x and x*0 are replaced by 0, only if \a absorb_zero is set (see #copy()).
+ * </ul>
+ *
+ * The expression is first turned into a table of "terms" and nodes
+ * are only built for the terms the result depends on: no node is built
+ * for a subexpression eliminated by a simplification.
+ */
+class ExprHashCons : public virtual ExprVisitor {
+public:
+
+	/**
+	 * \brief Duplicate an expression (with new symbols).
+	 *
+	 * If \a absorb_zero is true, 0*x and x*0 are replaced by 0 and
+	 * (x_1,...,x_n)[i] by x_i whatever the other components are. This
+	 * is only valid if x (resp. the x_j) is defined everywhere, which is
+	 * the case of the terms generated by the differentiation (see
+	 * #ibex::ExprDiff) but not of a constraint in general: 0*sqrt(x)=0
+	 * has no solution with x<0.
+	 *
+	 * \see #ibex::ExprCopy::copy(const Array<const ExprSymbol>&, const Array<const ExprNode>&, const ExprNode&, bool).
+	 */
+	const ExprNode& copy(const Array<const ExprSymbol>& old_x, const Array<const ExprNode>& new_x, const ExprNode& y, bool absorb_zero=false);
+
+	/**
+	 * \brief Duplicate an expression (with new symbols).
+	 *
+	 * \see #copy(const Array<const ExprSymbol>&, const Array<const ExprNode>&, const ExprNode&, bool).
+	 */
+	const ExprNode& copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y, bool absorb_zero=false);
+
+protected:
+	/*
+	 * Build a node from the node of the original expression
+	 * with the same operator and the (new) arguments.
+	 */
+	typedef const ExprNode& (*Builder)(const ExprNode& model, const Array<const ExprNode>& args);
+
+	/*
+	 * A term of the copy. Either a leaf (symbol of the copy),
+	 * a constant, or an operator applied to other terms.
+	 */
+	struct Term {
+		const ExprNode* leaf;   // the leaf or NULL
+		Domain* value;          // the constant value or NULL
+		const ExprNode* model;  // a node with the same operator (original expression) or NULL
+		Builder build;
+		std::vector<int> args;  // the arguments
+	};
+
+	/*
+	 * Identifies an operator term.
+	 */
+	struct Key {
+		const std::type_info* type; // operator
+		const void* func;           // function called (ExprApply) or NULL
+		int extra;                  // exponent (ExprPower), index (ExprIndex), orientation (ExprVector)
+		std::vector<int> args;
+		bool operator<(const Key& k) const;
+	};
+
+	/* whether 0*x is replaced by 0 */
+	bool absorb_zero;
+
+	/* all the terms */
+	std::vector<Term> terms;
+
+	/* the term of each node of the original expression */
+	NodeMap<int> term;
+
+	/* the operator terms */
+	std::map<Key,int> table;
+
+	/* the (non-empty) scalar constants */
+	std::map<std::pair<double,double>,int> scalars;
+
+	/* the nodes built for the terms (NULL if not built) */
+	std::vector<const ExprNode*> nodes;
+
+	int leaf(const ExprNode& x);
+	int cst(const Domain& d);
+	int op(const ExprNode& model, Builder build, const std::vector<int>& args, int extra=0, const void* func=NULL);
+
+	bool is_cst(int t) const;
+	bool is_leaf(int t) const; // symbol or constant
+	bool is_zero(int t) const;
+	bool is_one(int t) const;
+
+	const ExprNode& node(int t);
+
+	void visit(const ExprNode& e);
+	void visit(const ExprIndex& i);
+	void visit(const ExprNAryOp& e);
+	void visit(const ExprLeaf& e);
+	void visit(const ExprBinaryOp& b);
+	void visit(const ExprUnaryOp& u);
+	void visit(const ExprSymbol& x);
+	void visit(const ExprConstant& c);
+	void visit(const ExprVector& e);
+	void visit(const ExprApply& e);
+	void visit(const ExprChi& e);
+	void visit(const ExprAdd& e);
+	void visit(const ExprMul& e);
+	void visit(const ExprSub& e);
+	void visit(const ExprDiv& e);
+	void visit(const ExprMax& e);
+	void visit(const ExprMin& e);
+	void visit(const ExprAtan2& e);
+	void visit(const ExprMinus& e);
+	void visit(const ExprTrans& e);
+	void visit(const ExprSign& e);
+	void visit(const ExprAbs& e);
+	void visit(const ExprPower& e);
+	void visit(const ExprSqr& e);
+	void visit(const ExprSqrt& e);
+	void visit(const ExprExp& e);
+	void visit(const ExprLog& e);
+	void visit(const ExprCos& e);
+	void visit(const ExprSin& e);
+	void visit(const ExprTan& e);
+	void visit(const ExprCosh& e);
+	void visit(const ExprSinh& e);
+	void visit(const ExprTanh& e);
+	void visit(const ExprAcos& e);
+	void visit(const ExprAsin& e);
+	void visit(const ExprAtan& e);
+	void visit(const ExprAcosh& e);
+	void visit(const ExprAsinh& e);
+	void visit(const ExprAtanh& e);
+
+	/*
+	 * Return the simplified term of a binary operator or -1.
+	 */
+	int simplify(const ExprBinaryOp& e, int a, int b);
+
+	template<class T>
+	void visit_unary(const T& e, Domain (*fcst)(const Domain&));
+
+	template<class T>
+	void visit_binary(const T& e, Domain (*fcst)(const Domain&, const Domain&));
+};
+
+/* ============================================================================
+ 	 	 	 	 	 	 	 inline implementation
+  ============================================================================*/
+
+inline const ExprNode& ExprHashCons::copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y, bool absorb_zero) {
+	return this->copy(old_x, (const Array<const ExprNode>&) new_x, y, absorb_zero);
+}
+
+inline bool ExprHashCons::is_cst(int t) const {
+	return terms[t].value!=NULL;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_EXPR_HASH_CONS_H__
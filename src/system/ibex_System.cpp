@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_System.h"
+#include "ibex_SystemCache.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_UnknownFileException.h"
 #include "ibex_ExprCopy.h"
@@ -35,10 +36,24 @@ System::System() : nb_var(0), nb_ctr(0), box(1) /* tmp */ {
 
 }
 
-System::System(const char* filename) : nb_var(0), nb_ctr(0), box(1) /* tmp */ {
+System::System(const char* filename, bool cache) : nb_var(0), nb_ctr(0), box(1) /* tmp */ {
+	string cache_file;
+	if (cache) {
+		cache_file=SystemCache::cache_filename(filename);
+		if (SystemCache::load(*this, cache_file.c_str(), filename)) return;
+	}
+
 	FILE *fd;
 	if ((fd = fopen(filename, "r")) == NULL) throw UnknownFileException(filename);
 	load(fd);
+
+	if (cache) {
+		try {
+			SystemCache::save(*this, cache_file.c_str(), filename);
+		} catch(SystemCacheException&) {
+			// the cache is optional (e.g., the directory is read-only)
+		}
+	}
 }
 
 System::System(int n, const char* syntax) : nb_var(n), /* NOT TMP (required by parser) */
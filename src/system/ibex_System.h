@@ -25,6 +25,7 @@ class MainGenerator;
 }
 
 class SystemFactory;
+class SystemCache;
 class AmplInterface;
 
 /**
@@ -57,8 +58,14 @@ public:
 
 	/**
 	 * \brief Load a system from a file.
+	 *
+	 * If \a cache is true, the system is read from the binary cache
+	 * "<filename>.cache" when this cache is up to date. Otherwise, the file
+	 * is parsed and the cache is (re)written, if possible.
+	 *
+	 * \see #ibex::SystemCache.
 	 */
-	System(const char* filename);
+	System(const char* filename, bool cache=false);
 
 	/**
 	 * \brief Load a stand-alone conjunction of constraints
@@ -173,6 +180,7 @@ protected:
 
 private:
 	friend class parser::MainGenerator;
+	friend class SystemCache;
 	friend class NumConstraint; // NumConstraint requires to build a temporary system for parsing a string
 
 	void load(FILE* file);
@@ -0,0 +1,732 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemCache.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SystemCache.h"
+#include "ibex_ExprVisitor.h"
+#include "ibex_NodeMap.h"
+#include "ibex_DimException.h"
+
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <stdint.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char MAGIC[4]={'I','B','S','Y'};
+
+// to be incremented each time the format changes
+const int VERSION=1;
+
+const char* SUFFIX=".cache";
+
+/*
+ * Header of a cache file. The fields after the version
+ * identify the kind of machine that wrote the file.
+ */
+struct Header {
+	char magic[4];
+	int version;
+	int endianness;     // 0x01020304 in the native byte order
+	int int_size;       // sizeof(int)
+	int double_size;    // sizeof(double)
+	int64_t src_size;   // size of the source file (or -1)
+	int64_t src_mtime;  // modification time of the source file (or -1)
+	uint64_t data_size; // number of bytes after the header
+	uint64_t checksum;  // checksum of these bytes
+};
+
+/* Node types */
+enum {
+	SYM, CST, IDX, VEC, APPLY, CHI,
+	ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
+	MINUS, TRANS, SIGN, ABS, POWER,
+	SQR, SQRT, EXP, LOG,
+	COS,  SIN,  TAN,  ACOS,  ASIN,  ATAN,
+	COSH, SINH, TANH, ACOSH, ASINH, ATANH
+};
+
+uint64_t checksum(const char* data, size_t n) {
+	// FNV-1a
+	uint64_t h=14695981039346656037ULL;
+	for (size_t i=0; i<n; i++) {
+		h^=(unsigned char) data[i];
+		h*=1099511628211ULL;
+	}
+	return h;
+}
+
+void init_header(Header& h, const char* source) {
+	memset(&h,0,sizeof(Header)); // (padding bytes included)
+	memcpy(h.magic,MAGIC,sizeof(MAGIC));
+	h.version=VERSION;
+	h.endianness=0x01020304;
+	h.int_size=sizeof(int);
+	h.double_size=sizeof(double);
+	h.src_size=-1;
+	h.src_mtime=-1;
+
+	struct stat st;
+	if (source && stat(source,&st)==0) {
+		h.src_size=st.st_size;
+		h.src_mtime=st.st_mtime;
+	}
+}
+
+/*
+ * Serializes the system in memory.
+ */
+class Writer : public virtual ExprVisitor {
+public:
+	Writer(const System& sys) : sys(sys), nb_func(0) { }
+
+	void write(int x) {
+		data.append((const char*) &x, sizeof(int));
+	}
+
+	void write(double x) {
+		data.append((const char*) &x, sizeof(double));
+	}
+
+	void write(const char* s) {
+		int n=strlen(s);
+		write(n);
+		data.append(s,n);
+	}
+
+	void write(const Dim& d) {
+		write(d.dim1);
+		write(d.dim2);
+		write(d.dim3);
+	}
+
+	void write(const IntervalVector& v) {
+		// note: the bounds of the empty interval depend on
+		// the library, so it is written as [+oo,-oo]
+		for (int i=0; i<v.size(); i++) {
+			write(v[i].is_empty()? POS_INFINITY : v[i].lb());
+			write(v[i].is_empty()? NEG_INFINITY : v[i].ub());
+		}
+	}
+
+	void write(const Function& f) {
+		write(f.name);
+		write(f.nb_arg());
+		for (int i=0; i<f.nb_arg(); i++) {
+			write(f.arg(i).name);
+			write(f.arg(i).dim);
+		}
+		write(f.nb_nodes());
+
+		// the arguments of a node appear before the node
+		index.clean();
+		for (int i=f.nb_nodes()-1; i>=0; i--) {
+			f.node(i).acceptVisitor(*this);
+			index.insert(f.node(i),f.nb_nodes()-1-i);
+		}
+	}
+
+	void write_system() {
+		write(sys.nb_var);
+		write(sys.nb_ctr);
+
+		write(sys.args.size());
+		for (int i=0; i<sys.args.size(); i++) {
+			write(sys.args[i].name);
+			write(sys.args[i].dim);
+		}
+		write(sys.box);
+
+		write((int) sys.sybs.size());
+		for (vector<int>::const_iterator it=sys.sybs.begin(); it!=sys.sybs.end(); it++)
+			write(*it);
+		write((int) sys.eprs.size());
+		for (vector<int>::const_iterator it=sys.eprs.begin(); it!=sys.eprs.end(); it++)
+			write(*it);
+
+		write(sys.func.size());
+		// a function can only call the functions before
+		for (nb_func=0; nb_func<sys.func.size(); nb_func++)
+			write(sys.func[nb_func]);
+
+		write(sys.goal? 1 : 0);
+		if (sys.goal) write(*sys.goal);
+
+		write(sys.ctrs.size());
+		for (int i=0; i<sys.ctrs.size(); i++) {
+			write((int) sys.ctrs[i].op);
+			write(sys.ctrs[i].f);
+		}
+	}
+
+	const System& sys;
+
+	/* the serialized system */
+	string data;
+
+protected:
+	/* index of the nodes of the current function */
+	NodeMap<int> index;
+
+	/* number of auxiliary functions that can be called */
+	int nb_func;
+
+	void visit(const ExprNode& e) {
+		e.acceptVisitor(*this);
+	}
+
+	void visit(const ExprIndex& e) {
+		write(IDX);
+		write(index[e.expr]);
+		write(e.index);
+	}
+
+	void visit(const ExprSymbol& x) {
+		write(SYM);
+		write(x.key);
+	}
+
+	void visit(const ExprConstant& c) {
+		const Domain& d=c.get();
+		if (d.is_reference)
+			throw SystemCacheException("constants with a reference to a domain cannot be saved");
+		write(CST);
+		write(d.dim);
+		IntervalVector v(d.dim.size());
+		load(v,Array<const Domain>(d));
+		write(v);
+	}
+
+	void visit(const ExprVector& e) {
+		write(VEC);
+		write(e.row_vector()? 1 : 0);
+		write(e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			write(index[e.arg(i)]);
+	}
+
+	void visit(const ExprApply& e) {
+		int j=0;
+		for (; j<nb_func; j++)
+			if (&sys.func[j]==&e.func) break;
+		if (j==nb_func)
+			throw SystemCacheException("the function \""+string(e.func.name)+"\" is not an auxiliary function of the system");
+
+		write(APPLY);
+		write(j);
+		write(e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			write(index[e.arg(i)]);
+	}
+
+	void visit(const ExprChi& e) {
+		write(CHI);
+		for (int i=0; i<3; i++)
+			write(index[e.arg(i)]);
+	}
+
+	void visit(const ExprPower& e) {
+		write(POWER);
+		write(index[e.expr]);
+		write(e.expon);
+	}
+
+	void binary(int type, const ExprBinaryOp& e) {
+		write(type);
+		write(index[e.left]);
+		write(index[e.right]);
+	}
+
+	void unary(int type, const ExprUnaryOp& e) {
+		write(type);
+		write(index[e.expr]);
+	}
+
+	void visit(const ExprAdd& e)   { binary(ADD,e); }
+	void visit(const ExprMul& e)   { binary(MUL,e); }
+	void visit(const ExprSub& e)   { binary(SUB,e); }
+	void visit(const ExprDiv& e)   { binary(DIV,e); }
+	void visit(const ExprMax& e)   { binary(MAX,e); }
+	void visit(const ExprMin& e)   { binary(MIN,e); }
+	void visit(const ExprAtan2& e) { binary(ATAN2,e); }
+	void visit(const ExprMinus& e) { unary(MINUS,e); }
+	void visit(const ExprTrans& e) { unary(TRANS,e); }
+	void visit(const ExprSign& e)  { unary(SIGN,e); }
+	void visit(const ExprAbs& e)   { unary(ABS,e); }
+	void visit(const ExprSqr& e)   { unary(SQR,e); }
+	void visit(const ExprSqrt& e)  { unary(SQRT,e); }
+	void visit(const ExprExp& e)   { unary(EXP,e); }
+	void visit(const ExprLog& e)   { unary(LOG,e); }
+	void visit(const ExprCos& e)   { unary(COS,e); }
+	void visit(const ExprSin& e)   { unary(SIN,e); }
+	void visit(const ExprTan& e)   { unary(TAN,e); }
+	void visit(const ExprCosh& e)  { unary(COSH,e); }
+	void visit(const ExprSinh& e)  { unary(SINH,e); }
+	void visit(const ExprTanh& e)  { unary(TANH,e); }
+	void visit(const ExprAcos& e)  { unary(ACOS,e); }
+	void visit(const ExprAsin& e)  { unary(ASIN,e); }
+	void visit(const ExprAtan& e)  { unary(ATAN,e); }
+	void visit(const ExprAcosh& e) { unary(ACOSH,e); }
+	void visit(const ExprAsinh& e) { unary(ASINH,e); }
+	void visit(const ExprAtanh& e) { unary(ATANH,e); }
+};
+
+/*
+ * Content of a file, mapped in memory (or read
+ * in a single block if mapping is not supported).
+ */
+class FileBlock {
+public:
+	FileBlock(const char* filename) : data(NULL), size(0) {
+#ifdef _WIN32
+		FILE* fd=fopen(filename,"rb");
+		if (!fd) return;
+		fseek(fd,0,SEEK_END);
+		long n=ftell(fd);
+		fseek(fd,0,SEEK_SET);
+		if (n>0) {
+			buf=new char[n];
+			if (fread(buf,1,n,fd)==(size_t) n) { data=buf; size=n; }
+			else delete[] buf;
+		}
+		fclose(fd);
+#else
+		int fd=open(filename,O_RDONLY);
+		if (fd<0) return;
+		struct stat st;
+		if (fstat(fd,&st)==0 && st.st_size>0) {
+			void* p=mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+			if (p!=MAP_FAILED) { data=(const char*) p; size=st.st_size; }
+		}
+		close(fd); // the mapping remains valid
+#endif
+	}
+
+	~FileBlock() {
+		if (!data) return;
+#ifdef _WIN32
+		delete[] buf;
+#else
+		munmap((void*) data,size);
+#endif
+	}
+
+	const char* data;
+	size_t size;
+
+private:
+#ifdef _WIN32
+	char* buf;
+#endif
+};
+
+/*
+ * Raised by the reader on data that does not match the format.
+ */
+class CorruptedCache { };
+
+/*
+ * Rebuilds a system from its serialized form.
+ *
+ * The checksum does not guarantee that the data matches the
+ * format (e.g., a collision or a change in the layout): all the
+ * sizes, indices and tags are checked and a CorruptedCache is
+ * raised on the first mismatch. The objects built so far are
+ * deleted and the system is left unchanged.
+ */
+class Reader {
+public:
+	Reader(const char* p, const char* end) : p(p), end(end), max_size(INT_MAX) { }
+
+	int read_int() {
+		check_size(1,sizeof(int));
+		int x;
+		memcpy(&x,p,sizeof(int));
+		p+=sizeof(int);
+		return x;
+	}
+
+	double read_double() {
+		check_size(1,sizeof(double));
+		double x;
+		memcpy(&x,p,sizeof(double));
+		p+=sizeof(double);
+		return x;
+	}
+
+	/* Read an index in [0,n) */
+	int read_index(int n) {
+		int i=read_int();
+		check(i>=0 && i<n);
+		return i;
+	}
+
+	string read_string() {
+		int n=read_int();
+		check_size(n,1);
+		string s(p,n);
+		p+=n;
+		return s;
+	}
+
+	Dim read_dim() {
+		int dim1=read_int();
+		int dim2=read_int();
+		int dim3=read_int();
+		check(dim1>0 && dim2>0 && dim3>0);
+		check(((double) dim1)*dim2*dim3<=max_size);
+		return Dim(dim1,dim2,dim3);
+	}
+
+	Interval read_interval() {
+		double lb=read_double();
+		double ub=read_double();
+		return lb<=ub ? Interval(lb,ub) : Interval::EMPTY_SET;
+	}
+
+	void read(IntervalVector& v) {
+		for (int i=0; i<v.size(); i++)
+			v[i]=read_interval();
+	}
+
+	/* The functions that can be called are in func */
+	Function* read_function(const vector<Function*>& func) {
+		string name=read_string();
+
+		int nb_arg=read_int();
+		check_size(nb_arg,sizeof(int)); // at least the length of the name of each
+		check(nb_arg>0);
+		Array<const ExprSymbol> x(nb_arg);
+		vector<const ExprNode*> node;
+		int nb_sym=0;
+
+		try {
+			for (; nb_sym<nb_arg; nb_sym++) {
+				string xname=read_string();
+				x.set_ref(nb_sym,ExprSymbol::new_(xname.c_str(),read_dim()));
+			}
+
+			int n=read_int();
+			check_size(n,sizeof(int)); // at least the type of each
+			check(n>0);
+			node.reserve(n);
+
+#define ARG (*node[read_index(node.size())])
+
+			for (int i=0; i<n; i++) {
+				int type=read_int();
+				switch (type) {
+				case SYM:   node.push_back(&x[read_index(nb_arg)]); break;
+				case CST:   {
+					Dim dim=read_dim();
+					check_size(dim.size(),2*sizeof(double));
+					Domain d(dim);
+					IntervalVector v(dim.size());
+					read(v);
+					Array<Domain> a(d);
+					load(a,v);
+					node.push_back(&ExprConstant::new_(d));
+					break;
+				}
+				case IDX:   {
+					const ExprNode& e=ARG;
+					node.push_back(&e[read_int()]); // the index is checked by ExprIndex
+					break;
+				}
+				case VEC:
+				case APPLY:
+				case CHI:   {
+					bool in_row=false;
+					const Function* f=NULL;
+					int nb_args=3;
+					if (type==VEC) in_row=read_int();
+					if (type==APPLY) f=func[read_index(func.size())];
+					if (type!=CHI) nb_args=read_int();
+					check_size(nb_args,sizeof(int));
+					check(nb_args>0 && (!f || nb_args==f->nb_arg()));
+					Array<const ExprNode> args(nb_args);
+					for (int j=0; j<nb_args; j++)
+						args.set_ref(j,ARG);
+					if (type==VEC)        node.push_back(&ExprVector::new_(args,in_row));
+					else if (type==APPLY) node.push_back(&ExprApply::new_(*f,args));
+					else                  node.push_back(&ExprChi::new_(args));
+					break;
+				}
+				case ADD:   { const ExprNode& l=ARG; node.push_back(&ExprAdd::new_(l,ARG)); break; }
+				case MUL:   { const ExprNode& l=ARG; node.push_back(&ExprMul::new_(l,ARG)); break; }
+				case SUB:   { const ExprNode& l=ARG; node.push_back(&ExprSub::new_(l,ARG)); break; }
+				case DIV:   { const ExprNode& l=ARG; node.push_back(&ExprDiv::new_(l,ARG)); break; }
+				case MAX:   { const ExprNode& l=ARG; node.push_back(&ExprMax::new_(l,ARG)); break; }
+				case MIN:   { const ExprNode& l=ARG; node.push_back(&ExprMin::new_(l,ARG)); break; }
+				case ATAN2: { const ExprNode& l=ARG; node.push_back(&ExprAtan2::new_(l,ARG)); break; }
+				case POWER: { const ExprNode& e=ARG; node.push_back(&ExprPower::new_(e,read_int())); break; }
+				case MINUS: node.push_back(&ExprMinus::new_(ARG)); break;
+				case TRANS: node.push_back(&ExprTrans::new_(ARG)); break;
+				case SIGN:  node.push_back(&ExprSign::new_(ARG));  break;
+				case ABS:   node.push_back(&ExprAbs::new_(ARG));   break;
+				case SQR:   node.push_back(&ExprSqr::new_(ARG));   break;
+				case SQRT:  node.push_back(&ExprSqrt::new_(ARG));  break;
+				case EXP:   node.push_back(&ExprExp::new_(ARG));   break;
+				case LOG:   node.push_back(&ExprLog::new_(ARG));   break;
+				case COS:   node.push_back(&ExprCos::new_(ARG));   break;
+				case SIN:   node.push_back(&ExprSin::new_(ARG));   break;
+				case TAN:   node.push_back(&ExprTan::new_(ARG));   break;
+				case COSH:  node.push_back(&ExprCosh::new_(ARG));  break;
+				case SINH:  node.push_back(&ExprSinh::new_(ARG));  break;
+				case TANH:  node.push_back(&ExprTanh::new_(ARG));  break;
+				case ACOS:  node.push_back(&ExprAcos::new_(ARG));  break;
+				case ASIN:  node.push_back(&ExprAsin::new_(ARG));  break;
+				case ATAN:  node.push_back(&ExprAtan::new_(ARG));  break;
+				case ACOSH: node.push_back(&ExprAcosh::new_(ARG)); break;
+				case ASINH: node.push_back(&ExprAsinh::new_(ARG)); break;
+				case ATANH: node.push_back(&ExprAtanh::new_(ARG)); break;
+				default:    throw CorruptedCache();
+				}
+			}
+
+#undef ARG
+
+			return new Function(x,*node.back(),name.c_str());
+
+		} catch (DimException&) {
+			// the dimensions of the nodes do not match
+			cleanup(x,nb_sym,node);
+			throw CorruptedCache();
+		} catch (CorruptedCache&) {
+			cleanup(x,nb_sym,node);
+			throw;
+		}
+	}
+
+	/* The arguments of a function of the system are those of the system */
+	static void check_args(const Function& f, const Array<const ExprSymbol>& args) {
+		check(f.nb_arg()==args.size());
+		for (int i=0; i<args.size(); i++)
+			check(f.arg(i).dim==args[i].dim);
+	}
+
+	void read_system(System& sys) {
+		// the objects are first built apart, so that
+		// they can be deleted if the data is corrupted
+		Array<const ExprSymbol> args;
+		vector<Function*> func;
+		Function* goal=NULL;
+		vector<NumConstraint*> ctrs;
+		int nb_args=0;
+		int nb_sym=0; // number of arguments built
+
+		try {
+			int nb_var=read_int();
+			int nb_ctr=read_int();
+			check(nb_var>0 && nb_ctr>=0);
+			check_size(nb_var,2*sizeof(double)); // the bounds of the box
+
+			// A value is built from the variables and from the nodes stored
+			// in the data (at least one int each): this bounds the size of
+			// the arguments of the functions.
+			max_size=std::min((double) INT_MAX, ((double) nb_var)*((end-p)/sizeof(int)));
+
+			nb_args=read_int();
+			check_size(nb_args,sizeof(int));
+			args.resize(nb_args);
+			int size=0;
+			for (; nb_sym<nb_args; nb_sym++) {
+				string name=read_string();
+				Dim dim=read_dim();
+				check(dim.size()<=nb_var-size);
+				args.set_ref(nb_sym,ExprSymbol::new_(name.c_str(),dim));
+				size+=dim.size();
+			}
+			check(size==nb_var);
+
+			IntervalVector box(nb_var);
+			read(box);
+
+			vector<int> sybs=read_indices(nb_args);
+			vector<int> eprs=read_indices(nb_args);
+
+			int nb_func=read_int();
+			check_size(nb_func,sizeof(int));
+			// a function can only call the functions before
+			for (int i=0; i<nb_func; i++)
+				func.push_back(read_function(func));
+
+			if (read_int()) {
+				goal=read_function(func);
+				check_args(*goal,args);
+			}
+
+			int nb_ctrs=read_int();
+			check_size(nb_ctrs,sizeof(int));
+			for (int i=0; i<nb_ctrs; i++) {
+				int op=read_int();
+				check(op>=LT && op<=GT);
+				Function* f=read_function(func);
+				ctrs.push_back(new NumConstraint(*f,(CmpOp) op,true));
+				check_args(*f,args);
+			}
+
+			check(p==end);
+
+			// the system is now built
+			(int&) sys.nb_var = nb_var;
+			(int&) sys.nb_ctr = nb_ctr;
+			sys.args.resize(nb_args);
+			for (int i=0; i<nb_args; i++)
+				sys.args.set_ref(i,args[i]);
+			sys.box.resize(nb_var);
+			sys.box=box;
+			sys.sybs=sybs;
+			sys.eprs=eprs;
+			sys.func.resize(func.size());
+			for (unsigned int i=0; i<func.size(); i++)
+				sys.func.set_ref(i,*func[i]);
+			sys.goal=goal;
+			sys.ctrs.resize(ctrs.size());
+			for (unsigned int i=0; i<ctrs.size(); i++)
+				sys.ctrs.set_ref(i,*ctrs[i]);
+
+		} catch (CorruptedCache&) {
+			for (vector<NumConstraint*>::iterator it=ctrs.begin(); it!=ctrs.end(); it++)
+				delete *it;
+			if (goal) delete goal;
+			for (vector<Function*>::iterator it=func.begin(); it!=func.end(); it++)
+				delete *it;
+			for (int i=0; i<nb_sym; i++)
+				delete &args[i];
+			throw;
+		}
+	}
+
+private:
+	/* Throw a CorruptedCache if b is false */
+	static void check(bool b) {
+		if (!b) throw CorruptedCache();
+	}
+
+	/* Check that n items of the given size can be read */
+	void check_size(int n, size_t size) {
+		check(n>=0 && (size_t) n<=((size_t) (end-p))/size);
+	}
+
+	/* Read a list of indices in [0,n) */
+	vector<int> read_indices(int n) {
+		int size=read_int();
+		check_size(size,sizeof(int));
+		vector<int> v(size);
+		for (int i=0; i<size; i++)
+			v[i]=read_index(n);
+		return v;
+	}
+
+	/* Delete the nodes of a function built so far */
+	static void cleanup(Array<const ExprSymbol>& x, int nb_sym, const vector<const ExprNode*>& node) {
+		for (vector<const ExprNode*>::const_iterator it=node.begin(); it!=node.end(); it++)
+			if (!dynamic_cast<const ExprSymbol*>(*it)) delete (ExprNode*) *it;
+		for (int i=0; i<nb_sym; i++)
+			delete &x[i];
+	}
+
+	const char* p;
+	const char* end;
+
+	/* Maximal number of components of a dimension */
+	double max_size;
+};
+
+} // end anonymous namespace
+
+string SystemCache::cache_filename(const char* source) {
+	return string(source)+SUFFIX;
+}
+
+void SystemCache::save(const System& sys, const char* filename, const char* source) {
+	Writer w(sys);
+	w.write_system();
+
+	Header h;
+	init_header(h,source);
+	h.data_size=w.data.size();
+	h.checksum=checksum(w.data.data(),w.data.size());
+
+	// the file is first written under a temporary name
+	// so that another process never reads a partial file.
+	ostringstream tmp;
+	tmp << filename << ".tmp";
+#ifndef _WIN32
+	tmp << '.' << getpid();
+#endif
+
+	FILE* fd=fopen(tmp.str().c_str(),"wb");
+	if (!fd) throw SystemCacheException("cannot write "+tmp.str());
+
+	bool ok=fwrite(&h,sizeof(Header),1,fd)==1 && fwrite(w.data.data(),1,w.data.size(),fd)==w.data.size();
+	ok &= fclose(fd)==0;
+
+	if (!ok || rename(tmp.str().c_str(),filename)!=0) {
+		remove(tmp.str().c_str());
+		throw SystemCacheException("cannot write "+string(filename));
+	}
+}
+
+bool SystemCache::load(System& sys, const char* filename, const char* source) {
+	FileBlock file(filename);
+	if (!file.data || file.size<sizeof(Header)) return false;
+
+	Header expected;
+	init_header(expected,source);
+
+	Header h;
+	memcpy(&h,file.data,sizeof(Header));
+
+	if (memcmp(h.magic,MAGIC,sizeof(MAGIC))!=0 || h.version!=expected.version ||
+		h.endianness!=expected.endianness || h.int_size!=expected.int_size ||
+		h.double_size!=expected.double_size)
+		return false;
+
+	if (source && (h.src_size!=expected.src_size || h.src_mtime!=expected.src_mtime || h.src_size==-1))
+		return false;
+
+	const char* data=file.data+sizeof(Header);
+	if (h.data_size!=file.size-sizeof(Header) || h.checksum!=checksum(data,h.data_size))
+		return false;
+
+	try {
+		Reader(data,data+h.data_size).read_system(sys);
+	} catch (CorruptedCache&) {
+		return false;
+	}
+	sys.init_f_from_ctrs();
+	return true;
+}
+
+System* SystemCache::load(const char* filename, const char* source) {
+	System* sys=new System();
+	sys->goal=NULL;
+	if (load(*sys,filename,source)) return sys;
+	delete sys;
+	return NULL;
+}
+
+} // namespace ibex
@@ -0,0 +1,105 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemCache.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SYSTEM_CACHE_H__
+#define __IBEX_SYSTEM_CACHE_H__
+
+#include "ibex_System.h"
+#include "ibex_Exception.h"
+
+#include <string>
+
+namespace ibex {
+
+/** \ingroup system
+ *
+ * \brief Thrown when a system cannot be saved in a cache file.
+ */
+class SystemCacheException : public Exception {
+public:
+	SystemCacheException(const std::string& msg) : msg(msg) { }
+
+	/** \brief Reason of the failure. */
+	std::string msg;
+};
+
+/** \ingroup system
+ *
+ * \brief Binary cache of a system.
+ *
+ * Parsing a large model (and building all its functions) can take much longer
+ * than reading back the result. A system can be saved into a compact binary
+ * file that contains the variables, the domains, the auxiliary functions, the
+ * goal and the constraints. The expression of each function is saved as a
+ * flat array of nodes (in topological order) where the arguments of a node are
+ * referred to by their position in the array: the file is read in a single
+ * block and the nodes are rebuilt in a single pass.
+ *
+ * The native representation of numbers is used, so a file can only be read on
+ * the same kind of machine (this is checked). The file also contains a version
+ * number of the format and a checksum of the data, so that an obsolete or
+ * corrupted file is never loaded. Finally, the file can be stamped with the size
+ * and the modification time of the source file of the system: the cache is
+ * ignored as soon as the source file is modified.
+ *
+ * The main function #ibex::System::f and the compiled form of the functions are
+ * not saved: they are rebuilt from the expressions (in linear time).
+ *
+ * \see #ibex::System::System(const char*, bool).
+ */
+class SystemCache {
+public:
+	/**
+	 * \brief Save a system into a file.
+	 *
+	 * \param sys      - the system
+	 * \param filename - the cache file
+	 * \param source   - the source file of the system (or NULL)
+	 *
+	 * The data is first written into a temporary file that replaces
+	 * the cache file when it is complete: another process never
+	 * reads a partial file.
+	 *
+	 * \throw SystemCacheException if the file cannot be written or if the system
+	 * cannot be saved (e.g., if a function called in an expression is not one
+	 * of the auxiliary functions of the system).
+	 */
+	static void save(const System& sys, const char* filename, const char* source=NULL);
+
+	/**
+	 * \brief Load a system from a file.
+	 *
+	 * \param filename - the cache file
+	 * \param source   - the source file of the system (or NULL)
+	 *
+	 * \return NULL if the file does not exist, was written by another version
+	 * of Ibex or on another kind of machine, is corrupted or, if \a source is
+	 * not NULL, is not up to date with the source file.
+	 */
+	static System* load(const char* filename, const char* source=NULL);
+
+	/**
+	 * \brief The name of the cache file associated to a source file.
+	 */
+	static std::string cache_filename(const char* source);
+
+protected:
+	friend class System;
+
+	/*
+	 * Load a system from a file into an uninitialized system.
+	 * Return false if the file cannot be loaded (sys is then unchanged).
+	 */
+	static bool load(System& sys, const char* filename, const char* source);
+};
+
+} // namespace ibex
+
+#endif // __IBEX_SYSTEM_CACHE_H__
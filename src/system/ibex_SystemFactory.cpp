@@ -12,6 +12,7 @@
 #include "ibex_Exception.h"
 #include "ibex_ExprCtr.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprHashCons.h"
 #include "ibex_EmptySystemException.h"
 
 using std::vector;
@@ -48,7 +49,7 @@ void SystemFactory::add_goal(const ExprNode& goal) {
 
 	Array<const ExprSymbol> goal_vars(args->size());
 	varcopy(*args,goal_vars);
-	const ExprNode& goal_expr=ExprCopy().copy(*args, goal_vars, goal); //, true);
+	const ExprNode& goal_expr=ExprHashCons().copy(*args, goal_vars, goal);
 	this->goal = new Function(goal_vars, goal_expr);
 }
 
@@ -67,7 +68,7 @@ void SystemFactory::add_ctr(const ExprCtr& ctr) {
 
 	Array<const ExprSymbol> ctr_vars(args->size());
 	varcopy(*args,ctr_vars);
-	const ExprNode& ctr_expr=ExprCopy().copy(*args, ctr_vars, ctr.e); //, true);
+	const ExprNode& ctr_expr=ExprHashCons().copy(*args, ctr_vars, ctr.e);
 
 	ctrs.push_back(new NumConstraint(*new Function(ctr_vars, ctr_expr), ctr.op, true));
 }
@@ -77,7 +78,7 @@ void SystemFactory::add_ctr2(const ExprCtr& ctr) {
 
 	Array<const ExprSymbol> ctr_vars(args->size());
 	varcopy(*args,ctr_vars);
-	const ExprNode& ctr_expr=ExprCopy().copy(*args, ctr_vars, ctr.e); //, true);
+	const ExprNode& ctr_expr=ExprHashCons().copy(*args, ctr_vars, ctr.e);
 
 	ctrs.push_back(new NumConstraint(*new Function(ctr_vars, ctr_expr), ctr.op, true));
 }
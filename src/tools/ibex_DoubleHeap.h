@@ -69,6 +69,16 @@ public:
 	/** \brief Return next data of the second heap  (but does not pop it).*/
 	T* top2() const;
 
+	/**
+	 * \brief Return the ith data of the first heap, by levels (i=0 is the top).
+	 *
+	 * Pushing the data in this order into an empty heap gives back the
+	 * same first heap. The heap is not modified.
+	 *
+	 * Complexity: o(log(n))
+	 */
+	T* get1(unsigned int i) const;
+
 	/**
 	 * \brief Return the minimum (the criterion for the first heap)
 	 *
@@ -326,6 +336,11 @@ T* DoubleHeap<T>::top() const {
 	}
 }
 
+template<class T>
+T* DoubleHeap<T>::get1(unsigned int i) const {
+	return heap1->get_node(i)->elt->data;
+}
+
 template<class T>
 T* DoubleHeap<T>::top1() const {
 	// the first heap is used
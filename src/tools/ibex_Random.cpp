@@ -40,6 +40,41 @@
 
 #include "ibex_Random.h"
 
+#include <cstddef>
+
+namespace ibex {
+
+namespace {
+
+/* The state of the calling thread (NULL: the shared state) */
+__thread RNG::State* local=NULL;
+
+uint32_t xorshift(uint32_t& x, uint32_t& y, uint32_t& z) {
+ 	uint32_t t;
+ 	x ^= x << 16;
+ 	x ^= x >> 5;
+ 	x ^= x << 1;
+
+ 	t = x;
+	x = y;
+	y = z;
+	z = t ^ x ^ y;
+
+	return z;
+}
+
+}
+
+RNG::State::State(unsigned long s) : x((uint32_t) s), y(362436069), z(521288629) {
+
+}
+
+void RNG::set_local(State* s) {
+	local=s;
+}
+
+} // end namespace ibex
+
 
 #ifdef  _IBEX_WITH_DIRECT_
 
@@ -56,6 +91,11 @@ bool RNG::srand()
 	 */
 	//srand(times(&t)+time(NULL));
 
+	if (local) {
+		if (local->x<UINT32_MAX) { local->x++; return true; }
+		else { *local=State(); return false; }
+	}
+
 	if(x<UINT32_MAX)
 	{
 		x++;
@@ -74,7 +114,8 @@ bool RNG::srand(unsigned long s)
 	 */
 	if(s<=UINT32_MAX)
 	{
-		x=s;
+		if (local) *local=State(s);
+		else x=s;
 		return true;
 	}
 	else 
@@ -85,17 +126,8 @@ uint32_t RNG::rand () { //period 2^96-1
 	/** This function serves to obtain a random number \c 
 	 \return An integer in the interval [0,UINT32_MAX].
 	 */
- 	uint32_t t;
- 	x ^= x << 16;
- 	x ^= x >> 5;
- 	x ^= x << 1;
- 	
- 	t = x;
-	x = y;
-	y = z;
-	z = t ^ x ^ y;      
-	
-	return z;
+	if (local) return xorshift(local->x,local->y,local->z);
+	else return xorshift(x,y,z);
 }
 
 
@@ -103,11 +135,20 @@ uint32_t RNG::rand () { //period 2^96-1
 #else
 #include <stdlib.h>
 
-bool ibex::RNG::srand(){ ::srand(::rand()+10);  return true; }
+bool ibex::RNG::srand(){
+	if (ibex::local) { ibex::local->x+=10; return true; }
+	::srand(::rand()+10);  return true;
+}
 
-bool ibex::RNG::srand(unsigned long s){  ::srand(s); return true; }
+bool ibex::RNG::srand(unsigned long s){
+	if (ibex::local) { *ibex::local=State(s); return true; }
+	::srand(s); return true;
+}
 
-uint32_t ibex::RNG::rand () { return ::rand(); }
+uint32_t ibex::RNG::rand () {
+	if (ibex::local) return ibex::xorshift(ibex::local->x,ibex::local->y,ibex::local->z);
+	return ::rand();
+}
 
 
 #endif
@@ -60,7 +60,27 @@ namespace ibex {
 		static bool srand(unsigned long s);
 		static uint32_t rand();
 		static double rand(double a, double b){return a+((double)(b-a)*RNG::rand())/UINT32_MAX;}
-		
+
+		/**
+		 * \brief State of a generator local to a thread.
+		 *
+		 * The state shared by all the threads is not protected. A thread
+		 * that installs its own state (see #set_local) draws its numbers
+		 * (and is seeded by #srand) independently of the other threads.
+		 */
+		class State {
+		public:
+			State(unsigned long s=123456789);
+			uint32_t x,y,z;
+		};
+
+		/**
+		 * \brief Use the state \a s in the calling thread.
+		 *
+		 * If \a s is NULL, the calling thread uses the shared state again.
+		 */
+		static void set_local(State* s);
+
 	private:
 		static uint32_t x,y,z;
 	};
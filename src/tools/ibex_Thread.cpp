@@ -0,0 +1,108 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Thread.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Thread.h"
+
+#include <unistd.h>
+#include <cassert>
+#include <stdexcept>
+
+namespace ibex {
+
+volatile int Thread::running=0;
+
+Thread::Thread(unsigned long seed) : started(false), rng(seed) {
+
+}
+
+Thread::~Thread() {
+	assert(!started);
+}
+
+void* Thread::entry(void* thread) {
+	RNG::set_local(&((Thread*) thread)->rng);
+	((Thread*) thread)->run();
+	RNG::set_local(NULL);
+	return NULL;
+}
+
+void Thread::start() {
+	assert(!started);
+	atomic_add(running,1);
+	if (pthread_create(&tid, NULL, entry, this)!=0) {
+		atomic_add(running,-1);
+		ibex_error("cannot create thread");
+	}
+	started=true;
+}
+
+void Thread::join() {
+	if (!started) return;
+	pthread_join(tid, NULL);
+	started=false;
+	atomic_add(running,-1);
+}
+
+int Thread::nb_running() {
+	return atomic_load(running);
+}
+
+ThreadError::ThreadError() : _raised(false) {
+#if __cplusplus < 201103L
+	ibex_exception=false;
+#endif
+}
+
+void ThreadError::capture() {
+	Lock l(m);
+	if (_raised) return;
+	_raised=true;
+#if __cplusplus >= 201103L
+	e=std::current_exception();
+#else
+	try {
+		throw;
+	} catch (Exception&) {
+		ibex_exception=true;
+	} catch (std::exception& ex) {
+		ibex_exception=false;
+		what=ex.what();
+	} catch (...) {
+		ibex_exception=false;
+		what="unknown exception";
+	}
+#endif
+}
+
+bool ThreadError::raised() {
+	Lock l(m);
+	return _raised;
+}
+
+void ThreadError::rethrow() {
+	Lock l(m);
+	if (!_raised) return;
+	_raised=false;
+#if __cplusplus >= 201103L
+	std::exception_ptr e2=e;
+	e=std::exception_ptr();
+	std::rethrow_exception(e2);
+#else
+	if (ibex_exception) throw Exception();
+	else throw std::runtime_error(what);
+#endif
+}
+
+int Thread::nb_procs() {
+	long n=sysconf(_SC_NPROCESSORS_ONLN);
+	return n<1 ? 1 : (int) n;
+}
+
+} // end namespace ibex
@@ -0,0 +1,247 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Thread.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_THREAD_H__
+#define __IBEX_THREAD_H__
+
+#include "ibex_Exception.h"
+#include "ibex_Random.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#if __cplusplus >= 201103L
+#include <exception>
+#endif
+
+namespace ibex {
+
+/** \ingroup tools
+ *
+ * \brief Mutual exclusion lock.
+ *
+ * Thin wrapper of a POSIX mutex (used by the parallel strategies).
+ */
+class Mutex {
+public:
+	/** Create an unlocked mutex. */
+	Mutex();
+
+	/** Delete *this. */
+	~Mutex();
+
+	/** Lock the mutex (blocking). */
+	void lock();
+
+	/** Try to lock the mutex. Return true in case of success. */
+	bool try_lock();
+
+	/** Unlock the mutex. */
+	void unlock();
+
+private:
+	Mutex(const Mutex&);            // forbidden
+	Mutex& operator=(const Mutex&); // forbidden
+
+	pthread_mutex_t m;
+};
+
+/** \ingroup tools
+ *
+ * \brief Scoped lock.
+ *
+ * Lock a mutex during the lifetime of this object.
+ */
+class Lock {
+public:
+	Lock(Mutex& m);
+	~Lock();
+private:
+	Lock(const Lock&);            // forbidden
+	Lock& operator=(const Lock&); // forbidden
+
+	Mutex& m;
+};
+
+/** \ingroup tools
+ *
+ * \brief Thread.
+ *
+ * A subclass implements #run(). Call #start() to execute #run() in a new thread
+ * and #join() to wait for its termination.
+ *
+ * The thread draws its random numbers (see #ibex::RNG) from its own generator,
+ * so that the sequence of a thread only depends on its seed, not on the other threads.
+ */
+class Thread {
+public:
+	/**
+	 * \brief Create a thread (not started yet).
+	 *
+	 * \param seed - seed of the random number generator of the thread.
+	 */
+	Thread(unsigned long seed=1);
+
+	/** Delete *this. The thread must have been joined. */
+	virtual ~Thread();
+
+	/** Start the thread. */
+	void start();
+
+	/** Wait for the thread to terminate. */
+	void join();
+
+	/** Let other threads run. */
+	static void yield();
+
+	/** Number of processors available (at least 1). */
+	static int nb_procs();
+
+	/** Number of threads started and not joined yet. */
+	static int nb_running();
+
+protected:
+	/** The code executed by the thread. */
+	virtual void run()=0;
+
+private:
+	static void* entry(void* thread);
+
+	pthread_t tid;
+	bool started;
+	RNG::State rng;
+
+	/* Number of threads started and not joined */
+	static volatile int running;
+};
+
+/** \ingroup tools
+ *
+ * \brief First exception raised by a group of threads.
+ *
+ * An exception cannot leave the thread that raised it. A thread calls
+ * #capture() in a catch block and the thread that waits for the group calls
+ * #rethrow() once the group is joined.
+ *
+ * \note Before C++11, the type of the exception is not preserved: an
+ * #ibex::Exception is rethrown as an #ibex::Exception, and any other exception
+ * as a std::runtime_error (with the message of a std::exception).
+ */
+class ThreadError {
+public:
+	/** No exception. */
+	ThreadError();
+
+	/** Record the exception being handled. Only the first one is kept. */
+	void capture();
+
+	/** True if an exception has been recorded. */
+	bool raised();
+
+	/** Rethrow the recorded exception, if any, and forget it. */
+	void rethrow();
+
+private:
+	ThreadError(const ThreadError&);            // forbidden
+	ThreadError& operator=(const ThreadError&); // forbidden
+
+	Mutex m;
+	bool _raised;
+#if __cplusplus >= 201103L
+	std::exception_ptr e;
+#else
+	bool ibex_exception;
+	std::string what;
+#endif
+};
+
+/** \ingroup tools
+ *
+ * \brief Atomically add \a inc to \a x and return the new value.
+ */
+template<typename T>
+inline T atomic_add(volatile T& x, T inc) {
+	return __sync_add_and_fetch(&x,inc);
+}
+
+/** \ingroup tools
+ *
+ * \brief Read \a x (with a full memory barrier).
+ *
+ * \pre \a x is a word-aligned scalar (so that reading it is atomic).
+ */
+template<typename T>
+inline T atomic_load(volatile T& x) {
+	__sync_synchronize();
+	T v=x;
+	__sync_synchronize();
+	return v;
+}
+
+/** \ingroup tools
+ *
+ * \brief Write \a y in \a x (with a full memory barrier).
+ *
+ * \pre \a x is a word-aligned scalar (so that writing it is atomic).
+ */
+template<typename T>
+inline void atomic_store(volatile T& x, T y) {
+	__sync_synchronize();
+	x=y;
+	__sync_synchronize();
+}
+
+/** \ingroup tools
+ *
+ * \brief Atomically replace \a x by \a y if \a x equals \a old.
+ *
+ * \return true if the replacement occurred.
+ */
+template<typename T>
+inline bool atomic_cas(volatile T& x, T old, T y) {
+	return __sync_bool_compare_and_swap(&x,old,y);
+}
+
+/*============================================ inline implementation ============================================ */
+
+inline Mutex::Mutex() {
+	pthread_mutex_init(&m,NULL);
+}
+
+inline Mutex::~Mutex() {
+	pthread_mutex_destroy(&m);
+}
+
+inline void Mutex::lock() {
+	pthread_mutex_lock(&m);
+}
+
+inline bool Mutex::try_lock() {
+	return pthread_mutex_trylock(&m)==0;
+}
+
+inline void Mutex::unlock() {
+	pthread_mutex_unlock(&m);
+}
+
+inline Lock::Lock(Mutex& m) : m(m) {
+	m.lock();
+}
+
+inline Lock::~Lock() {
+	m.unlock();
+}
+
+inline void Thread::yield() {
+	sched_yield();
+}
+
+} // end namespace ibex
+#endif // __IBEX_THREAD_H__
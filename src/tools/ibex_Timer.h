@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : May 13, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_TIMER_H__
@@ -13,23 +13,6 @@
 
 #include "ibex_Exception.h"
 
-#ifndef _MSC_VER
-#include <sys/time.h>
-#endif // _MSC_VER
-
-
-#ifdef _WIN32
-//#include <ctime>
-#else
-#include <sys/resource.h>
-#endif
-
-#ifndef _MSC_VER
-#include <unistd.h>
-#endif // _MSC_VER
-
-
-
 namespace ibex {
 
 /** \ingroup tools
@@ -42,6 +25,13 @@ class TimeOutException : public Exception { };
 /** \ingroup tools
  *
  * \brief Timer.
+ *
+ * Each timer has its own state, so that independent searches
+ * can be timed in different threads.
+ *
+ * The CPU time (VIRTUAL) is the time of the calling thread, when
+ * the system provides it (the time of the process otherwise).
+ * The real time (__REAL) is given by a monotonic clock.
  */
 class Timer {
  public:
@@ -50,39 +40,89 @@ class Timer {
 
   typedef enum type_timer {__REAL, VIRTUAL} TimerType;
 
-  static void start();
+  /**
+   * \brief Create a timer (stopped, with a time of 0).
+   *
+   * \param type   - the clock used.
+   * \param period - the clock is read once every \a period calls to #check(double).
+   */
+  explicit Timer(TimerType type=VIRTUAL, unsigned int period=default_period);
+
+  /**
+   * \brief Start the timer (the time is reset to 0).
+   */
+  void start();
 
-  static void stop(TimerType type=VIRTUAL);
+  /**
+   * \brief Stop the timer.
+   *
+   * The time between the last call to #start() and this
+   * call is then given by #get_time().
+   */
+  void stop();
+
+  /**
+   * \brief Time elapsed since the last call to #start().
+   *
+   * If the timer is stopped, the time between the last calls
+   * to #start() and #stop().
+   */
+  Time get_time() const;
+
+  /**
+   * \brief Time elapsed at the last reading of the clock.
+   *
+   * The clock is read by #start(), #stop(), #get_time() and #check(double).
+   * This function does not read the clock.
+   */
+  Time last_time() const;
 
   /**
    * \brief Check the timer and throw a #ibex::TimeOutException
-   * if the time elapsed exceeds #timeout.
+   * if the time elapsed since #start() exceeds \a timeout.
    *
-   * (add by gch).
+   * To save time, the clock is only read once every #period calls
+   * (starting with the first call after #start()).
    */
-  static void check(double timeout);
+  void check(double timeout);
 
-  inline static Time REAL_TIMELAPSE() { return real_lapse; }
-  inline static double RESIDENT_MEMORY() { return resident_memory; }
-  /* not available yet under WIN32 platform */
-  inline static Time VIRTUAL_TIMELAPSE() { return (virtual_ulapse + virtual_slapse); }
+  /**
+   * \brief Current value of a clock (in seconds, from an arbitrary origin).
+   */
+  static Time now(TimerType type);
 
-  static Time real_lapse;
-  static Time virtual_ulapse;
-  static Time virtual_slapse;
+  /** \brief The clock of this timer. */
+  const TimerType type;
+
+  /** \brief Number of calls to #check(double) between two readings of the clock. */
+  unsigned int period;
+
+  /** \brief Default period: 16. */
+  static const unsigned int default_period;
 
  private:
-  static Time real_time;
-  static Time virtual_utime;
-  static Time virtual_stime;
-  static long resident_memory;
-
-#ifndef _WIN32
-  //  static std::clock_t res;
-  static struct rusage res;
-#endif
-  static struct timeval tp;
+  /* value of the clock when started */
+  Time start_time;
+
+  /* time elapsed at the last reading of the clock */
+  mutable Time lapse;
+
+  bool running;
+
+  /* number of calls to check() since start() */
+  unsigned int nb_checks;
 };
 
+/*============================================ inline implementation ============================================ */
+
+inline Timer::Time Timer::last_time() const {
+	return lapse;
+}
+
+inline void Timer::check(double timeout) {
+	if (nb_checks++ % period!=0) return;
+	if (get_time()>timeout) throw TimeOutException();
+}
+
 } // end namespace ibex
 #endif // __IBEX_TIMER_H__
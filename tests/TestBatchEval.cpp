@@ -0,0 +1,142 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBatchEval.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestBatchEval.h"
+#include "ibex_Function.h"
+#include "ibex_BatchHC4Revise.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * A batch of n boxes of size 2 (in columns), with
+ * different signs and widths.
+ */
+IntervalMatrix batch(int n) {
+	IntervalMatrix X(2,n);
+	for (int k=0; k<n; k++) {
+		double c=-2+4.0*k/n;
+		X[0][k]=Interval(c,c+0.5);
+		X[1][k]=Interval(-c-0.1*k,-c+1);
+	}
+	return X;
+}
+
+IntervalVector column(const IntervalMatrix& X, int k) {
+	IntervalVector x(X.nb_rows());
+	for (int i=0; i<X.nb_rows(); i++) x[i]=X[i][k];
+	return x;
+}
+
+}
+
+void TestBatchEval::supported01() {
+	Variable x,y;
+	Variable v(2);
+	Function f1(x,y,sqr(x)+y);
+	Function f2(x,y,Return(x+y,x-y));
+	Function f3(v,v[0]+v[1]);
+	Function f4(x,y,Return(Return(x,y,true),Return(y,x,true)));
+
+	CPPUNIT_ASSERT(BatchEval::is_supported(f1));
+	CPPUNIT_ASSERT(BatchEval::is_supported(f2));
+	CPPUNIT_ASSERT(!BatchEval::is_supported(f3));
+	CPPUNIT_ASSERT(!BatchEval::is_supported(f4));
+}
+
+void TestBatchEval::eval01() {
+	Variable x,y;
+	Function f(x,y,sqrt(x)*y+exp(sin(x*y))-max(x,sqr(y)));
+	BatchEval e(f);
+
+	// several sizes (to check the storage is resized)
+	for (int n=1; n<=20; n+=9) {
+		IntervalMatrix X=batch(n);
+		IntervalVector r(1);
+		e.eval(X,r);
+		CPPUNIT_ASSERT(r.size()==n);
+		for (int k=0; k<n; k++) {
+			Interval rk=f.eval(column(X,k));
+			CPPUNIT_ASSERT(r[k]==rk);
+			CPPUNIT_ASSERT(e.is_empty(k)==rk.is_empty());
+		}
+	}
+	// some boxes have a negative x (empty image)
+	CPPUNIT_ASSERT(e.is_empty(0));
+}
+
+void TestBatchEval::eval02() {
+	Variable x,y;
+	Function f(x,y,Return(x+y,log(y),x*y));
+	BatchEval e(f);
+
+	int n=10;
+	IntervalMatrix X=batch(n);
+	IntervalMatrix Y(1,1);
+	e.eval_vector(X,Y);
+	CPPUNIT_ASSERT(Y.nb_rows()==3);
+	CPPUNIT_ASSERT(Y.nb_cols()==n);
+	for (int k=0; k<n; k++) {
+		IntervalVector yk=f.eval_vector(column(X,k));
+		if (yk.is_empty())
+			CPPUNIT_ASSERT(Y.col(k).is_empty());
+		else
+			CPPUNIT_ASSERT(Y.col(k)==yk);
+	}
+}
+
+void TestBatchEval::proj01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqrt(y)-x*y);
+	BatchEval e(f);
+	BatchHC4Revise p(e);
+
+	int n=20;
+	IntervalMatrix X=batch(n);
+	Interval z(-1,1);
+	p.proj(z,X);
+
+	IntervalMatrix X0=batch(n);
+	int nb_empty=0;
+	for (int k=0; k<n; k++) {
+		IntervalVector xk=column(X0,k);
+		bool inner=f.backward(z,xk);
+		CPPUNIT_ASSERT(p.is_inner(k)==inner);
+		CPPUNIT_ASSERT(column(X,k)==xk);
+		if (xk.is_empty()) nb_empty++;
+	}
+	// both empty and non-empty boxes are produced
+	CPPUNIT_ASSERT(nb_empty>0 && nb_empty<n);
+}
+
+void TestBatchEval::proj02() {
+	Variable x,y;
+	Function f(x,y,Return(x+y,x-y));
+	BatchEval e(f);
+	BatchHC4Revise p(e);
+
+	int n=8;
+	IntervalMatrix X=batch(n);
+	IntervalVector z(2,Interval(-1,1));
+	p.proj(z,X);
+
+	IntervalMatrix X0=batch(n);
+	for (int k=0; k<n; k++) {
+		IntervalVector xk=column(X0,k);
+		bool inner=f.backward(z,xk);
+		CPPUNIT_ASSERT(p.is_inner(k)==inner);
+		CPPUNIT_ASSERT(column(X,k)==xk);
+	}
+}
+
+} // end namespace ibex
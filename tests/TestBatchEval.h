@@ -0,0 +1,46 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBatchEval.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_BATCH_EVAL_H__
+#define __TEST_BATCH_EVAL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestBatchEval : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestBatchEval);
+		CPPUNIT_TEST(supported01);
+		CPPUNIT_TEST(eval01);
+		CPPUNIT_TEST(eval02);
+		CPPUNIT_TEST(proj01);
+		CPPUNIT_TEST(proj02);
+	CPPUNIT_TEST_SUITE_END();
+
+	// supported functions
+	void supported01();
+	// real-valued function (same result as Eval)
+	void eval01();
+	// vector-valued function
+	void eval02();
+	// real-valued function (same result as HC4Revise)
+	void proj01();
+	// vector-valued function
+	void proj02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBatchEval);
+
+} // end namespace ibex
+#endif // __TEST_BATCH_EVAL_H__
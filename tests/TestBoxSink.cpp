@@ -0,0 +1,149 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBoxSink.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestBoxSink.h"
+#include "ibex_BoxSink.h"
+#include "ibex_Solver.h"
+#include "ibex_Paver.h"
+#include "ibex_CellStack.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_LargestFirst.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcEmpty.h"
+#include "ibex_PdcDiameterLT.h"
+
+#include <cstdio>
+
+using namespace std;
+
+#define TMP_FILE_NAME "__tmp__.box"
+
+namespace ibex {
+
+void TestBoxSink::trace01() {
+	IntervalVector before(2,Interval(0,2));
+	IntervalVector after(2,Interval(0,1));
+
+	vector<IntervalVector> boxes;
+	VectorSink sink(boxes);
+	sink.add(before,after);
+	CPPUNIT_ASSERT(boxes.size()==2);
+	// the volume is calculated with log/exp (not exact)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(3,boxes[0].volume()+boxes[1].volume(),1e-10);
+
+	CountSink count;
+	count.add(before,before);
+	CPPUNIT_ASSERT(count.nb_boxes==0);
+}
+
+void TestBoxSink::ring01() {
+	RingSink ring(3);
+	for (int i=0; i<5; i++)
+		ring.add(IntervalVector(2,Interval(i,i+1)));
+
+	CPPUNIT_ASSERT(ring.nb_boxes==5);
+	CPPUNIT_ASSERT(ring.size()==3);
+	for (int i=0; i<3; i++)
+		CPPUNIT_ASSERT(ring[i]==IntervalVector(2,Interval(i+2,i+3)));
+}
+
+void TestBoxSink::file01() {
+	double _box[][2]={{0,1},{NEG_INFINITY,2},{-1,POS_INFINITY}};
+	IntervalVector box(3,_box);
+	{
+		FileSink file(TMP_FILE_NAME);
+		file.add(box);
+		file.add(IntervalVector(1,Interval(0.1)));
+		file.add(IntervalVector::empty(2));
+	}
+
+	vector<IntervalVector> boxes;
+	VectorSink sink(boxes);
+	CPPUNIT_ASSERT(FileSink::read(TMP_FILE_NAME,sink)==3);
+	CPPUNIT_ASSERT(boxes.size()==3);
+	CPPUNIT_ASSERT(boxes[0]==box);
+	CPPUNIT_ASSERT(boxes[1]==IntervalVector(1,Interval(0.1)));
+	CPPUNIT_ASSERT(boxes[2].size()==2 && boxes[2].is_empty());
+
+	remove(TMP_FILE_NAME);
+}
+
+void TestBoxSink::solver01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x)));
+	CtcFwdBwd ctc(f);
+	RoundRobin bsc(1e-3);
+	CellStack buff;
+	Solver s(ctc,bsc,buff);
+	IntervalVector box(2,Interval(-2,2));
+
+	vector<IntervalVector> sols=s.solve(box);
+	CPPUNIT_ASSERT(sols.size()>0);
+
+	CountSink count;
+	s.solve(box,count);
+	CPPUNIT_ASSERT(count.nb_boxes==sols.size());
+
+	{
+		FileSink file(TMP_FILE_NAME);
+		s.solve(box,file);
+	}
+	vector<IntervalVector> sols2;
+	VectorSink sink(sols2);
+	FileSink::read(TMP_FILE_NAME,sink);
+	CPPUNIT_ASSERT(sols2.size()==sols.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		CPPUNIT_ASSERT(sols2[i]==sols[i]);
+
+	remove(TMP_FILE_NAME);
+}
+
+void TestBoxSink::paver01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	NumConstraint c1(x,y,f(x,y)<=2);
+	NumConstraint c2(x,y,f(x,y)>=1);
+	NumConstraint c3(x,y,f(x,y)>2);
+	NumConstraint c4(x,y,f(x,y)<1);
+	CtcFwdBwd out1(c1), out2(c2), in1(c3), in2(c4);
+	CtcCompo outside(out1,out2);
+	CtcUnion inside(in1,in2);
+	PdcDiameterLT prec(0.1);
+	CtcEmpty boundary(prec);
+	Array<Ctc> ctc(inside,outside,boundary);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc,lf,stack);
+	IntervalVector box(2,Interval(-2,2));
+
+	SubPaving* paving=p.pave(box);
+
+	vector<IntervalVector> boxes[3];
+	VectorSink s0(boxes[0]), s1(boxes[1]), s2(boxes[2]);
+	Array<BoxSink> sinks(s0,s1,s2);
+	p.pave(box,sinks);
+
+	for (int i=0; i<3; i++) {
+		vector<IntervalVector> expected;
+		VectorSink sink(expected);
+		for (vector<pair<IntervalVector,IntervalVector> >::const_iterator it=paving[i].traces.begin(); it!=paving[i].traces.end(); it++)
+			sink.add(it->first,it->second);
+		CPPUNIT_ASSERT(expected.size()>0);
+		CPPUNIT_ASSERT(boxes[i].size()==expected.size());
+		for (unsigned int j=0; j<expected.size(); j++)
+			CPPUNIT_ASSERT(boxes[i][j]==expected[j]);
+	}
+
+	delete[] paving;
+}
+
+} // end namespace ibex
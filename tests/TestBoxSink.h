@@ -0,0 +1,46 @@
+//============================================================================
+//                                  I B E X
+// File        : TestBoxSink.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_BOX_SINK_H__
+#define __TEST_BOX_SINK_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestBoxSink : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestBoxSink);
+		CPPUNIT_TEST(trace01);
+		CPPUNIT_TEST(ring01);
+		CPPUNIT_TEST(file01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(paver01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// a trace is given as the difference of the boxes
+	void trace01();
+	// only the last boxes are kept
+	void ring01();
+	// boxes written and read back
+	void file01();
+	// the solutions given to a sink are the same as the returned ones
+	void solver01();
+	// the paver gives the same traces to sinks as in a subpaving
+	void paver01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBoxSink);
+
+} // end namespace ibex
+#endif // __TEST_BOX_SINK_H__
@@ -0,0 +1,87 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCell.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestCell.h"
+#include "ibex_Cell.h"
+#include "ibex_Bsc.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+class Depth : public Backtrackable {
+public:
+	Depth() : depth(0) { }
+
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		Depth* d1=new Depth();
+		Depth* d2=new Depth();
+		d1->depth=d2->depth=depth+1;
+		return std::pair<Backtrackable*,Backtrackable*>(d1,d2);
+	}
+
+	int depth;
+};
+
+class Dummy : public Backtrackable {
+public:
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new Dummy(),new Dummy());
+	}
+};
+
+}
+
+void TestCell::slot01() {
+	int s1=Cell::slot<Depth>();
+	int s2=Cell::slot<Dummy>();
+	int s3=Cell::slot<BisectedVar>();
+	CPPUNIT_ASSERT(s1>=0 && s2>=0 && s3>=0);
+	CPPUNIT_ASSERT(s1!=s2 && s1!=s3 && s2!=s3);
+	CPPUNIT_ASSERT(Cell::slot<Depth>()==s1);
+}
+
+void TestCell::add01() {
+	Cell c(IntervalVector(2));
+	c.add<Depth>();
+	c.get<Depth>().depth=3;
+	c.add<Depth>(); // no effect
+	CPPUNIT_ASSERT(c.get<Depth>().depth==3);
+	c.add<BisectedVar>();
+	CPPUNIT_ASSERT(c.get<BisectedVar>().var==-1);
+	CPPUNIT_ASSERT(c.get<Depth>().depth==3);
+	CPPUNIT_ASSERT(c.nb_data>Cell::slot<Depth>());
+	CPPUNIT_ASSERT(c.nb_data>Cell::slot<BisectedVar>());
+}
+
+void TestCell::bisect01() {
+	Cell* root=new Cell(IntervalVector(2,Interval(0,1)));
+	root->add<Depth>();
+	root->add<Dummy>();
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second);
+	delete root;
+
+	pair<Cell*,Cell*> p2=p.first->bisect(boxes.first,boxes.second);
+	CPPUNIT_ASSERT(p.second->get<Depth>().depth==1);
+	CPPUNIT_ASSERT(p2.first->get<Depth>().depth==2);
+	CPPUNIT_ASSERT(p2.second->get<Depth>().depth==2);
+	CPPUNIT_ASSERT(&p2.second->get<Dummy>()!=&p.first->get<Dummy>());
+	CPPUNIT_ASSERT(p2.first->box==boxes.first);
+
+	delete p.first;
+	delete p.second;
+	delete p2.first;
+	delete p2.second;
+}
+
+} // end namespace ibex
@@ -0,0 +1,39 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCell.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CELL_H__
+#define __TEST_CELL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCell : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCell);
+		CPPUNIT_TEST(slot01);
+		CPPUNIT_TEST(add01);
+		CPPUNIT_TEST(bisect01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// each class of data has its own slot
+	void slot01();
+	void add01();
+	// the data of subcells are obtained by down()
+	void bisect01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCell);
+
+} // end namespace ibex
+#endif // __TEST_CELL_H__
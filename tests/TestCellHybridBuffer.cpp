@@ -0,0 +1,185 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellHybridBuffer.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestCellHybridBuffer.h"
+#include "ibex_CellHybridBuffer.h"
+#include "ibex_CellStack.h"
+#include "ibex_Solver.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcFwdBwd.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* The lower bound of the first component */
+class LbCost : public CostFunc<Cell> {
+public:
+	double cost(const Cell& c) const { return c.box[0].lb(); }
+};
+
+/* The same cost for all cells */
+class ConstCost : public CostFunc<Cell> {
+public:
+	double cost(const Cell&) const { return 0; }
+};
+
+/* A subcell of root with box [lb,lb+1] */
+Cell* subcell(Cell& root, double lb) {
+	IntervalVector box(1,Interval(lb,lb+1));
+	pair<Cell*,Cell*> p=root.bisect(box,box);
+	delete p.second;
+	return p.first;
+}
+
+}
+
+void TestCellHybridBuffer::order01() {
+	LbCost cost;
+	Cell root(IntervalVector(1,Interval(0,1000)));
+
+	// a large limit (no spill) and a tiny limit (spill)
+	size_t limits[2]={ 1<<30, 1 };
+
+	for (int k=0; k<2; k++) {
+		CellHybridBuffer buff(cost,limits[k]);
+		for (int i=0; i<500; i++) {
+			buff.push(subcell(root,(i*389)%1000)); // shuffled lower bounds
+			// interleave a few pops
+			if (i%7==0) delete buff.pop();
+		}
+		CPPUNIT_ASSERT(k==0 || buff.nb_spilled()>0);
+		CPPUNIT_ASSERT(k==1 || buff.nb_spilled()==0);
+		CPPUNIT_ASSERT(buff.nb_in_memory()+buff.nb_spilled()==buff.size());
+
+		double last=-1;
+		while (!buff.empty()) {
+			Cell* c=buff.pop();
+			CPPUNIT_ASSERT(c->box[0].lb()>=last);
+			last=c->box[0].lb();
+			delete c;
+		}
+	}
+}
+
+void TestCellHybridBuffer::order02() {
+	ConstCost cost;
+	Cell root(IntervalVector(1,Interval(0,1000)));
+	CellHybridBuffer buff(cost,1);
+	CellStack stack;
+
+	for (int i=0; i<100; i++) {
+		buff.push(subcell(root,i));
+		stack.push(subcell(root,i));
+		if (i%3==0) {
+			Cell* c1=buff.pop();
+			Cell* c2=stack.pop();
+			CPPUNIT_ASSERT(c1->box==c2->box);
+			delete c1;
+			delete c2;
+		}
+	}
+	while (!stack.empty()) {
+		Cell* c1=buff.pop();
+		Cell* c2=stack.pop();
+		CPPUNIT_ASSERT(c1->box==c2->box);
+		delete c1;
+		delete c2;
+	}
+	CPPUNIT_ASSERT(buff.empty());
+}
+
+void TestCellHybridBuffer::data01() {
+	LbCost cost;
+	Cell root(IntervalVector(1,Interval(0,100)));
+	root.add<BisectedVar>();
+
+	CellHybridBuffer buff(cost,1);
+	for (int i=0; i<50; i++) {
+		pair<Cell*,Cell*> p=root.bisect(IntervalVector(1,Interval(i,i+1)),IntervalVector(1,Interval(100-i,101-i)));
+		p.first->get<BisectedVar>().var=i;
+		p.second->get<BisectedVar>().var=100-i;
+		buff.push(p.first);
+		buff.push(p.second);
+	}
+	CPPUNIT_ASSERT(buff.nb_spilled()>0);
+
+	for (int i=0; i<100; i++) {
+		Cell* c=buff.pop();
+		CPPUNIT_ASSERT(c->get<BisectedVar>().var==(int) c->box[0].lb());
+		delete c;
+	}
+	CPPUNIT_ASSERT(buff.empty());
+
+	// the buffer can be reused after a flush
+	buff.push(subcell(root,0));
+	buff.flush();
+	CPPUNIT_ASSERT(buff.empty());
+}
+
+void TestCellHybridBuffer::solver01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x)));
+	CtcFwdBwd ctc(f);
+	RoundRobin bsc(1e-3);
+	IntervalVector box(2,Interval(-2,2));
+
+	CellStack stack;
+	Solver s1(ctc,bsc,stack);
+	vector<IntervalVector> sols1=s1.solve(box);
+
+	LbCost cost;
+	CellHybridBuffer buff(cost,1024);
+	Solver s2(ctc,bsc,buff);
+	vector<IntervalVector> sols2=s2.solve(box);
+
+	CPPUNIT_ASSERT(sols1.size()==sols2.size());
+	CPPUNIT_ASSERT(s1.nb_cells==s2.nb_cells);
+	// best-first on x
+	for (unsigned int i=1; i<sols2.size(); i++)
+		CPPUNIT_ASSERT(sols2[i-1][0].lb()<=sols2[i][0].lb());
+}
+
+void TestCellHybridBuffer::file01() {
+	LbCost cost;
+	Cell root(IntervalVector(1,Interval(0,2000)));
+	CellHybridBuffer buff(cost,1);
+
+	// cells that remain in the file until the end
+	for (int i=0; i<50; i++)
+		buff.push(subcell(root,1000+i));
+	CPPUNIT_ASSERT(buff.nb_spilled()>0);
+	size_t size=buff.file_size();
+
+	// better cells are spilled and read back many times
+	for (int i=0; i<1000; i++) {
+		for (int j=0; j<3; j++)
+			buff.push(subcell(root,(i*7+j*31)%100));
+		for (int j=0; j<3; j++) {
+			Cell* c=buff.pop();
+			CPPUNIT_ASSERT(c->box[0].lb()<1000);
+			delete c;
+		}
+	}
+	CPPUNIT_ASSERT(buff.file_size()<=2*size);
+
+	double last=-1;
+	while (!buff.empty()) {
+		Cell* c=buff.pop();
+		CPPUNIT_ASSERT(c->box[0].lb()>=last);
+		last=c->box[0].lb();
+		delete c;
+	}
+	CPPUNIT_ASSERT(last==1049);
+}
+
+} // end namespace ibex
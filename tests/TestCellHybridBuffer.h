@@ -0,0 +1,46 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellHybridBuffer.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CELL_HYBRID_BUFFER_H__
+#define __TEST_CELL_HYBRID_BUFFER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellHybridBuffer : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellHybridBuffer);
+		CPPUNIT_TEST(order01);
+		CPPUNIT_TEST(order02);
+		CPPUNIT_TEST(data01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(file01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// cells are popped by increasing cost, with or without spill
+	void order01();
+	// same order as CellStack with a constant cost
+	void order02();
+	// the data of a cell is read back from the file
+	void data01();
+	// same solutions as with a CellStack
+	void solver01();
+	// the space of the cells read back is reused
+	void file01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellHybridBuffer);
+
+} // end namespace ibex
+#endif // __TEST_CELL_HYBRID_BUFFER_H__
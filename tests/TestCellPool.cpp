@@ -0,0 +1,173 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellPool.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestCellPool.h"
+#include "ibex_CellPool.h"
+#include "ibex_Cell.h"
+#include "ibex_Bsc.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcFwdBwd.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCellPool::bisect01() {
+	CellPool pool;
+	IntervalVector box(2,Interval(0,2));
+	Cell* root=pool.new_cell(box);
+	root->add<BisectedVar>();
+	CPPUNIT_ASSERT(root->box==box);
+	CPPUNIT_ASSERT(root->get<BisectedVar>().var==-1);
+
+	pair<IntervalVector,IntervalVector> p=box.bisect(0);
+	pair<Cell*,Cell*> c=root->bisect(p.first,p.second);
+	c.first->get<BisectedVar>().var=0;
+	c.second->get<BisectedVar>().var=1;
+	delete root;
+
+	CPPUNIT_ASSERT(c.first->box==p.first);
+	CPPUNIT_ASSERT(c.second->box==p.second);
+	CPPUNIT_ASSERT(c.first->get<BisectedVar>().var==0);
+	CPPUNIT_ASSERT(c.second->get<BisectedVar>().var==1);
+	delete c.first;
+	delete c.second;
+}
+
+void TestCellPool::recycle01() {
+	CellPool pool;
+	IntervalVector box(2,Interval(0,2));
+	pair<IntervalVector,IntervalVector> p=box.bisect(0);
+
+	Cell* root=pool.new_cell(box);
+	root->add<BisectedVar>();
+	unsigned long n=pool.nb_avoided();
+
+	// 2 cells, 2 data arrays and 2 data (small boxes are stored in the cells)
+	pair<Cell*,Cell*> c=root->bisect(p.first,p.second);
+	CPPUNIT_ASSERT(pool.nb_avoided()==n+6);
+
+	delete root;
+	delete c.second;
+	// the memory of the 2 deleted cells is reused
+	pair<Cell*,Cell*> c2=c.first->bisect(p.first,p.second);
+	CPPUNIT_ASSERT(pool.nb_avoided()==n+12);
+
+	delete c.first;
+	delete c2.first;
+	delete c2.second;
+}
+
+void TestCellPool::recycle02() {
+	CellPool pool;
+	IntervalVector box(10,Interval(0,2));
+	pair<IntervalVector,IntervalVector> p=box.bisect(0);
+
+	Cell* root=pool.new_cell(box);
+	root->add<BisectedVar>();
+	unsigned long n=pool.nb_avoided();
+
+	// 2 cells, 2 boxes, 2 data arrays and 2 data
+	pair<Cell*,Cell*> c=root->bisect(p.first,p.second);
+	CPPUNIT_ASSERT(pool.nb_avoided()==n+8);
+
+	delete root;
+	delete c.second;
+	// the memory of the 2 deleted cells is reused
+	pair<Cell*,Cell*> c2=c.first->bisect(p.first,p.second);
+	CPPUNIT_ASSERT(pool.nb_avoided()==n+16);
+
+	delete c.first;
+	delete c2.first;
+	delete c2.second;
+}
+
+#if __cplusplus >= 201103L
+void TestCellPool::move01() {
+	CellPool pool;
+	IntervalVector box(10,Interval(0,2));
+	Cell* c=pool.new_cell(box);
+
+	// the components of the cell's box belong to the pool: they are copied
+	IntervalVector x(std::move(c->box));
+	CPPUNIT_ASSERT(x==box);
+	CPPUNIT_ASSERT(&x[0]!=&c->box[0]);
+
+	IntervalVector y(3);
+	y=std::move(c->box);
+	CPPUNIT_ASSERT(y==box);
+	CPPUNIT_ASSERT(&y[0]!=&c->box[0]);
+	CPPUNIT_ASSERT(c->box==box);
+
+	unsigned long n=pool.nb_avoided();
+	delete c;
+	// the cell and its box are given back to the pool
+	Cell* c2=pool.new_cell(box);
+	CPPUNIT_ASSERT(pool.nb_avoided()==n+2);
+	delete c2;
+}
+#endif
+
+void TestCellPool::release01() {
+	CellPool pool;
+	Cell* root=pool.new_cell(IntervalVector(3));
+	root->add<BisectedVar>();
+	CPPUNIT_ASSERT(!pool.release());
+	delete root;
+	CPPUNIT_ASSERT(pool.release());
+
+	// the pool can be used again
+	root=pool.new_cell(IntervalVector(3));
+	CPPUNIT_ASSERT(root->box.size()==3);
+	delete root;
+}
+
+void TestCellPool::orphan01() {
+	CellPool* pool=new CellPool();
+	Cell* root=pool->new_cell(IntervalVector(2));
+	root->add<BisectedVar>();
+	pair<Cell*,Cell*> c=root->bisect(IntervalVector(2),IntervalVector(2));
+	delete pool;
+	delete root;
+	delete c.first;
+	delete c.second;
+}
+
+void TestCellPool::disabled01() {
+	CellPool pool;
+	pool.enabled=false;
+	Cell* root=pool.new_cell(IntervalVector(2));
+	root->add<BisectedVar>();
+	pair<Cell*,Cell*> c=root->bisect(IntervalVector(2),IntervalVector(2));
+	delete root;
+	delete c.first;
+	delete c.second;
+	CPPUNIT_ASSERT(pool.nb_avoided()==0);
+}
+
+void TestCellPool::solver01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x)));
+	CtcFwdBwd ctc(f);
+	RoundRobin bsc(1e-3);
+	CellStack buff;
+	Solver s(ctc,bsc,buff);
+	s.solve(IntervalVector(2,Interval(-2,2)));
+	CPPUNIT_ASSERT(s.nb_cells>0);
+	// each cell comes with a box and data, all obtained from the pool
+	// (except the first objects of each slab)
+	CPPUNIT_ASSERT(s.pool.nb_avoided()>(unsigned long) s.nb_cells);
+	// the search is over: the slabs have been given back
+	CPPUNIT_ASSERT(s.pool.release());
+}
+
+} // end namespace ibex
@@ -0,0 +1,57 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCellPool.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CELL_POOL_H__
+#define __TEST_CELL_POOL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellPool : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellPool);
+		CPPUNIT_TEST(bisect01);
+		CPPUNIT_TEST(recycle01);
+		CPPUNIT_TEST(recycle02);
+#if __cplusplus >= 201103L
+		CPPUNIT_TEST(move01);
+#endif
+		CPPUNIT_TEST(release01);
+		CPPUNIT_TEST(orphan01);
+		CPPUNIT_TEST(disabled01);
+		CPPUNIT_TEST(solver01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// subcells have the right boxes and data
+	void bisect01();
+	// the memory of deleted cells is reused
+	void recycle01(); // small boxes (stored inline)
+	void recycle02(); // large boxes (allocated by the pool)
+#if __cplusplus >= 201103L
+	// a box moved out of a pooled cell is copied
+	void move01();
+#endif
+	// slabs are given back only when all cells are deleted
+	void release01();
+	// cells deleted after the pool
+	void orphan01();
+	void disabled01();
+	// the solver recycles its cells
+	void solver01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellPool);
+
+} // end namespace ibex
+#endif // __TEST_CELL_POOL_H__
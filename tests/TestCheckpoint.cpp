@@ -0,0 +1,355 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCheckpoint.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestCheckpoint.h"
+#include "ibex_Checkpoint.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_CellHybridBuffer.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcFwdBwd.h"
+
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+#define TMP_FILE_NAME "__tmp__.ckp"
+
+namespace ibex {
+
+void TestCheckpoint::cell01() {
+	IntervalVector box(2,Interval(0,2));
+	Cell root(box);
+	root.add<BisectedVar>();
+
+	pair<IntervalVector,IntervalVector> p=box.bisect(1);
+	pair<Cell*,Cell*> c=root.bisect(p.first,p.second);
+	c.second->get<BisectedVar>().var=1;
+
+	stringstream ss;
+	c.second->save(ss);
+
+	vector<int> slots(1,Cell::slot<BisectedVar>());
+	Cell* c2=root.load(ss,slots);
+	CPPUNIT_ASSERT(c2->box==p.second);
+	CPPUNIT_ASSERT(c2->get<BisectedVar>().var==1);
+	CPPUNIT_ASSERT(root.get<BisectedVar>().var==-1);
+
+	delete c.first;
+	delete c.second;
+	delete c2;
+}
+
+namespace {
+
+/* The lower bound of the first component */
+class LbCost : public CostFunc<Cell> {
+public:
+	double cost(const Cell& c) const { return c.box[0].lb(); }
+};
+
+/* Push the subcells of root with boxes [lb,lb+1] (lb=(i*7)%n) */
+void fill(CellBuffer& buff, Cell& root, int n) {
+	for (int i=0; i<n; i++) {
+		IntervalVector box(1,Interval((i*7)%n,(i*7)%n+1));
+		pair<Cell*,Cell*> p=root.bisect(box,box);
+		delete p.second;
+		buff.push(p.first);
+	}
+}
+
+/* Pop all the cells of the two buffers and check they are the same */
+bool same(CellBuffer& b1, CellBuffer& b2) {
+	bool ok=b1.size()==b2.size();
+	while (ok && !b1.empty()) {
+		Cell* c1=b1.pop();
+		Cell* c2=b2.pop();
+		ok=c1->box==c2->box;
+		delete c1;
+		delete c2;
+	}
+	b1.flush();
+	b2.flush();
+	return ok;
+}
+
+}
+
+void TestCheckpoint::buffer01() {
+	LbCost cost;
+	Cell root(IntervalVector(1,Interval(0,100)));
+
+	CellStack s1,s2,s3;
+	fill(s1,root,20);
+	fill(s2,root,20);
+	// a buffer with cells in memory and in the file
+	CellHybridBuffer h1(cost,1),h2(cost,1),h3(cost,1);
+	fill(h1,root,20);
+	fill(h2,root,20);
+	CPPUNIT_ASSERT(h1.nb_spilled()>0);
+
+	CheckpointWriter w(TMP_FILE_NAME,0);
+	w.write(s1);
+	w.write(h1);
+	w.close();
+
+	CheckpointReader r(TMP_FILE_NAME,0);
+	r.read(s3,root);
+	r.read(h3,root);
+	remove(TMP_FILE_NAME);
+
+	// the buffers written are not modified
+	CPPUNIT_ASSERT(same(s1,s2));
+	CPPUNIT_ASSERT(same(h1,h2));
+
+	// the buffers read give the same cells in the same order
+	fill(s2,root,20);
+	fill(h2,root,20);
+	CPPUNIT_ASSERT(same(s3,s2));
+	CPPUNIT_ASSERT(same(h3,h2));
+}
+
+void TestCheckpoint::buffer02() {
+#ifndef _WIN32
+	LbCost cost;
+	Cell root(IntervalVector(1,Interval(0,100)));
+
+	CellHybridBuffer h1(cost,1),h2(cost,1),h3(cost,1);
+	fill(h1,root,20);
+	fill(h2,root,20);
+
+	// the child process writes the buffer once the parent has modified it
+	int fds[2];
+	CPPUNIT_ASSERT(pipe(fds)==0);
+
+	BackgroundCheckpoint background;
+	if (background.begin(h1)) {
+		close(fds[1]);
+		char c;
+		bool ok=read(fds[0],&c,1)>=0;
+		try {
+			CheckpointWriter w(TMP_FILE_NAME,0);
+			w.write(h1);
+			w.close();
+		} catch (...) {
+			ok=false;
+		}
+		background.end(ok);
+	}
+	close(fds[0]);
+
+	// the space of the cells removed is not reused for the new ones
+	while (!h1.empty()) delete h1.pop();
+	fill(h1,root,30);
+	close(fds[1]);
+	background.wait();
+	h1.flush();
+
+	CheckpointReader r(TMP_FILE_NAME,0);
+	r.read(h3,root);
+	remove(TMP_FILE_NAME);
+	CPPUNIT_ASSERT(same(h3,h2));
+#endif
+}
+
+namespace {
+
+class Problem {
+public:
+	Problem() : f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x))), ctc(f), bsc(1e-3), s(ctc,bsc,buff) { }
+	Variable x,y;
+	Function f;
+	CtcFwdBwd ctc;
+	RoundRobin bsc;
+	CellStack buff;
+	Solver s;
+};
+
+}
+
+void TestCheckpoint::solver01() {
+	IntervalVector box(2,Interval(-2,2));
+
+	Problem p1;
+	vector<IntervalVector> sols=p1.s.solve(box);
+
+	// stop the search after a few cells
+	Problem p2;
+	p2.s.cell_limit=100;
+	vector<IntervalVector> sols2;
+	p2.s.start(box);
+	while (p2.s.next(sols2)) { }
+	CPPUNIT_ASSERT(!p2.s.buffer.empty());
+	p2.s.save(TMP_FILE_NAME,sols2);
+
+	Problem p3;
+	vector<IntervalVector> sols3;
+	p3.s.resume(TMP_FILE_NAME,sols3);
+	CPPUNIT_ASSERT(sols3.size()==sols2.size());
+	CPPUNIT_ASSERT(p3.s.nb_cells==p2.s.nb_cells);
+	CPPUNIT_ASSERT(p3.s.buffer.size()==p2.s.buffer.size());
+	while (p3.s.next(sols3)) { }
+
+	// same solutions, in the same order
+	CPPUNIT_ASSERT(sols3.size()==sols.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		CPPUNIT_ASSERT(sols3[i]==sols[i]);
+	CPPUNIT_ASSERT(p3.s.nb_cells==p1.s.nb_cells);
+
+	remove(TMP_FILE_NAME);
+}
+
+void TestCheckpoint::solver02() {
+	IntervalVector box(2,Interval(-2,2));
+
+	Problem p1;
+	p1.s.checkpoint_file=TMP_FILE_NAME;
+	p1.s.checkpoint_period=0;  // at each node
+	vector<IntervalVector> sols=p1.s.solve(box);
+
+	// the last checkpoint is valid
+	Problem p2;
+	vector<IntervalVector> sols2;
+	p2.s.resume(TMP_FILE_NAME,sols2);
+	while (p2.s.next(sols2)) { }
+	CPPUNIT_ASSERT(sols2.size()==sols.size());
+
+	// no temporary file left
+	ifstream tmp(TMP_FILE_NAME ".tmp");
+	CPPUNIT_ASSERT(!tmp.is_open());
+
+	remove(TMP_FILE_NAME);
+}
+
+namespace {
+
+/* Data that cannot be saved */
+class Unsavable : public Backtrackable {
+public:
+	pair<Backtrackable*,Backtrackable*> down() { return make_pair(new Unsavable(),new Unsavable()); }
+	void save(ostream&) const { throw runtime_error("cannot save"); }
+};
+
+class CtcUnsavable : public CtcFwdBwd {
+public:
+	CtcUnsavable(Function& f) : CtcFwdBwd(f) { }
+	void add_backtrackable(Cell& root) { root.add<Unsavable>(); }
+};
+
+}
+
+void TestCheckpoint::solver03() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x)));
+	CtcUnsavable ctc(f);
+	RoundRobin bsc(1e-3);
+	CellStack buff;
+	Solver s(ctc,bsc,buff);
+	s.checkpoint_file=TMP_FILE_NAME;
+	s.checkpoint_period=0;
+#ifdef _WIN32
+	CPPUNIT_ASSERT_THROW(s.solve(IntervalVector(2,Interval(-2,2))), runtime_error);
+#else
+	// the failure of the child process is reported to this process
+	CPPUNIT_ASSERT_THROW(s.solve(IntervalVector(2,Interval(-2,2))), CheckpointException);
+#endif
+	ifstream tmp(TMP_FILE_NAME);
+	CPPUNIT_ASSERT(!tmp.is_open());
+	ifstream tmp2(TMP_FILE_NAME ".tmp");
+	CPPUNIT_ASSERT(!tmp2.is_open());
+}
+
+void TestCheckpoint::error01() {
+	Problem p;
+	vector<IntervalVector> sols;
+	remove(TMP_FILE_NAME);
+	CPPUNIT_ASSERT_THROW(p.s.resume(TMP_FILE_NAME,sols), CheckpointException);
+
+	ofstream os(TMP_FILE_NAME);
+	os << "not a checkpoint";
+	os.close();
+	CPPUNIT_ASSERT_THROW(p.s.resume(TMP_FILE_NAME,sols), CheckpointException);
+
+	// truncated file
+	p.s.start(IntervalVector(2,Interval(-2,2)));
+	p.s.save(TMP_FILE_NAME,sols);
+	ifstream is(TMP_FILE_NAME, ios::binary);
+	string content((istreambuf_iterator<char>(is)), istreambuf_iterator<char>());
+	is.close();
+	ofstream os2(TMP_FILE_NAME, ios::binary);
+	os2.write(content.c_str(), content.size()-4);
+	os2.close();
+	CPPUNIT_ASSERT_THROW(p.s.resume(TMP_FILE_NAME,sols), CheckpointException);
+	CPPUNIT_ASSERT(p.s.buffer.empty());
+
+	remove(TMP_FILE_NAME);
+}
+
+namespace {
+
+/* A buffer that does not implement visit() */
+class NoVisitBuffer : public CellStack {
+public:
+	void visit(CellVisitor& v) const { CellBuffer::visit(v); }
+};
+
+}
+
+void TestCheckpoint::error02() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x)));
+	CtcFwdBwd ctc(f);
+	RoundRobin bsc(1e-3);
+	NoVisitBuffer buff;
+	Solver s(ctc,bsc,buff);
+	s.start(IntervalVector(2,Interval(-2,2)));
+	CPPUNIT_ASSERT_THROW(s.save(TMP_FILE_NAME,vector<IntervalVector>()), CheckpointException);
+
+	// the search can go on
+	vector<IntervalVector> sols;
+	while (s.next(sols)) { }
+	CPPUNIT_ASSERT(!sols.empty());
+
+	ifstream tmp(TMP_FILE_NAME);
+	CPPUNIT_ASSERT(!tmp.is_open());
+}
+
+void TestCheckpoint::error03() {
+	Cell root(IntervalVector(1,Interval(0,100)));
+	root.add<BisectedVar>();
+	CellStack buff;
+
+	// a huge name of data class
+	CheckpointWriter w(TMP_FILE_NAME,0);
+	w.write(1);
+	w.write(1<<30);
+	w.close();
+	CheckpointReader r(TMP_FILE_NAME,0);
+	CPPUNIT_ASSERT_THROW(r.read(buff,root), CheckpointException);
+
+	// a huge box
+	CheckpointWriter w2(TMP_FILE_NAME,0);
+	w2.write(1<<30);
+	w2.close();
+	CheckpointReader r2(TMP_FILE_NAME,0);
+	CPPUNIT_ASSERT_THROW(r2.read_box(), CheckpointException);
+
+	remove(TMP_FILE_NAME);
+	CPPUNIT_ASSERT(buff.empty());
+}
+
+} // end namespace ibex
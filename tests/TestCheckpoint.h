@@ -0,0 +1,58 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCheckpoint.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CHECKPOINT_H__
+#define __TEST_CHECKPOINT_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCheckpoint : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCheckpoint);
+		CPPUNIT_TEST(cell01);
+		CPPUNIT_TEST(buffer01);
+		CPPUNIT_TEST(buffer02);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(solver02);
+		CPPUNIT_TEST(solver03);
+		CPPUNIT_TEST(error01);
+		CPPUNIT_TEST(error02);
+		CPPUNIT_TEST(error03);
+	CPPUNIT_TEST_SUITE_END();
+
+	// a cell is read with its box and its data
+	void cell01();
+	// a buffer is written without being modified, and read in the same order
+	void buffer01();
+	// a buffer written in the background is modified meanwhile
+	void buffer02();
+	// a search stopped, saved and resumed gives the same solutions
+	void solver01();
+	// periodic checkpoints
+	void solver02();
+	// a checkpoint that fails in the background
+	void solver03();
+	// missing or invalid file
+	void error01();
+	// a buffer that cannot be visited
+	void error02();
+	// sizes out of the bounds of the file
+	void error03();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCheckpoint);
+
+} // end namespace ibex
+#endif // __TEST_CHECKPOINT_H__
@@ -42,5 +42,26 @@ void TestCtcFwdBwd::atan2_issue134() {
 	check(box[2],Interval::HALF_PI);
 }
 
+void TestCtcFwdBwd::centered01() {
+	Variable x;
+	Function f(x,sqr(x)-x);
+
+	IntervalVector box(1,Interval(0.9,1.1));
+	CtcFwdBwd ctc(f,Interval(0.13,0.2));
+	ctc.contract(box);
+	CPPUNIT_ASSERT(!box.is_empty());
+
+	// the centered form [-0.12,0.12] does not intersect [0.13,0.2]
+	box[0]=Interval(0.9,1.1);
+	CtcFwdBwd ctc2(f,Interval(0.13,0.2),Function::CENTERED_NATURAL);
+	ctc2.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	// the centered form is included in [-0.2,0.2]: inactive constraint
+	box[0]=Interval(0.9,1.1);
+	CtcFwdBwd ctc3(f,Interval(-0.2,0.2),Function::CENTERED_NATURAL);
+	ctc3.contract(box);
+	CPPUNIT_ASSERT(box==IntervalVector(1,Interval(0.9,1.1)));
+}
 
 } // namespace ibex
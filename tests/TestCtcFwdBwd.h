@@ -23,10 +23,12 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcFwdBwd);
 	CPPUNIT_TEST(sqrt_issue28);
 	CPPUNIT_TEST(atan2_issue134);
+	CPPUNIT_TEST(centered01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void sqrt_issue28();
 	void atan2_issue134();
+	void centered01();
 
 };
 
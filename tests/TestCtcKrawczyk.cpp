@@ -0,0 +1,168 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcKrawczyk.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestCtcKrawczyk.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcProfile.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+#include "ibex_Solver.h"
+#include "ibex_Cell.h"
+#include <new>
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtcKrawczyk::contract01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	CtcKrawczyk ctc(f);
+
+	double _box[][2] = { {0.705,0.71}, {0.705,0.71} };
+	IntervalVector box(2,_box);
+	ctc.contract(box);
+
+	Vector sol(2,::sqrt(2)/2);
+	CPPUNIT_ASSERT(box.contains(sol));
+	CPPUNIT_ASSERT(box.max_diam()<1e-10);
+	CPPUNIT_ASSERT(ctc.nb_precond>=1);
+}
+
+void TestCtcKrawczyk::contract02() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	CtcKrawczyk ctc(f,CtcKrawczyk::KRAWCZYK);
+
+	double _box[][2] = { {0.705,0.71}, {0.705,0.71} };
+	IntervalVector box(2,_box);
+	ctc.contract(box);
+
+	Vector sol(2,::sqrt(2)/2);
+	CPPUNIT_ASSERT(box.contains(sol));
+	CPPUNIT_ASSERT(box.max_diam()<1e-10);
+}
+
+void TestCtcKrawczyk::empty01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	CtcKrawczyk ctc(f);
+
+	double _box[][2] = { {0.7,0.705}, {0.74,0.745} };
+	IntervalVector box(2,_box);
+	ctc.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestCtcKrawczyk::solver01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x)));
+	CtcFwdBwd fwdbwd(f);
+	IntervalVector init_box(2,Interval(-2,2));
+
+	// (the contractor is applied on large boxes, which are bisected)
+	// the preconditioner is recalculated at each step
+	CtcKrawczyk krawczyk1(f,CtcKrawczyk::HANSEN_SENGUPTA,POS_INFINITY,default_newton_prec,default_gauss_seidel_ratio,2);
+	CtcCompo compo1(fwdbwd,krawczyk1);
+	RoundRobin bsc1(1e-8);
+	CellStack buff1;
+	Solver s1(compo1,bsc1,buff1);
+	vector<IntervalVector> sols1=s1.solve(init_box);
+
+	// the preconditioner is inherited by the subcells
+	CtcKrawczyk krawczyk2(f,CtcKrawczyk::HANSEN_SENGUPTA,POS_INFINITY);
+	CtcCompo compo2(fwdbwd,krawczyk2);
+	RoundRobin bsc2(1e-8);
+	CellStack buff2;
+	Solver s2(compo2,bsc2,buff2);
+	vector<IntervalVector> sols2=s2.solve(init_box);
+
+	CPPUNIT_ASSERT(sols1.size()>0);
+	CPPUNIT_ASSERT(sols1.size()==sols2.size());
+	for (unsigned int i=0; i<sols1.size(); i++) {
+		CPPUNIT_ASSERT(sols1[i].max_diam()<1e-8);
+		CPPUNIT_ASSERT(sols1[i].intersects(sols2[i]));
+	}
+	CPPUNIT_ASSERT(krawczyk2.nb_precond<krawczyk1.nb_precond);
+}
+
+void TestCtcKrawczyk::compo01() {
+	Variable x,y;
+	Function f1(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	Function f2(x,y,Return(x-y,sqr(x)+sqr(y)-1));
+
+	// the preconditioners are never recalculated once calculated
+	CtcKrawczyk krawczyk1(f1,CtcKrawczyk::HANSEN_SENGUPTA,CtcKrawczyk::default_ceil,default_newton_prec,default_gauss_seidel_ratio,0);
+	CtcKrawczyk krawczyk2(f2,CtcKrawczyk::KRAWCZYK,CtcKrawczyk::default_ceil,default_newton_prec,default_gauss_seidel_ratio,0);
+	CtcCompo compo(krawczyk1,krawczyk2);
+	Ctc& ctc=compo;
+
+	double _box[][2] = { {0.705,0.71}, {0.705,0.71} };
+	Cell root(IntervalVector(2,_box));
+	ctc.add_backtrackable(root);
+
+	for (int i=0; i<3; i++)
+		ctc.contract(root);
+
+	Vector sol(2,::sqrt(2)/2);
+	CPPUNIT_ASSERT(root.box.contains(sol));
+	CPPUNIT_ASSERT(krawczyk1.nb_precond==1);
+	CPPUNIT_ASSERT(krawczyk2.nb_precond==1);
+}
+
+void TestCtcKrawczyk::profile01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+
+	CtcKrawczyk krawczyk(f,CtcKrawczyk::HANSEN_SENGUPTA,CtcKrawczyk::default_ceil,default_newton_prec,default_gauss_seidel_ratio,0);
+	CtcProfile profile(krawczyk);
+	Ctc& ctc=profile;
+
+	double _box[][2] = { {0.705,0.71}, {0.705,0.71} };
+	Cell root(IntervalVector(2,_box));
+	ctc.add_backtrackable(root);
+
+	for (int i=0; i<3; i++)
+		ctc.contract(root);
+
+	Vector sol(2,::sqrt(2)/2);
+	CPPUNIT_ASSERT(root.box.contains(sol));
+	CPPUNIT_ASSERT(krawczyk.nb_precond==1);
+}
+
+void TestCtcKrawczyk::reuse01() {
+	Variable x,y;
+	Function f1(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	Function f2(x,y,Return(x-y,sqr(x)+sqr(y)-1));
+
+	double _box[][2] = { {0.705,0.71}, {0.705,0.71} };
+	Cell root(IntervalVector(2,_box));
+
+	// the contractors are built in the same memory
+	double* mem=new double[sizeof(CtcKrawczyk)/sizeof(double)+1];
+
+	CtcKrawczyk* ctc=new (mem) CtcKrawczyk(f1,CtcKrawczyk::HANSEN_SENGUPTA,CtcKrawczyk::default_ceil,default_newton_prec,default_gauss_seidel_ratio,0);
+	ctc->add_backtrackable(root);
+	((Ctc*) ctc)->contract(root);
+	CPPUNIT_ASSERT(ctc->nb_precond==1);
+	ctc->~CtcKrawczyk();
+
+	// the preconditioner of f1 is not valid for f2 (rows swapped)
+	ctc=new (mem) CtcKrawczyk(f2,CtcKrawczyk::HANSEN_SENGUPTA,CtcKrawczyk::default_ceil,default_newton_prec,default_gauss_seidel_ratio,0);
+	((Ctc*) ctc)->contract(root);
+	CPPUNIT_ASSERT(ctc->nb_precond==1);
+	ctc->~CtcKrawczyk();
+
+	delete[] mem;
+}
+
+} // end namespace ibex
@@ -0,0 +1,55 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcKrawczyk.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_KRAWCZYK_H__
+#define __TEST_CTC_KRAWCZYK_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_CtcKrawczyk.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcKrawczyk : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcKrawczyk);
+		CPPUNIT_TEST(contract01);
+		CPPUNIT_TEST(contract02);
+		CPPUNIT_TEST(empty01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(compo01);
+		CPPUNIT_TEST(profile01);
+		CPPUNIT_TEST(reuse01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// contraction around a solution (Hansen-Sengupta)
+	void contract01();
+	// contraction around a solution (Krawczyk)
+	void contract02();
+	// no solution in the box
+	void empty01();
+	// the preconditioner is inherited by the subcells
+	void solver01();
+	// two contractors applied on the same cell keep their own preconditioner
+	void compo01();
+	// the preconditioner is also kept when the contractor is profiled
+	void profile01();
+	// a contractor created at the address of a deleted one does not
+	// take its preconditioner
+	void reuse01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcKrawczyk);
+
+} // end namespace ibex
+#endif // __TEST_CTC_KRAWCZYK_H__
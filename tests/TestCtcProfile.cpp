@@ -0,0 +1,165 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcProfile.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestCtcProfile.h"
+#include "ibex_CtcProfile.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcIdentity.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_Thread.h"
+
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cmath>
+#include <set>
+
+using namespace std;
+
+#define TMP_FILE_NAME "__tmp__.json"
+
+namespace ibex {
+
+void TestCtcProfile::contract01() {
+	Variable x;
+	NumConstraint ctr(x,x<=1);
+	CtcFwdBwd c(ctr);
+	CtcProfile p(c,"leq",1);
+
+	IntervalVector box(1,Interval(0,4));
+	p.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box[0],Interval(0,1),1e-12));
+
+	box[0]=Interval(-2,2);
+	p.contract(box);
+
+	box[0]=Interval(2,3);
+	p.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	CPPUNIT_ASSERT(p.nb_calls==3);
+	CPPUNIT_ASSERT(p.nb_sampled==3);
+	CPPUNIT_ASSERT(p.nb_empty==1);
+	CPPUNIT_ASSERT(p.wall_time>=0 && p.cpu_time>=0);
+	// the empty box is not taken into account
+	CPPUNIT_ASSERT(std::fabs(p.mean_log_reduction()-(std::log(4.0)+std::log(4.0/3))/2)<1e-10);
+
+	CtcProfile p2(c,"leq2",2);
+	box[0]=Interval(0,4);
+	p2.contract(box);  // timed (first call)
+	box[0]=Interval(-2,2);
+	p2.contract(box);  // not timed
+	CPPUNIT_ASSERT(p2.nb_calls==2);
+	CPPUNIT_ASSERT(p2.nb_sampled==1);
+	CPPUNIT_ASSERT(std::fabs(p2.mean_log_reduction()-std::log(4.0))<1e-10);
+
+	p2.reset();
+	CPPUNIT_ASSERT(p2.nb_calls==0);
+	CPPUNIT_ASSERT(p2.mean_log_reduction()==0);
+}
+
+void TestCtcProfile::flags01() {
+	CtcIdentity id(2);
+	CtcProfile p(id);
+	BitSet impact(BitSet::all(2));
+	BitSet flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS));
+	IntervalVector box(2);
+	((Ctc&) p).contract(box,impact,flags);
+	CPPUNIT_ASSERT(flags[Ctc::FIXPOINT]);
+	CPPUNIT_ASSERT(flags[Ctc::INACTIVE]);
+	CPPUNIT_ASSERT(p.nb_calls==1);
+}
+
+void TestCtcProfile::solver01() {
+	Variable x,y;
+	Function f1(x,y,sqr(x)+sqr(y)-1);
+	Function f2(x,y,y-sin(10*x));
+	CtcFwdBwd c1(f1);
+	CtcFwdBwd c2(f2);
+	CtcProfile p1(c1,"circle");
+	CtcProfile p2(c2,"sine");
+	CtcCompo compo(p1,p2);
+	RoundRobin bsc(1e-3);
+	CellStack buff;
+	Solver s(compo,bsc,buff);
+	s.profile_file=TMP_FILE_NAME;
+	s.solve(IntervalVector(2,Interval(-2,2)));
+
+	// each cell is contracted once by the first contractor
+	CPPUNIT_ASSERT(p1.nb_calls==(unsigned long) s.nb_cells+1);
+	CPPUNIT_ASSERT(p2.nb_calls==p1.nb_calls-p1.nb_empty);
+	CPPUNIT_ASSERT(p1.nb_sampled==(p1.nb_calls+CtcProfile::default_sampling-1)/CtcProfile::default_sampling);
+
+	ifstream is(TMP_FILE_NAME);
+	CPPUNIT_ASSERT(is.is_open());
+	stringstream ss;
+	ss << is.rdbuf();
+	string json=ss.str();
+	CPPUNIT_ASSERT(json.find("\"name\": \"circle\"")!=string::npos);
+	CPPUNIT_ASSERT(json.find("\"name\": \"sine\"")!=string::npos);
+	ostringstream calls;
+	calls << "\"calls\": " << p1.nb_calls << ",";
+	CPPUNIT_ASSERT(json.find(calls.str())!=string::npos);
+	is.close();
+
+	remove(TMP_FILE_NAME);
+}
+
+namespace {
+
+/* Creates profiled contractors (with default names) */
+class Creator : public Thread {
+public:
+	Creator(Ctc& ctc) : ctc(ctc) { }
+
+	~Creator() {
+		for (unsigned int i=0; i<p.size(); i++) delete p[i];
+	}
+
+	void run() {
+		for (int i=0; i<100; i++) {
+			p.push_back(new CtcProfile(ctc));
+			delete new CtcProfile(ctc);
+		}
+	}
+
+	Ctc& ctc;
+	vector<CtcProfile*> p;
+};
+
+}
+
+void TestCtcProfile::threads01() {
+	CtcIdentity id(2);
+	Creator c1(id), c2(id), c3(id);
+	c1.start(); c2.start(); c3.start();
+	c1.join(); c2.join(); c3.join();
+
+	// the names are all different
+	set<string> names;
+	Creator* c[3] = { &c1, &c2, &c3 };
+	for (int i=0; i<3; i++)
+		for (unsigned int j=0; j<c[i]->p.size(); j++)
+			names.insert(c[i]->p[j]->name);
+	CPPUNIT_ASSERT(names.size()==300);
+
+	// the contractors that remain are all in the report
+	ostringstream os;
+	CtcProfile::report(os);
+	string r=os.str();
+	int n=0;
+	for (size_t pos=r.find("\"name\""); pos!=string::npos; pos=r.find("\"name\"",pos+1)) n++;
+	CPPUNIT_ASSERT(n==300);
+}
+
+} // end namespace ibex
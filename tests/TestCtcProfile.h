@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcProfile.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_PROFILE_H__
+#define __TEST_CTC_PROFILE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcProfile : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcProfile);
+		CPPUNIT_TEST(contract01);
+		CPPUNIT_TEST(flags01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// statistics of a few calls
+	void contract01();
+	// the output flags of the sub-contractor are forwarded
+	void flags01();
+	// report written at the end of a search
+	void solver01();
+	// contractors created and deleted by several threads
+	void threads01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcProfile);
+
+} // end namespace ibex
+#endif // __TEST_CTC_PROFILE_H__
@@ -119,6 +119,36 @@ void TestEval::deco02() {
 	check_deco(f, e);
 }
 
+void TestEval::deco03() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y",Dim::col_vec(2));
+	const ExprNode&   e = sqr(x)+y[0]*exp(y[1]);
+	Function f(x,y,e);
+	ExprDomain d(f);
+
+	// the domains of the nodes are contiguous
+	for (int i=1; i<f.nb_nodes(); i++)
+		CPPUNIT_ASSERT(&d[i]==&d[0]+i);
+
+	// scalars are packed in the order of evaluation and aligned on a cache line
+	const Interval* first=NULL;
+	int k=0;
+	for (int i=f.nb_nodes()-1; i>=0; i--) {
+		if (!f.node(i).dim.is_scalar() || dynamic_cast<const ExprIndex*>(&f.node(i))) continue;
+		if (!first) first=&d[i].i();
+		CPPUNIT_ASSERT(&d[i].i()==first+k);
+		k++;
+	}
+	CPPUNIT_ASSERT(k==5); // x, sqr(x), exp(y[1]), y[0]*exp(y[1]) and e
+	CPPUNIT_ASSERT(((size_t) first)%64==0);
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(0,1);
+	box[2]=Interval(0,0);
+	check(f.eval(box),Interval(1,5));
+}
+
 void TestEval::add01() {
 
 	const ExprSymbol& x = ExprSymbol::new_("x");
@@ -322,4 +352,88 @@ void TestEval::apply04() {
 	CPPUNIT_ASSERT((f3.eval_domain(_x3).i()).is_superset(Interval(10,10)));
 }
 
+void TestEval::incremental01() {
+	Variable x,y,z(2);
+	Function f(x,y,z,sqr(x)*exp(z[0])-sqrt(y)+z[1]*y);
+	Function g(x,y,z,sqr(x)*exp(z[0])-sqrt(y)+z[1]*y);
+	f.set_incremental();
+
+	IntervalVector box(4);
+	box[0]=Interval(-1,2);
+	box[1]=Interval(1,4);
+	box[2]=Interval(0,1);
+	box[3]=Interval(-2,-1);
+
+	for (int k=0; k<20; k++) {
+		// modify one variable (bisection-like)
+		int j=k%4;
+		if (k%3==0) box[j]=Interval(box[j].lb(),box[j].mid());
+		else box[j]=Interval(box[j].mid(),box[j].ub());
+		CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+	}
+
+	// outside of the definition domain
+	box[1]=Interval(-2,-1);
+	CPPUNIT_ASSERT(f.eval(box).is_empty());
+	box[1]=Interval(1,2);
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+	box[0]=Interval(3,4);
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+}
+
+void TestEval::incremental02() {
+	Variable x,y;
+	Function f(x,y,sin(x)+sqr(y)*x);
+	Function g(x,y,sin(x)+sqr(y)*x);
+	f.set_incremental();
+
+	IntervalVector box(2,Interval(-2,2));
+	for (int k=0; k<10; k++) {
+		IntervalVector b1(box), b2(box);
+		CPPUNIT_ASSERT(f.backward(Interval(0,0.5),b1)==g.backward(Interval(0,0.5),b2));
+		CPPUNIT_ASSERT(b1==b2);
+		// the domains stored by the evaluator are not altered by the backward phase
+		CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+		box[k%2]=Interval(box[k%2].lb(),box[k%2].mid());
+	}
+}
+
+void TestEval::centered01() {
+	Variable x;
+	Function f(x,sqr(x)-x);
+
+	IntervalVector box(1,Interval(0.9,1.1));
+	// natural: [0.81,1.21]-[0.9,1.1]
+	CPPUNIT_ASSERT(almost_eq(f.eval(box,Function::NATURAL),Interval(-0.29,0.31),1e-10));
+	// centered: f(1)+[0.8,1.2]*[-0.1,0.1]
+	CPPUNIT_ASSERT(almost_eq(f.eval(box,Function::CENTERED),Interval(-0.12,0.12),1e-10));
+	CPPUNIT_ASSERT(almost_eq(f.eval(box,Function::CENTERED_NATURAL),Interval(-0.12,0.12),1e-10));
+
+	// on a large box, the natural extension is better
+	box[0]=Interval(0,4);
+	CPPUNIT_ASSERT(almost_eq(f.eval(box,Function::CENTERED),Interval(-12,16),1e-10));
+	CPPUNIT_ASSERT(almost_eq(f.eval(box,Function::CENTERED_NATURAL),Interval(-4,16),1e-10));
+
+	// unbounded box: natural extension
+	box[0]=Interval(1,POS_INFINITY);
+	CPPUNIT_ASSERT(f.eval(box,Function::CENTERED)==f.eval(box));
+}
+
+void TestEval::centered02() {
+	Variable x,y,z;
+	// z is not used
+	Function f(x,y,z,Return(x*y-y,sqr(x)));
+
+	IntervalVector box(3);
+	box[0]=Interval(0.9,1.1);
+	box[1]=Interval(1.9,2.1);
+	box[2]=Interval(-1,1);
+
+	IntervalVector c=f.eval_vector(box,Function::CENTERED_NATURAL);
+	// x*y-y: f(mid)=0 and grad=(y,x-1)=([1.9,2.1],[-0.1,0.1])
+	CPPUNIT_ASSERT(almost_eq(c[0],Interval(-0.22,0.22),1e-10));
+	CPPUNIT_ASSERT(almost_eq(c[1],Interval(0.81,1.21),1e-10));
+	CPPUNIT_ASSERT(c.is_subset(f.eval_vector(box)));
+}
+
 }
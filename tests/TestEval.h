@@ -27,6 +27,7 @@ public:
 	
 		CPPUNIT_TEST(deco01);
 		CPPUNIT_TEST(deco02);
+		CPPUNIT_TEST(deco03);
 
 		CPPUNIT_TEST(add01);
 		CPPUNIT_TEST(add02);
@@ -41,10 +42,16 @@ public:
 		CPPUNIT_TEST(apply02);
 		CPPUNIT_TEST(apply03);
 		CPPUNIT_TEST(apply04);
+
+		CPPUNIT_TEST(incremental01);
+		CPPUNIT_TEST(incremental02);
+		CPPUNIT_TEST(centered01);
+		CPPUNIT_TEST(centered02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void deco01();
 	void deco02();
+	void deco03();
 
 	void add01();
 	void add02();
@@ -60,6 +67,13 @@ public:
 	void apply03();
 	void apply04();
 
+	// incremental evaluation (one variable modified at a time)
+	void incremental01();
+	// incremental evaluation + backward projection
+	void incremental02();
+	void centered01();
+	void centered02();
+
 private:
 	void check_deco(Function& f, const ExprNode& e);
 };
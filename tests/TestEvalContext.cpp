@@ -0,0 +1,144 @@
+//============================================================================
+//                                  I B E X
+// File        : TestEvalContext.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestEvalContext.h"
+#include "ibex_Function.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+IntervalVector box(int k) {
+	IntervalVector x(2);
+	x[0]=Interval(-1+0.1*k,0.5+0.2*k);
+	x[1]=Interval(0.5*k,1+0.5*k);
+	return x;
+}
+
+/*
+ * Evaluate, contract and differentiate f on several
+ * boxes with the context c.
+ */
+class Worker : public Thread {
+public:
+	Worker(const Function& f, const Interval* img, const IntervalVector* proj) :
+		f(f), img(img), proj(proj), ok(true) { }
+
+	void run() {
+		EvalContext& c=f.checkout();
+		for (int it=0; it<200; it++) {
+			for (int k=0; k<10; k++) {
+				if (c.eval(box(k))!=img[k]) ok=false;
+				IntervalVector x=box(k);
+				c.backward(Interval(0,1),x);
+				if (x!=proj[k]) ok=false;
+			}
+		}
+		f.checkin(c);
+	}
+
+	const Function& f;
+	const Interval* img;
+	const IntervalVector* proj;
+	bool ok;
+};
+
+}
+
+void TestEvalContext::context01() {
+	Variable x,y;
+	Function g(x,y,sqr(x)-y,"g");
+	Function h(x,y,Return(x+y,x*y),"h");
+	Function f(x,y,g(x,y)+exp(h(x,y)[1])*g(y,x));
+
+	EvalContext c(f);
+	for (int k=0; k<10; k++) {
+		IntervalVector b=box(k);
+		CPPUNIT_ASSERT(c.eval(b)==f.eval(b));
+
+		IntervalVector g1(2), g2(2);
+		c.gradient(b,g1);
+		f.gradient(b,g2);
+		CPPUNIT_ASSERT(g1==g2);
+
+		IntervalVector x1=b, x2=b;
+		CPPUNIT_ASSERT(c.backward(Interval(0,1),x1)==f.backward(Interval(0,1),x2));
+		CPPUNIT_ASSERT(x1==x2);
+	}
+}
+
+void TestEvalContext::context02() {
+	Variable x,y;
+	Function g(x,y,Return(x*y,x-y),"g");
+	Function f(x,y,Return(sqr(x)+y,g(x,y)[0],sin(x)*y));
+
+	EvalContext c(f);
+	for (int k=0; k<10; k++) {
+		IntervalVector b=box(k);
+		CPPUNIT_ASSERT(c.eval_vector(b)==f.eval_vector(b));
+
+		IntervalMatrix J1(3,2), J2(3,2);
+		c.jacobian(b,J1);
+		f.jacobian(b,J2);
+		CPPUNIT_ASSERT(J1==J2);
+
+		IntervalVector y(3,Interval(-1,1));
+		IntervalVector x1=b, x2=b;
+		CPPUNIT_ASSERT(c.backward(y,x1)==f.backward(y,x2));
+		CPPUNIT_ASSERT(x1==x2);
+	}
+}
+
+void TestEvalContext::pool01() {
+	Variable x,y;
+	Function f(x,y,x+y);
+
+	EvalContext& c1=f.checkout();
+	EvalContext& c2=f.checkout();
+	CPPUNIT_ASSERT(&c1!=&c2);
+	CPPUNIT_ASSERT(&c1.f==&f);
+	f.checkin(c1);
+	CPPUNIT_ASSERT(&f.checkout()==&c1);
+	f.checkin(c1);
+	f.checkin(c2);
+}
+
+void TestEvalContext::threads01() {
+	Variable x,y;
+	Function g(x,y,x*y-sqr(y),"g");
+	Function f(x,y,sqrt(sqr(x)+sqr(y))-g(x,y)+cos(x));
+
+	Interval img[10];
+	vector<IntervalVector> proj;
+	for (int k=0; k<10; k++) {
+		img[k]=f.eval(box(k));
+		proj.push_back(box(k));
+		f.backward(Interval(0,1),proj.back());
+	}
+
+	int n=4;
+	Worker* w[4];
+	for (int i=0; i<n; i++) {
+		w[i]=new Worker(f,img,&proj[0]);
+		w[i]->start();
+	}
+	for (int i=0; i<n; i++) {
+		w[i]->join();
+		CPPUNIT_ASSERT(w[i]->ok);
+		delete w[i];
+	}
+}
+
+} // end namespace ibex
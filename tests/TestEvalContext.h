@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestEvalContext.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_EVAL_CONTEXT_H__
+#define __TEST_EVAL_CONTEXT_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestEvalContext : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestEvalContext);
+		CPPUNIT_TEST(context01);
+		CPPUNIT_TEST(context02);
+		CPPUNIT_TEST(pool01);
+		CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// real-valued function with function calls
+	void context01();
+	// vector-valued function
+	void context02();
+	// checkout/checkin
+	void pool01();
+	// concurrent evaluations of the same function
+	void threads01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestEvalContext);
+
+} // end namespace ibex
+#endif // __TEST_EVAL_CONTEXT_H__
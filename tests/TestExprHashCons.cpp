@@ -0,0 +1,194 @@
+/* ============================================================================
+ * I B E X - Expression hash-consing tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestExprHashCons.h"
+#include "ibex_ExprHashCons.h"
+#include "ibex_ExprCopy.h"
+#include "ibex_Function.h"
+#include "ibex_System.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestExprHashCons::share01() {
+	const ExprSymbol& x1=ExprSymbol::new_(Dim::scalar());
+	const ExprSymbol& x2=ExprSymbol::new_(Dim::scalar());
+
+	Array<const ExprSymbol> old_x(x1,x2);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	const ExprNode& e1=((x1+x2)-(x1+x2));
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+
+	CPPUNIT_ASSERT(e1.size==5 && e2.size==4);
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::share02() {
+	const ExprSymbol& x1=ExprSymbol::new_(Dim::scalar());
+	const ExprSymbol& x2=ExprSymbol::new_(Dim::scalar());
+
+	Array<const ExprSymbol> old_x(x1,x2);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	const ExprNode& e1=(exp(x1)-(x1+x2))*exp(x1) + (exp(x1)-(x1+x2));
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+
+	CPPUNIT_ASSERT(e2.size==7);
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::fold01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	Array<const ExprSymbol> old_x(x);
+	Array<const ExprSymbol> new_x(1);
+	varcopy(old_x,new_x);
+
+	const ExprNode& e1=(ExprConstant::new_scalar(2)*ExprConstant::new_scalar(3))+x;
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+
+	CPPUNIT_ASSERT(e2.size==3);
+	const ExprAdd* add=dynamic_cast<const ExprAdd*>(&e2);
+	CPPUNIT_ASSERT(add);
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&add->left);
+	CPPUNIT_ASSERT(c && almost_eq(c->get_value(),Interval(6),1e-10));
+	CPPUNIT_ASSERT(&add->right==&new_x[0]);
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::simpl01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	const ExprSymbol& y=ExprSymbol::new_("y",Dim::scalar());
+	Array<const ExprSymbol> old_x(x,y);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	const ExprNode& e1=(x*ExprConstant::new_scalar(1)+ExprConstant::new_scalar(0))*(-(-y));
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+
+	const ExprMul* mul=dynamic_cast<const ExprMul*>(&e2);
+	CPPUNIT_ASSERT(mul);
+	CPPUNIT_ASSERT(&mul->left==&new_x[0]);
+	CPPUNIT_ASSERT(&mul->right==&new_x[1]);
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::simpl02() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	const ExprSymbol& y=ExprSymbol::new_("y",Dim::scalar());
+	Array<const ExprSymbol> old_x(x,y);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	// no node is built for sin(x)
+	const ExprNode& e1=ExprConstant::new_scalar(0)*sin(x)+y;
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1,true);
+
+	CPPUNIT_ASSERT(&e2==&new_x[1]);
+	CPPUNIT_ASSERT(new_x[0].fathers.size()==0);
+
+	cleanup(e1,false);
+}
+
+void TestExprHashCons::simpl03() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	Array<const ExprSymbol> old_x(x);
+	Array<const ExprSymbol> new_x(1);
+	varcopy(old_x,new_x);
+
+	// 0*x is not absorbed by default
+	const ExprNode& e1=ExprConstant::new_scalar(0)*sqrt(x);
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+
+	CPPUNIT_ASSERT(dynamic_cast<const ExprMul*>(&e2));
+	CPPUNIT_ASSERT(e2.size==4);
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::ctr01() {
+	Variable x("x");
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_ctr(0*sqrt(x)+x*0=0);
+	System sys(fac);
+
+	// the constraint is not satisfied outside the definition domain of sqrt
+	CPPUNIT_ASSERT(sys.ctrs[0].f.eval(IntervalVector(1,Interval(-2,-1))).is_empty());
+	CPPUNIT_ASSERT(sys.ctrs[0].f.eval(IntervalVector(1,Interval(1,2)))==Interval::ZERO);
+}
+
+void TestExprHashCons::index01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	const ExprSymbol& y=ExprSymbol::new_("y",Dim::scalar());
+	Array<const ExprSymbol> old_x(x,y);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	const ExprNode& e1=ExprVector::new_(x,y,false)[1]+x;
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+
+	CPPUNIT_ASSERT(e2.size==3);
+	CPPUNIT_ASSERT(sameExpr(e2,"(y+x)"));
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::index02() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	const ExprSymbol& y=ExprSymbol::new_("y",Dim::scalar());
+	Array<const ExprSymbol> old_x(x,y);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	// sqrt(x) is not dropped by default
+	const ExprNode& e1=ExprVector::new_(sqrt(x),y,false)[1];
+	const ExprNode& e2=ExprHashCons().copy(old_x,new_x,e1);
+	CPPUNIT_ASSERT(dynamic_cast<const ExprIndex*>(&e2));
+	CPPUNIT_ASSERT(e2.size==5);
+
+	const ExprNode& e3=ExprHashCons().copy(old_x,new_x,e1,true);
+	CPPUNIT_ASSERT(&e3==&new_x[1]);
+
+	cleanup(e1,false);
+	cleanup(e2,false);
+}
+
+void TestExprHashCons::diff01() {
+	Variable x("x"),y("y");
+	Function f(x,y,sin(x*y));
+
+	// the two partial derivatives share cos(x*y)
+	const Function& df=f.diff();
+	CPPUNIT_ASSERT(df.nb_nodes()==7);
+
+	double _box[][2]={{1,1},{2,2}};
+	IntervalVector box(2,_box);
+	IntervalVector g=df.eval_vector(box);
+	CPPUNIT_ASSERT(almost_eq(g[0],cos(Interval(2))*2,1e-10));
+	CPPUNIT_ASSERT(almost_eq(g[1],cos(Interval(2))*1,1e-10));
+}
+
+} // end namespace
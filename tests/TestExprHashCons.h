@@ -0,0 +1,55 @@
+/* ============================================================================
+ * I B E X - Expression hash-consing tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_EXPR_HASH_CONS_H__
+#define __TEST_EXPR_HASH_CONS_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestExprHashCons : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestExprHashCons);
+	
+		CPPUNIT_TEST(share01);
+		CPPUNIT_TEST(share02);
+		CPPUNIT_TEST(fold01);
+		CPPUNIT_TEST(simpl01);
+		CPPUNIT_TEST(simpl02);
+		CPPUNIT_TEST(simpl03);
+		CPPUNIT_TEST(ctr01);
+		CPPUNIT_TEST(index01);
+		CPPUNIT_TEST(index02);
+		CPPUNIT_TEST(diff01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void share01();
+	void share02();
+	void fold01();
+	void simpl01();
+	void simpl02();
+	void simpl03();
+	void ctr01();
+	void index01();
+	void index02();
+	void diff01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestExprHashCons);
+
+
+} // namespace ibex
+#endif // __TEST_EXPR_HASH_CONS_H__
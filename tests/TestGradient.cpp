@@ -577,5 +577,141 @@ void TestGradient::hansen01() {
 
 }
 
-} // end namespace
+void TestGradient::sparse_jac01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+
+	SparseJacobian J(*p30.f);
+	CPPUNIT_ASSERT(J.nb_rows()==30);
+	CPPUNIT_ASSERT(J.nb_cols()==30);
+	for (int i=0; i<30; i++)
+		CPPUNIT_ASSERT(J.row_size(i)==(*p30.f)[i].nb_used_vars());
+
+	p30.f->jacobian(box,J);
+	CPPUNIT_ASSERT(!J.is_empty());
+
+	IntervalMatrix J2(30,30);
+	p30.f->jacobian(box,J2);
+	CPPUNIT_ASSERT(J.dense()==J2);
+
+	IntervalVector row(30);
+	J.get_row(3,row);
+	CPPUNIT_ASSERT(row==J2[3]);
+	CPPUNIT_ASSERT(row[0]==Interval::ZERO);
+}
+
+void TestGradient::sparse_hansen01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+
+	SparseJacobian H(*p30.f);
+	p30.f->hansen_matrix(box,H);
+
+	// the Hansen matrix calculated column by column
+	IntervalMatrix H2(30,30);
+	IntervalMatrix J(30,30);
+	IntervalVector x=box.mid();
+	for (int j=0; j<30; j++) {
+		x[j]=box[j];
+		p30.f->jacobian(x,J);
+		H2.set_col(j,J.col(j));
+	}
+
+	CPPUNIT_ASSERT(H.dense()==H2);
+}
 
+void TestGradient::hessian01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)*y+sin(x)*exp(y));
+
+	double _box[][2]={{1,1},{2,2}};
+	IntervalVector box(2,_box);
+	IntervalMatrix H=f.hessian(box);
+
+	Interval X(1), Y(2);
+	double error=1e-10;
+	CPPUNIT_ASSERT(almost_eq(H[0][0],2*Y-sin(X)*exp(Y),error));
+	CPPUNIT_ASSERT(almost_eq(H[0][1],2*X+cos(X)*exp(Y),error));
+	CPPUNIT_ASSERT(almost_eq(H[1][0],2*X+cos(X)*exp(Y),error));
+	CPPUNIT_ASSERT(almost_eq(H[1][1],sin(X)*exp(Y),error));
+
+	// enclosure on a box
+	double _box2[][2]={{0,1},{1,2}};
+	IntervalVector box2(2,_box2);
+	f.hessian(box2,H);
+	IntervalVector pt=box2.mid();
+	IntervalMatrix Hpt=f.hessian(pt);
+	CPPUNIT_ASSERT(Hpt.is_subset(H));
+
+	// outside definition domain
+	Function g(x,y,sqrt(x)*y);
+	double _box3[][2]={{-2,-1},{1,2}};
+	IntervalVector box3(2,_box3);
+	g.hessian(box3,H);
+	CPPUNIT_ASSERT(H.is_empty());
+}
+
+void TestGradient::hessian02() {
+	Variable x,y,z;
+	Function f(x,y,z,x*y/z+atan2(x,z)+sqr(y)*log(z));
+
+	double _box[][2]={{1,1},{2,2},{3,3}};
+	IntervalVector box(3,_box);
+	IntervalMatrix H=f.hessian(box);
+
+	// symmetric
+	for (int i=0; i<3; i++)
+		for (int j=0; j<3; j++)
+			CPPUNIT_ASSERT(almost_eq(H[i][j],H[j][i],1e-10));
+
+	// Hessian-vector product
+	double _v[][2]={{1,1},{-2,-2},{0.5,0.5}};
+	IntervalVector v(3,_v);
+	IntervalVector hv(3);
+	f.hessian_vector(box,v,hv);
+	CPPUNIT_ASSERT(almost_eq(hv,H*v,1e-10));
+
+	// same as the Jacobian of the symbolic derivative
+	IntervalMatrix J=f.diff().jacobian(box);
+	CPPUNIT_ASSERT(almost_eq(H,J,1e-10));
+}
+
+void TestGradient::hessian03() {
+	Variable x(3),y;
+	Function f(x,y,x[0]*x[2]+sqr(y)*x[2]);
+
+	IntervalVector box(4,Interval(2));
+	IntervalMatrix H=f.hessian(box);
+
+	// x[1] is not used
+	double _H[][2]={{0,0},{0,0},{1,1},{0,0},
+			        {0,0},{0,0},{0,0},{0,0},
+			        {1,1},{0,0},{0,0},{4,4},
+			        {0,0},{0,0},{4,4},{4,4}};
+	CPPUNIT_ASSERT(almost_eq(H,IntervalMatrix(4,4,_H),1e-10));
+
+	// a function call: symbolic differentiation
+	Variable a,b,u,v;
+	Function h(a,b,a*b);
+	Function g(u,v,sqr(h(u,v)));
+	IntervalVector box2(2,Interval(2));
+	IntervalMatrix G=g.hessian(box2);
+	double _G[][2]={{8,8},{16,16},
+			        {16,16},{8,8}};
+	CPPUNIT_ASSERT(almost_eq(G,IntervalMatrix(2,2,_G),1e-10));
+}
+
+void TestGradient::hessian04() {
+	Variable x,y,z;
+	Function f1(x,y,z,x*y/z+sqr(y)*log(z)+exp(x*z));
+	Function f2(x,y,z,x*y/z+sqr(y)*log(z)+exp(x*z));
+
+	double _box[][2]={{-1,2},{0,3},{1,4}};
+	IntervalVector box(3,_box);
+
+	// the result does not depend on a prior symbolic differentiation
+	f2.diff();
+	CPPUNIT_ASSERT(f1.hessian(box)==f2.hessian(box));
+}
+
+} // end namespace
@@ -37,6 +37,12 @@ public:
 		CPPUNIT_TEST(jac01);
 		CPPUNIT_TEST(jac02);
 		CPPUNIT_TEST(hansen01);
+		CPPUNIT_TEST(sparse_jac01);
+		CPPUNIT_TEST(sparse_hansen01);
+		CPPUNIT_TEST(hessian01);
+		CPPUNIT_TEST(hessian02);
+		CPPUNIT_TEST(hessian03);
+		CPPUNIT_TEST(hessian04);
 		CPPUNIT_TEST(mulVV);
 		CPPUNIT_TEST(transpose01);
 		CPPUNIT_TEST(mulMV01);
@@ -55,6 +61,12 @@ public:
 	void jac01();
 	void jac02();
 	void hansen01();
+	void sparse_jac01();
+	void sparse_hansen01();
+	void hessian01();
+	void hessian02();
+	void hessian03();
+	void hessian04();
 
 	void mulVV();
 	// for vectors
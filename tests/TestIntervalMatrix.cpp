@@ -400,6 +400,82 @@ void TestIntervalMatrix::mul02() {
 	CPPUNIT_ASSERT((m2*=m1).is_empty());
 }
 
+void TestIntervalMatrix::mul03() {
+	IntervalMatrix m1(3,5);
+	IntervalMatrix m2(5,7);
+	for (int i=0; i<3; i++)
+		for (int k=0; k<5; k++)
+			m1[i][k]=Interval(i-k,i+2*k);
+	for (int k=0; k<5; k++)
+		for (int j=0; j<7; j++)
+			m2[k][j]=Interval(k-j,k+1);
+	m2[2][4]=Interval::POS_REALS;
+	m2[3][1]=Interval::ZERO;
+	m1[1][3]=Interval::ALL_REALS;
+
+	IntervalMatrix m3=m1*m2;
+	for (int i=0; i<3; i++)
+		for (int j=0; j<7; j++) {
+			Interval s=Interval::ZERO;
+			for (int k=0; k<5; k++)
+				s+=m1[i][k]*m2[k][j];
+			CPPUNIT_ASSERT(m3[i][j]==s);
+		}
+
+	IntervalVector v=m1.row(2);
+	IntervalVector w=v*m2;
+	for (int j=0; j<7; j++)
+		CPPUNIT_ASSERT(w[j]==v*m2.col(j));
+}
+
+void TestIntervalMatrix::mul_midrad01() {
+	// integer bounds: the products of the vertices below are exact
+	int n=MIDRAD_MIN_SIZE+3;
+	IntervalMatrix A(n,n);
+	IntervalMatrix B(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			A[i][j]=Interval((i*j)%7-3,(i*j)%7-3+(i+j)%3);
+			B[i][j]=Interval((i+2*j)%5-2,(i+2*j)%5-2+(i*j)%2);
+		}
+
+	IntervalMatrix C=A*B; // mid-rad product (n>=MIDRAD_MIN_SIZE)
+
+	Matrix pA[]={A.lb(),A.ub(),A.mid()};
+	Matrix pB[]={B.lb(),B.ub(),B.mid()};
+	for (int k=0; k<3; k++) {
+		IntervalMatrix P(pA[k]*pB[k]);
+		CPPUNIT_ASSERT(P.is_subset(C));
+		CPPUNIT_ASSERT((pA[k]*B).is_subset(C));
+		CPPUNIT_ASSERT(IntervalVector(pA[k]*pB[k].col(0)).is_subset(A*B.col(0)));
+	}
+
+	// the radius is at most 1.5 times the radius of the standard product
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			Interval s=Interval::ZERO;
+			for (int k=0; k<n; k++)
+				s+=A[i][k]*B[k][j];
+			CPPUNIT_ASSERT(C[i][j].rad()<=1.5*s.rad()+1e-10);
+		}
+}
+
+void TestIntervalMatrix::mul_midrad02() {
+	int n=MIDRAD_MIN_SIZE;
+	IntervalMatrix A(n,n,Interval(-1,1));
+	IntervalMatrix B(n,n,Interval(2,3));
+
+	A[2][1]=Interval::POS_REALS;
+	B[1][1]=Interval::ZERO;
+
+	// standard product with an unbounded entry
+	IntervalMatrix C=mul_midrad(A,B);
+	CPPUNIT_ASSERT(almost_eq(C[2][1],Interval(-3*(n-1),3*(n-1)),1e-10));
+	CPPUNIT_ASSERT(C[2][0].ub()==POS_INFINITY);
+
+	CPPUNIT_ASSERT(mul_midrad(IntervalMatrix::empty(n,n),B).is_empty());
+}
+
 void TestIntervalMatrix::put01() {
 
 	IntervalMatrix M1=2*Matrix::eye(3);
@@ -72,6 +72,9 @@ public:
 
 		CPPUNIT_TEST(mul01);
 		CPPUNIT_TEST(mul02);
+		CPPUNIT_TEST(mul03);
+		CPPUNIT_TEST(mul_midrad01);
+		CPPUNIT_TEST(mul_midrad02);
 
 		CPPUNIT_TEST(put01);
 	CPPUNIT_TEST_SUITE_END();
@@ -166,6 +169,9 @@ public:
 	//  operator*=(const IntervalMatrix& x)
 	void mul01();
 	void mul02();
+	void mul03();
+	void mul_midrad01();
+	void mul_midrad02();
 
 	void put01();
 };
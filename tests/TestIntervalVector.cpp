@@ -114,6 +114,26 @@ void TestIntervalVector::resize04() {
 	check(x[1],Interval(3,4));
 }
 
+void TestIntervalVector::resize05() {
+	IntervalVector x(3,Interval(1,2));
+	x.resize(20);
+	CPPUNIT_ASSERT(x.size()==20);
+	check(x[2],Interval(1,2));
+	check(x[19],Interval::ALL_REALS);
+	x[7]=Interval(3,4);
+	x.resize(8);
+	CPPUNIT_ASSERT(x.size()==8);
+	check(x[0],Interval(1,2));
+	check(x[7],Interval(3,4));
+	x.resize(2);
+	x.resize(4);
+	check(x[1],Interval(1,2));
+	check(x[3],Interval::ALL_REALS);
+	IntervalVector y(x);
+	x.resize(9);
+	CPPUNIT_ASSERT(y==x.subvector(0,3));
+}
+
 static double _x[][2]={{0,1},{2,3},{4,5}};
 
 void TestIntervalVector::subvector01() {
@@ -756,3 +776,130 @@ void TestIntervalVector::random02() {
 
 	CPPUNIT_ASSERT(b==r);
 }
+
+namespace {
+
+/*
+ * Check the whole-vector operations on x and y against the component-wise
+ * ones. The bounds are integers so that the dot product is exact
+ * (whatever the order of the sum is).
+ */
+void check_kernels(const IntervalVector& x, const IntervalVector& y) {
+	int n=x.size();
+
+	IntervalVector sum=x+y;
+	IntervalVector diff=x-y;
+	IntervalVector hull=x|y;
+	IntervalVector infl=IntervalVector(x).inflate(0.5);
+	Vector d=x.diam();
+	Interval dot=Interval::ZERO;
+	double max_diam=0;
+
+	for (int i=0; i<n; i++) {
+		CPPUNIT_ASSERT(sum[i]==x[i]+y[i]);
+		CPPUNIT_ASSERT(diff[i]==x[i]-y[i]);
+		CPPUNIT_ASSERT(hull[i]==(x[i]|y[i]));
+		CPPUNIT_ASSERT(infl[i]==x[i]+Interval(-0.5,0.5));
+		CPPUNIT_ASSERT(d[i]==x[i].diam());
+		dot+=x[i]*y[i];
+		if (x[i].diam()>max_diam) max_diam=x[i].diam();
+	}
+
+	CPPUNIT_ASSERT((x*y)==dot);
+	CPPUNIT_ASSERT(x.max_diam()==max_diam);
+
+	IntervalVector inter=x&y;
+	bool empty=false;
+	for (int i=0; i<n; i++)
+		if ((x[i]&y[i]).is_empty()) empty=true;
+
+	CPPUNIT_ASSERT(inter.is_empty()==empty);
+	if (!empty) {
+		for (int i=0; i<n; i++)
+			CPPUNIT_ASSERT(inter[i]==(x[i]&y[i]));
+		CPPUNIT_ASSERT(inter.is_subset(x));
+		CPPUNIT_ASSERT(inter.is_subset(y));
+	}
+	CPPUNIT_ASSERT(x.is_subset(hull));
+	CPPUNIT_ASSERT(!hull.is_subset(x) || hull==x);
+
+	double rel=x[0].rel_distance(hull[0]);
+	for (int i=1; i<n; i++)
+		if (x[i].rel_distance(hull[i])>rel) rel=x[i].rel_distance(hull[i]);
+	CPPUNIT_ASSERT(x.rel_distance(hull)==rel);
+}
+
+}
+
+void TestIntervalVector::kernels01() {
+	// odd size: both the vectorized loop and the last component are tested
+	double _x[][2]={{0,1},{-2,3},{-5,-1},{4,4},{-3,0},{1,7},{-6,2}};
+	double _y[][2]={{-1,2},{1,1},{-2,0},{2,6},{-1,1},{0,3},{-1,5}};
+	IntervalVector x(7,_x);
+	IntervalVector y(7,_y);
+	check_kernels(x,y);
+	check_kernels(y,x);
+	check_kernels(x,x);
+
+	double _z[][2]={{0,1},{-2,3},{-5,-1},{4,4},{-3,0},{1,7},{3,5}};
+	check_kernels(x,IntervalVector(7,_z)); // disjoint in the last component
+	check_kernels(x.subvector(0,3),y.subvector(0,3));
+}
+
+void TestIntervalVector::kernels02() {
+	double _x[][2]={{0,0},{NEG_INFINITY,3},{-5,-1},{4,POS_INFINITY},{-3,0},{NEG_INFINITY,POS_INFINITY}};
+	double _y[][2]={{NEG_INFINITY,POS_INFINITY},{1,1},{-2,0},{-2,6},{0,0},{-1,1}};
+	IntervalVector x(6,_x);
+	IntervalVector y(6,_y);
+	check_kernels(x,y);
+	check_kernels(y,x);
+}
+
+#if __cplusplus >= 201103L
+void TestIntervalVector::move01() {
+	IntervalVector x(3,Interval(1,2));
+	IntervalVector y(std::move(x));
+	CPPUNIT_ASSERT(y==IntervalVector(3,Interval(1,2)));
+
+	IntervalVector z(5);
+	z=std::move(y); // dimensions differ
+	CPPUNIT_ASSERT(z==IntervalVector(3,Interval(1,2)));
+
+	IntervalVector w(3);
+	Interval& w0=w[0];
+	w=IntervalVector::empty(3);
+	CPPUNIT_ASSERT(w.is_empty());
+	CPPUNIT_ASSERT(&w[0]==&w0); // same dimension: components kept in place
+}
+
+void TestIntervalVector::move02() {
+	IntervalVector x(20,Interval(1,2));
+	const Interval* x0=&x[0];
+	IntervalVector y(std::move(x));
+	CPPUNIT_ASSERT(&y[0]==x0); // no copy
+	CPPUNIT_ASSERT(y==IntervalVector(20,Interval(1,2)));
+
+	IntervalVector z(3);
+	z=std::move(y);
+	CPPUNIT_ASSERT(&z[0]==x0);
+	CPPUNIT_ASSERT(z==IntervalVector(20,Interval(1,2)));
+
+	z=IntervalVector(4,Interval(3,4)); // from a large to a small vector
+	CPPUNIT_ASSERT(z==IntervalVector(4,Interval(3,4)));
+}
+
+void TestIntervalVector::move03() {
+	IntervalVector x(2,Interval(1,2));
+	IntervalVector y(std::move(x)); // the components are copied
+	CPPUNIT_ASSERT(y==IntervalVector(2,Interval(1,2)));
+
+	IntervalVector z(20);
+	z=std::move(y);
+	CPPUNIT_ASSERT(z==IntervalVector(2,Interval(1,2)));
+
+	y=IntervalVector(20,Interval(3,4)); // from a small to a large vector
+	CPPUNIT_ASSERT(y==IntervalVector(20,Interval(3,4)));
+	y=IntervalVector(1,Interval(5,6));  // and back
+	CPPUNIT_ASSERT(y==IntervalVector(1,Interval(5,6)));
+}
+#endif
@@ -41,6 +41,7 @@ public:
 		CPPUNIT_TEST(resize02);
 		CPPUNIT_TEST(resize03);
 		CPPUNIT_TEST(resize04);
+		CPPUNIT_TEST(resize05);
 
 		CPPUNIT_TEST(subvector01);
 		CPPUNIT_TEST(subvector02);
@@ -126,6 +127,14 @@ public:
 
 		CPPUNIT_TEST(random01);
 		CPPUNIT_TEST(random02);
+
+		CPPUNIT_TEST(kernels01);
+		CPPUNIT_TEST(kernels02);
+#if __cplusplus >= 201103L
+		CPPUNIT_TEST(move01);
+		CPPUNIT_TEST(move02);
+		CPPUNIT_TEST(move03);
+#endif
 	CPPUNIT_TEST_SUITE_END();
 
 	/* test:
@@ -157,6 +166,7 @@ public:
 	void resize02();
 	void resize03();
 	void resize04();
+	void resize05(); // increase and decrease several times, from/to inline storage
 
 	// test: subvector(int start_index, int end_index)
 	void subvector01();
@@ -278,6 +288,18 @@ public:
 	void random01();
 	void random02();
 
+	// test: whole-vector operations (+,-,&,|,inflate,diam,max_diam,
+	// is_subset,rel_distance,dot product) against the component-wise ones
+	void kernels01(); // bounded vectors
+	void kernels02(); // unbounded components
+
+#if __cplusplus >= 201103L
+	// test: move constructor and move assignment
+	void move01(); // same dimension / different dimensions
+	void move02(); // no copy
+	void move03(); // small vectors (inline storage)
+#endif
+
 private:
 
 };
@@ -0,0 +1,177 @@
+//============================================================================
+//                                  I B E X
+// File        : TestNativeFunction.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestNativeFunction.h"
+#include "ibex_Function.h"
+#include "ibex_NativeFunction.h"
+
+#ifndef _WIN32
+#include <cstdlib>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * The command that compiles the native code, with the include directories
+ * of the build (see the makefile). By default, that of NativeFunction.
+ */
+#ifdef IBEX_TEST_NATIVE_CXX
+const char* native_cxx=IBEX_TEST_NATIVE_CXX;
+#else
+const char* native_cxx=NULL;
+#endif
+
+/*
+ * Check that the native code of f gives the same results as the interpreted
+ * algorithms on the box x (and for the projection onto y).
+ */
+bool same(const Function& f, const Function& g, const IntervalVector& x, const Interval& y) {
+	if (f.eval(x)!=g.eval(x)) return false;
+
+	IntervalVector gf=f.gradient(x);
+	IntervalVector gg=g.gradient(x);
+	if (gf!=gg) return false;
+
+	IntervalVector xf(x);
+	IntervalVector xg(x);
+	bool inner_f=f.backward(y,xf);
+	bool inner_g=g.backward(y,xg);
+	return inner_f==inner_g && xf==xg;
+}
+
+}
+
+void TestNativeFunction::code01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+exp(y)-1);
+	CPPUNIT_ASSERT(NativeFunction::is_supported(f));
+
+	string code=NativeFunction::code(f);
+	CPPUNIT_ASSERT(code.find("ibex_native_eval")!=string::npos);
+	CPPUNIT_ASSERT(code.find("ibex_native_proj")!=string::npos);
+	CPPUNIT_ASSERT(code.find("ibex_native_grad")!=string::npos);
+	CPPUNIT_ASSERT(code.find("bwd_sqr")!=string::npos);
+	CPPUNIT_ASSERT(code.find("bwd_exp")!=string::npos);
+
+	// the code only depends on the expression
+	Function g(x,y,sqr(x)+exp(y)-1);
+	CPPUNIT_ASSERT(NativeFunction::code(g)==code);
+}
+
+void TestNativeFunction::unsupported01() {
+	Variable x,y;
+	Function f(x,y,Return(x+y,x-y));
+	CPPUNIT_ASSERT(!NativeFunction::is_supported(f));
+	CPPUNIT_ASSERT_THROW(f.compile_native(), NativeFunctionException);
+	CPPUNIT_ASSERT(f.native()==NULL);
+
+	Variable z(2);
+	Function g(z,z[0]*z[1]);
+	CPPUNIT_ASSERT(!NativeFunction::is_supported(g));
+}
+
+void TestNativeFunction::native01() {
+	Variable x,y;
+	const ExprNode& e=sqr(x)+2*x*y-exp(y)/(1+sqr(x))+sqrt(abs(x))+max(x,y)-min(x,sqr(y))
+			+pow(y,3)+sin(x)*cos(y)-atan2(y,x)+log(1+sqr(y))+tanh(x-y)+atan(y)+sign(x);
+	Function f(x,y,e);
+	Function g(f,Function::COPY);
+
+	f.compile_native(NULL,native_cxx);
+	CPPUNIT_ASSERT(f.native()!=NULL);
+	CPPUNIT_ASSERT(g.native()==NULL);
+
+	double _x[][4]= { {-1,2,0,1}, {0.5,0.6,-3,-2}, {-10,10,-10,10}, {0.25,0.25,-0.5,-0.5}, {1,1e8,-1e8,-1} };
+	double _y[][2]= { {0,1}, {-100,0}, {-1e10,1e10}, {0,0}, {1,2} };
+
+	for (int i=0; i<5; i++) {
+		IntervalVector box(2);
+		box[0]=Interval(_x[i][0],_x[i][1]);
+		box[1]=Interval(_x[i][2],_x[i][3]);
+		for (int j=0; j<5; j++)
+			CPPUNIT_ASSERT(same(f,g,box,Interval(_y[j][0],_y[j][1])));
+	}
+}
+
+void TestNativeFunction::native02() {
+	Variable x,y;
+	Function f(x,y,sqrt(x)+y*log(y));
+	Function g(f,Function::COPY);
+
+	f.compile_native(NULL,native_cxx);
+	CPPUNIT_ASSERT(f.native()!=NULL);
+
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(1,2);
+	CPPUNIT_ASSERT(f.eval(box).is_empty());
+	CPPUNIT_ASSERT(f.gradient(box).is_empty());
+	CPPUNIT_ASSERT(same(f,g,box,Interval(0,1)));
+
+	box[0]=Interval(-2,1);
+	CPPUNIT_ASSERT(same(f,g,box,Interval(0,1)));
+	CPPUNIT_ASSERT(same(f,g,box,Interval(10,20)));
+
+	f.backward(Interval(10,20),box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestNativeFunction::cache01() {
+#ifndef _WIN32
+	Variable x;
+	Function f(x,sqr(x));
+
+	char dir[]="/tmp/ibex-native-XXXXXX";
+	CPPUNIT_ASSERT(mkdtemp(dir)!=NULL);
+	chmod(dir,0777);
+	CPPUNIT_ASSERT_THROW(f.compile_native(dir,native_cxx), NativeFunctionException);
+	CPPUNIT_ASSERT(f.native()==NULL);
+	rmdir(dir);
+#endif
+}
+
+void TestNativeFunction::cache02() {
+#ifndef _WIN32
+	Variable x;
+	Function f(x,sqr(x)+1);
+	Function g(f,Function::COPY);
+
+	char dir[]="/tmp/ibex-native-XXXXXX";
+	CPPUNIT_ASSERT(mkdtemp(dir)!=NULL);
+	f.compile_native(dir,native_cxx);
+	g.compile_native(dir,native_cxx); // loaded from the cache
+	CPPUNIT_ASSERT(f.native()!=NULL && g.native()!=NULL);
+
+	// the temporary files of the compilation are removed
+	vector<string> files;
+	DIR* d=opendir(dir);
+	CPPUNIT_ASSERT(d!=NULL);
+	struct dirent* e;
+	while ((e=readdir(d))!=NULL) {
+		string file=e->d_name;
+		if (file!="." && file!="..") files.push_back(file);
+	}
+	closedir(d);
+	CPPUNIT_ASSERT(files.size()==1);
+	CPPUNIT_ASSERT(files[0].size()>3 && files[0].compare(files[0].size()-3,3,".so")==0);
+
+	remove((string(dir)+"/"+files[0]).c_str());
+	rmdir(dir);
+#endif
+}
+
+} // end namespace ibex
@@ -0,0 +1,49 @@
+//============================================================================
+//                                  I B E X
+// File        : TestNativeFunction.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_NATIVE_FUNCTION_H__
+#define __TEST_NATIVE_FUNCTION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestNativeFunction : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestNativeFunction);
+		CPPUNIT_TEST(code01);
+		CPPUNIT_TEST(unsupported01);
+		CPPUNIT_TEST(native01);
+		CPPUNIT_TEST(native02);
+		CPPUNIT_TEST(cache01);
+		CPPUNIT_TEST(cache02);
+	CPPUNIT_TEST_SUITE_END();
+
+	// generated code
+	void code01();
+	// vector-valued function
+	void unsupported01();
+	// same results as the interpreted algorithms
+	void native01();
+	// evaluation outside the definition domain
+	void native02();
+	// cache directory writable by the others
+	void cache01();
+	// only the shared object remains in the cache
+	void cache02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestNativeFunction);
+
+} // end namespace ibex
+#endif // __TEST_NATIVE_FUNCTION_H__
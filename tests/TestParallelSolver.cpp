@@ -0,0 +1,185 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelSolver.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestParallelSolver.h"
+#include "ibex_ParallelSolver.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFixPoint.h"
+#include "ibex_Thread.h"
+#include "ibex_Random.h"
+
+#include <stdexcept>
+#include <fenv.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Each worker needs its own function (evaluators are not shared)
+class Worker {
+public:
+	Worker() : f(x,y,Return(sqr(x)+sqr(y)-1, y-sin(10*x))), fwdbwd(f), newton(f), compo(fwdbwd,newton),
+	ctc(compo), bsc(1e-9) { }
+
+	Variable x,y;
+	Function f;
+	CtcFwdBwd fwdbwd;
+	CtcNewton newton;
+	CtcCompo compo;
+	CtcFixPoint ctc;
+	RoundRobin bsc;
+};
+
+// Draw random numbers
+class Drawer : public Thread {
+public:
+	Drawer(unsigned long seed) : Thread(seed) { }
+
+	void run() {
+		for (int i=0; i<1000; i++) r[i]=RNG::rand();
+	}
+
+	uint32_t r[1000];
+};
+
+// Fail on small boxes
+class CtcFail : public Ctc {
+public:
+	CtcFail() : Ctc(2) { }
+
+	void contract(IntervalVector& box) {
+		if (box.max_diam()<0.1) throw std::runtime_error("small box");
+	}
+};
+
+}
+
+void TestParallelSolver::check_same_sols(int nb_threads) {
+	IntervalVector box(2,Interval(-2,2));
+
+	Worker w;
+	CellStack buff;
+	Solver s(w.ctc,w.bsc,buff);
+	vector<IntervalVector> sols=s.solve(box);
+
+	Worker* workers=new Worker[nb_threads];
+	Array<Ctc> ctc(nb_threads);
+	Array<Bsc> bsc(nb_threads);
+	for (int i=0; i<nb_threads; i++) {
+		ctc.set_ref(i,workers[i].ctc);
+		bsc.set_ref(i,workers[i].bsc);
+	}
+
+	ParallelSolver ps(ctc,bsc);
+	vector<IntervalVector> psols=ps.solve(box);
+
+	CPPUNIT_ASSERT(sols.size()==14);
+	CPPUNIT_ASSERT(psols.size()==sols.size());
+	CPPUNIT_ASSERT(ps.nb_cells==s.nb_cells);
+
+	for (unsigned int i=0; i<sols.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; !found && j<psols.size(); j++)
+			found = (sols[i]==psols[j]);
+		CPPUNIT_ASSERT(found);
+	}
+	delete[] workers;
+}
+
+void TestParallelSolver::same_sols01() {
+	check_same_sols(1);
+}
+
+void TestParallelSolver::same_sols02() {
+	check_same_sols(4);
+}
+
+void TestParallelSolver::cell_limit() {
+	Worker workers[2];
+	Array<Ctc> ctc(workers[0].ctc,workers[1].ctc);
+	Array<Bsc> bsc(workers[0].bsc,workers[1].bsc);
+	ParallelSolver ps(ctc,bsc);
+	ps.cell_limit=10;
+	ps.solve(IntervalVector(2,Interval(-2,2)));
+	CPPUNIT_ASSERT(ps.nb_cells>=10);
+	// each worker may have bisected one more cell before stopping
+	CPPUNIT_ASSERT(ps.nb_cells<=10+2*2);
+}
+
+void TestParallelSolver::rng01() {
+	RNG::srand(7);
+	uint32_t r[10];
+	for (int i=0; i<10; i++) r[i]=RNG::rand();
+
+	RNG::srand(7);
+	Drawer d1(3), d2(3), d3(4);
+	d1.start(); d2.start(); d3.start();
+	for (int i=0; i<5; i++) CPPUNIT_ASSERT(RNG::rand()==r[i]);
+	d1.join(); d2.join(); d3.join();
+	// the threads have not modified the generator of the main thread
+	for (int i=5; i<10; i++) CPPUNIT_ASSERT(RNG::rand()==r[i]);
+
+	bool same13=true;
+	for (int i=0; i<1000; i++) {
+		CPPUNIT_ASSERT(d1.r[i]==d2.r[i]);
+		same13 &= d1.r[i]==d3.r[i];
+	}
+	CPPUNIT_ASSERT(!same13);
+}
+
+void TestParallelSolver::exception01() {
+	CtcFail ctc1, ctc2;
+	RoundRobin bsc1(1e-9), bsc2(1e-9);
+	Array<Ctc> ctc(ctc1,ctc2);
+	Array<Bsc> bsc(bsc1,bsc2);
+	ParallelSolver ps(ctc,bsc);
+	CPPUNIT_ASSERT_THROW(ps.solve(IntervalVector(2,Interval(-2,2))), std::exception);
+	// the solver can be run again
+	CPPUNIT_ASSERT_THROW(ps.solve(IntervalVector(2,Interval(-2,2))), std::exception);
+}
+
+void TestParallelSolver::rounding01() {
+	IntervalVector box(2,Interval(-2,2));
+
+	Worker w;
+	CellStack buff;
+	Solver s(w.ctc,w.bsc,buff);
+
+	Worker workers[2];
+	Array<Ctc> ctc(2);
+	Array<Bsc> bsc(2);
+	for (int i=0; i<2; i++) {
+		ctc.set_ref(i,workers[i].ctc);
+		bsc.set_ref(i,workers[i].bsc);
+	}
+	ParallelSolver ps(ctc,bsc);
+
+	int mode=fegetround();
+	fesetround(FE_TONEAREST);
+	vector<IntervalVector> sols=s.solve(box);
+	int mode1=fegetround();
+	vector<IntervalVector> psols=ps.solve(box);
+	int mode2=fegetround();
+	fesetround(mode);
+
+	CPPUNIT_ASSERT(mode1==FE_TONEAREST);
+	CPPUNIT_ASSERT(mode2==FE_TONEAREST);
+	CPPUNIT_ASSERT(sols.size()==14);
+	CPPUNIT_ASSERT(psols.size()==14);
+}
+
+} // end namespace ibex
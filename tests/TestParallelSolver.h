@@ -0,0 +1,51 @@
+//============================================================================
+//                                  I B E X
+// File        : TestParallelSolver.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_PARALLEL_SOLVER_H__
+#define __TEST_PARALLEL_SOLVER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelSolver : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestParallelSolver);
+		CPPUNIT_TEST(same_sols01);
+		CPPUNIT_TEST(same_sols02);
+		CPPUNIT_TEST(cell_limit);
+		CPPUNIT_TEST(rng01);
+		CPPUNIT_TEST(exception01);
+		CPPUNIT_TEST(rounding01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// compare with the sequential solver (1 worker)
+	void same_sols01();
+	// compare with the sequential solver (4 workers)
+	void same_sols02();
+	void cell_limit();
+	// each thread has its own random generator
+	void rng01();
+	// an exception raised by a worker is passed to the caller
+	void exception01();
+	// the rounding mode of the caller is restored
+	void rounding01();
+
+private:
+	void check_same_sols(int nb_threads);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestParallelSolver);
+
+} // end namespace ibex
+#endif // __TEST_PARALLEL_SOLVER_H__
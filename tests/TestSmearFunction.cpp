@@ -0,0 +1,156 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSmearFunction.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestSmearFunction.h"
+#include "ibex_SmearFunction.h"
+#include "ibex_SparseJacobian.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Each constraint uses a part of the variables only */
+System* smear_sys() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	const ExprSymbol& z=ExprSymbol::new_();
+	const ExprSymbol& t=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_var(z);
+	f.add_var(t);
+	f.add_ctr(sqr(x)+3*y=1);
+	f.add_ctr(y*z-10*t=0);
+	f.add_ctr(x+sqr(t)-0.1*z=2);
+	return new System(f);
+}
+
+const double prec=1e-10;
+
+/*
+ * The choices made with the dense Jacobian matrix
+ * (the original code of the four variants).
+ */
+enum Variant { MAX, SUM, MAX_REL, SUM_REL };
+
+bool eligible(const IntervalVector& box, int j) {
+	return box[j].diam()>=prec && box[j].is_bisectable() &&
+			(box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec);
+}
+
+int dense_var_to_bisect(Variant v, const IntervalMatrix& J, const IntervalVector& box) {
+	int m=J.nb_rows();
+	int n=J.nb_cols();
+	double max_magn = NEG_INFINITY;
+	int var = -1;
+
+	double* ctrjsum = new double[m];
+	for (int i=0; i<m; i++) {
+		ctrjsum[i]=0;
+		for (int j=0; j<n ; j++)
+			ctrjsum[i]+= J[i][j].mag() * box[j].diam();
+	}
+
+	double maxsmear=0;
+	for (int j=0; j<n; j++) {
+		if (!eligible(box,j)) continue;
+		double sum_smear=0;
+		for (int i=0; i<m; i++) {
+			double impact=J[i][j].mag() * box[j].diam();
+			switch (v) {
+			case MAX:
+				if (impact > max_magn) { max_magn=impact; var=j; }
+				break;
+			case SUM:
+				sum_smear+=impact;
+				break;
+			case MAX_REL:
+				if (ctrjsum[i]!=0) maxsmear = impact / ctrjsum[i];
+				if (maxsmear > max_magn) { max_magn=maxsmear; var=j; }
+				break;
+			case SUM_REL:
+				if (ctrjsum[i]!=0) sum_smear+= impact / ctrjsum[i];
+				break;
+			}
+		}
+		if ((v==SUM || v==SUM_REL) && sum_smear > max_magn) {
+			max_magn=sum_smear;
+			var=j;
+		}
+	}
+	delete[] ctrjsum;
+	return var;
+}
+
+/* Check the four variants on a box */
+void check_smear(System& sys, const IntervalVector& box) {
+	SparseJacobian J(sys.f);
+	sys.f.jacobian(box,J);
+	IntervalMatrix D(J.nb_rows(),J.nb_cols());
+	J.to_dense(D);
+
+	SmearMax smax(sys,prec);
+	SmearSum ssum(sys,prec);
+	SmearMaxRelative smaxrel(sys,prec);
+	SmearSumRelative ssumrel(sys,prec);
+
+	CPPUNIT_ASSERT(smax.var_to_bisect(J,box)==dense_var_to_bisect(MAX,D,box));
+	CPPUNIT_ASSERT(ssum.var_to_bisect(J,box)==dense_var_to_bisect(SUM,D,box));
+	CPPUNIT_ASSERT(smaxrel.var_to_bisect(J,box)==dense_var_to_bisect(MAX_REL,D,box));
+	CPPUNIT_ASSERT(ssumrel.var_to_bisect(J,box)==dense_var_to_bisect(SUM_REL,D,box));
+}
+
+}
+
+void TestSmearFunction::smear01() {
+	System* sys=smear_sys();
+
+	// boxes of various shapes (the bounds follow a fixed sequence)
+	unsigned int seed=1;
+	for (int k=0; k<100; k++) {
+		IntervalVector box(4);
+		for (int j=0; j<4; j++) {
+			seed=seed*1103515245+12345;
+			double lb=((int) (seed>>16)%2000-1000)/100.0;
+			seed=seed*1103515245+12345;
+			double diam=((seed>>16)%1000+1)/(j==k%4? 10.0 : 100.0);
+			box[j]=Interval(lb,lb+diam);
+		}
+		check_smear(*sys,box);
+	}
+
+	delete sys;
+}
+
+void TestSmearFunction::smear02() {
+	System* sys=smear_sys();
+
+	// y, z and t are fixed: the normalizing factor of
+	// the 2nd constraint is 0 (and only x can be chosen)
+	IntervalVector box(4);
+	box[0]=Interval(1,2);
+	box[1]=Interval(0);
+	box[2]=Interval(0);
+	box[3]=Interval(3);
+	check_smear(*sys,box);
+
+	// y is fixed: the 2nd constraint only depends on z and t
+	box[2]=Interval(-1,1);
+	box[3]=Interval(0,0.5);
+	check_smear(*sys,box);
+
+	delete sys;
+}
+
+} // end namespace ibex
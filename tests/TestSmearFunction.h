@@ -0,0 +1,37 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSmearFunction.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_SMEAR_FUNCTION_H__
+#define __TEST_SMEAR_FUNCTION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestSmearFunction : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSmearFunction);
+		CPPUNIT_TEST(smear01);
+		CPPUNIT_TEST(smear02);
+	CPPUNIT_TEST_SUITE_END();
+
+	// same variable as with the dense Jacobian matrix, for the four variants
+	void smear01();
+	// same, with a constraint of zero impact (normalizing factor 0)
+	void smear02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSmearFunction);
+
+} // end namespace ibex
+#endif // __TEST_SMEAR_FUNCTION_H__
@@ -15,11 +15,19 @@
 #include "ibex_SystemFactory.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_SystemCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdint.h>
 
 #include <sstream>
 
 using namespace std;
 
+#define TMP_FILE_NAME "__tmp__.bch"
+
 namespace ibex {
 
 static System* sysex1() {
@@ -362,4 +370,156 @@ void TestSystem::merge04() {
 		CPPUNIT_ASSERT(sameExpr(sys3.ctrs[sys1.nb_ctr+i].f.expr(),sys2.ctrs[i].f.expr()));
 }
 
+void TestSystem::cache01() {
+	System& sys(*sysex1());
+	sys.box[0]=Interval(-1,1);
+	sys.box[12]=Interval(0,POS_INFINITY);
+	sys.box[5]=Interval::EMPTY_SET;
+
+	SystemCache::save(sys,TMP_FILE_NAME ".cache");
+	System* sys2=SystemCache::load(TMP_FILE_NAME ".cache");
+	remove(TMP_FILE_NAME ".cache");
+
+	CPPUNIT_ASSERT(sys2!=NULL);
+	CPPUNIT_ASSERT(sys2->nb_var==sys.nb_var);
+	CPPUNIT_ASSERT(sys2->nb_ctr==sys.nb_ctr);
+	CPPUNIT_ASSERT(sys2->args.size()==3);
+	for (int i=0; i<3; i++) {
+		CPPUNIT_ASSERT(strcmp(sys2->args[i].name,sys.args[i].name)==0);
+		CPPUNIT_ASSERT(sys2->args[i].dim==sys.args[i].dim);
+	}
+	CPPUNIT_ASSERT(sys2->box[0]==sys.box[0]);
+	CPPUNIT_ASSERT(sys2->box[5].is_empty());
+	CPPUNIT_ASSERT(sys2->box[12]==sys.box[12]);
+	CPPUNIT_ASSERT(sys2->goal!=NULL);
+	CPPUNIT_ASSERT(sameExpr(sys2->goal->expr(),sys.goal->expr()));
+	CPPUNIT_ASSERT(sys2->ctrs.size()==2);
+	for (int i=0; i<2; i++) {
+		CPPUNIT_ASSERT(sys2->ctrs[i].op==sys.ctrs[i].op);
+		CPPUNIT_ASSERT(sameExpr(sys2->ctrs[i].f.expr(),sys.ctrs[i].f.expr()));
+	}
+	CPPUNIT_ASSERT(sameExpr(sys2->f.expr(),sys.f.expr()));
+
+	IntervalVector box(sys.nb_var,Interval(1,2));
+	CPPUNIT_ASSERT(sys2->f.eval_vector(box)==sys.f.eval_vector(box));
+
+	delete sys2;
+	delete &sys;
+}
+
+void TestSystem::cache02() {
+	System& sys(*sysex3());
+
+	ofstream src(TMP_FILE_NAME);
+	src << "source";
+	src.close();
+
+	SystemCache::save(sys,TMP_FILE_NAME ".cache",TMP_FILE_NAME);
+
+	System* sys2=SystemCache::load(TMP_FILE_NAME ".cache",TMP_FILE_NAME);
+	CPPUNIT_ASSERT(sys2!=NULL);
+	CPPUNIT_ASSERT(sys2->nb_ctr==4);
+	CPPUNIT_ASSERT(sys2->goal==NULL);
+	delete sys2;
+
+	// the source file is modified: the cache is obsolete
+	src.open(TMP_FILE_NAME);
+	src << "modified source";
+	src.close();
+	CPPUNIT_ASSERT(SystemCache::load(TMP_FILE_NAME ".cache",TMP_FILE_NAME)==NULL);
+
+	// the file is corrupted
+	SystemCache::save(sys,TMP_FILE_NAME ".cache");
+	fstream cache(TMP_FILE_NAME ".cache", ios::in | ios::out | ios::binary);
+	cache.seekg(-1,ios::end);
+	char c=cache.get();
+	cache.seekp(-1,ios::end);
+	cache.put(c^1);
+	cache.close();
+	CPPUNIT_ASSERT(SystemCache::load(TMP_FILE_NAME ".cache")==NULL);
+
+	remove(TMP_FILE_NAME);
+	remove(TMP_FILE_NAME ".cache");
+	delete &sys;
+}
+
+void TestSystem::cache03() {
+	Variable x("x");
+	Function f(x,sqr(x));
+
+	SystemFactory fac;
+	Variable y("y");
+	fac.add_var(y);
+	fac.add_ctr(f(y)<=1);
+	System sys(fac);
+
+	// f is not an auxiliary function of the system
+	CPPUNIT_ASSERT_THROW(SystemCache::save(sys,TMP_FILE_NAME ".cache"),SystemCacheException);
+	CPPUNIT_ASSERT(SystemCache::load(TMP_FILE_NAME ".cache")==NULL);
+}
+
+namespace {
+
+/* Same layout as in ibex_SystemCache.cpp */
+struct CacheHeader {
+	char magic[4];
+	int version;
+	int endianness;
+	int int_size;
+	int double_size;
+	int64_t src_size;
+	int64_t src_mtime;
+	uint64_t data_size;
+	uint64_t checksum;
+};
+
+/* FNV-1a, as in ibex_SystemCache.cpp */
+uint64_t cache_checksum(const char* data, size_t n) {
+	uint64_t h=14695981039346656037ULL;
+	for (size_t i=0; i<n; i++) {
+		h^=(unsigned char) data[i];
+		h*=1099511628211ULL;
+	}
+	return h;
+}
+
+}
+
+void TestSystem::cache04() {
+	System& sys(*sysex1());
+	SystemCache::save(sys,TMP_FILE_NAME ".cache");
+
+	ifstream is(TMP_FILE_NAME ".cache", ios::binary);
+	string file((istreambuf_iterator<char>(is)), istreambuf_iterator<char>());
+	is.close();
+	CPPUNIT_ASSERT(file.size()>sizeof(CacheHeader));
+
+	// data that does not match the format, with a valid checksum
+	// (e.g., a collision): the cache is rejected or gives a valid system
+	const int values[3]={-1, 1<<30, 1000};
+	for (size_t pos=sizeof(CacheHeader); pos+sizeof(int)<=file.size(); pos+=sizeof(int)) {
+		for (int k=0; k<3; k++) {
+			string bad(file);
+			memcpy(&bad[pos],&values[k],sizeof(int));
+			CacheHeader h;
+			memcpy(&h,bad.data(),sizeof(CacheHeader));
+			h.checksum=cache_checksum(bad.data()+sizeof(CacheHeader),bad.size()-sizeof(CacheHeader));
+			memcpy(&bad[0],&h,sizeof(CacheHeader));
+
+			ofstream os(TMP_FILE_NAME ".cache", ios::binary);
+			os.write(bad.data(),bad.size());
+			os.close();
+
+			System* sys2=SystemCache::load(TMP_FILE_NAME ".cache");
+			if (sys2) {
+				CPPUNIT_ASSERT(sys2->nb_var==sys.nb_var);
+				delete sys2;
+			}
+		}
+	}
+
+	remove(TMP_FILE_NAME ".cache");
+	delete &sys;
+}
+
 } // end namespace
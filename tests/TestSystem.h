@@ -39,6 +39,10 @@ public:
 		CPPUNIT_TEST(merge02);
 		CPPUNIT_TEST(merge03);
 		CPPUNIT_TEST(merge04);
+		CPPUNIT_TEST(cache01);
+		CPPUNIT_TEST(cache02);
+		CPPUNIT_TEST(cache03);
+		CPPUNIT_TEST(cache04);
 	CPPUNIT_TEST_SUITE_END();
 
 	void factory01();
@@ -56,6 +60,10 @@ public:
 	void merge02();
 	void merge03();
 	void merge04();
+	void cache01();
+	void cache02();
+	void cache03();
+	void cache04();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSystem);
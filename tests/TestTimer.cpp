@@ -0,0 +1,111 @@
+//============================================================================
+//                                  I B E X
+// File        : TestTimer.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "TestTimer.h"
+#include "ibex_Timer.h"
+#include "ibex_Solver.h"
+#include "ibex_CellStack.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcIdentity.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Spend some CPU time */
+double busy(int n) {
+	volatile double x=1;
+	for (int i=0; i<n; i++) x=x*1.0000001;
+	return x;
+}
+
+}
+
+void TestTimer::timer01() {
+	Timer t1;
+	Timer t2(Timer::__REAL);
+	CPPUNIT_ASSERT(t1.get_time()==0);
+
+	t1.start();
+	busy(1000000);
+	t2.start();
+	busy(1000000);
+	t2.stop();
+	busy(1000000);
+	t1.stop();
+
+	CPPUNIT_ASSERT(t2.get_time()>0);
+	CPPUNIT_ASSERT(t1.get_time()>t2.get_time());
+
+	// a stopped timer does not change
+	double t=t1.get_time();
+	busy(1000000);
+	CPPUNIT_ASSERT(t1.get_time()==t);
+	CPPUNIT_ASSERT(t1.last_time()==t);
+
+	// restart
+	t1.start();
+	CPPUNIT_ASSERT(t1.get_time()<t);
+}
+
+void TestTimer::check01() {
+	Timer t(Timer::VIRTUAL,4);
+	t.start();
+	busy(1000000);
+	// the first check reads the clock
+	CPPUNIT_ASSERT_THROW(t.check(0), TimeOutException);
+
+	t.start();
+	t.check(1e10);
+	double t0=t.last_time();
+	busy(1000000);
+	// the next three checks do not read the clock
+	for (int i=0; i<3; i++) t.check(0);
+	CPPUNIT_ASSERT(t.last_time()==t0);
+	CPPUNIT_ASSERT_THROW(t.check(0), TimeOutException);
+	CPPUNIT_ASSERT(t.last_time()>t0);
+}
+
+void TestTimer::solver01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1); // a curve of solutions
+	CtcFwdBwd ctc(f);
+	RoundRobin bsc(1e-9);
+	CellStack buff;
+	Solver s(ctc,bsc,buff);
+	s.time_limit=0.05;
+	s.solve(IntervalVector(2,Interval(-2,2)));
+	CPPUNIT_ASSERT(s.time>=0.05);
+	CPPUNIT_ASSERT(!buff.empty());
+}
+
+void TestTimer::solver02() {
+	CtcIdentity ctc(2);
+	RoundRobin bsc(0);
+	CellStack buff;
+	Solver s(ctc,bsc,buff);
+	s.trace=-1;
+	s.cell_limit=2000;
+	vector<IntervalVector> sols;
+	s.start(IntervalVector(2,Interval(-2,2)));
+	while (s.next(sols)) { }
+	double t=s.time;
+	CPPUNIT_ASSERT(t>0);
+
+	// the limit is reached again at once: the time
+	// of the previous calls is not counted twice
+	while (s.next(sols)) { }
+	CPPUNIT_ASSERT(s.time>=t && s.time<1.5*t);
+}
+
+} // end namespace ibex
@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestTimer.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_TIMER_H__
+#define __TEST_TIMER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestTimer : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestTimer);
+		CPPUNIT_TEST(timer01);
+		CPPUNIT_TEST(check01);
+		CPPUNIT_TEST(solver01);
+		CPPUNIT_TEST(solver02);
+	CPPUNIT_TEST_SUITE_END();
+
+	// two timers are independent
+	void timer01();
+	// the clock is read once every period
+	void check01();
+	// time limit of a solver
+	void solver01();
+	// time of a solver stopped by the cell limit
+	void solver02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestTimer);
+
+} // end namespace ibex
+#endif // __TEST_TIMER_H__
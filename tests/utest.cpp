@@ -11,8 +11,11 @@
 
 #include <cppunit/ui/text/TestRunner.h>
 #include <cppunit/extensions/TestFactoryRegistry.h>
+#include "ibex_Interval.h"
 
 int main() {
+	// the tests use intervals outside a search
+	ibex::RoundUpScope round_up;
 	CppUnit::TextUi::TestRunner runner;
 	CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
 	runner.addTest( registry.makeTest() );
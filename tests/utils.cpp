@@ -102,4 +102,15 @@ bool almost_eq(const IntervalVector& y_actual, const IntervalVector& y_expected,
 	return true;
 }
 
+bool almost_eq(const IntervalMatrix& y_actual, const IntervalMatrix& y_expected, double err) {
+	if (y_actual.nb_rows()!=y_expected.nb_rows() || y_actual.nb_cols()!=y_expected.nb_cols()) return false;
+	if (y_actual.is_empty() && y_expected.is_empty()) return true;
+
+	for (int i=0; i<y_actual.nb_rows(); i++) {
+		if (!almost_eq(y_actual[i], y_expected[i],err)) return false;
+	}
+
+	return true;
+}
+
 
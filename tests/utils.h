@@ -14,6 +14,7 @@
 
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
 #include "ibex_Expr.h"
 
 using namespace ibex;
@@ -25,6 +26,7 @@ void check(const Interval& y_actual, const Interval& y_expected);
 void check(const IntervalVector& y_actual, const IntervalVector& y_expected);
 bool almost_eq(const Interval& y_actual, const Interval& y_expected, double err);
 bool almost_eq(const IntervalVector& y_actual, const IntervalVector& y_expected, double err);
+bool almost_eq(const IntervalMatrix& y_actual, const IntervalMatrix& y_expected, double err);
 
 extern double ERROR;
 